@@ -0,0 +1,183 @@
+// Copyright 2025 Quentin Cartier
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace udj::core::binary {
+
+/**
+ * @brief (offset, length) of a string in the string table
+ */
+struct StrRef {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+};
+
+/**
+ * @brief Where a section starts and how many records it holds
+ *
+ * For the string table, count is its size in bytes.
+ */
+struct Section {
+    uint32_t offset = 0;
+    uint32_t count = 0;
+};
+
+/**
+ * @brief FNV-1a, enough to catch truncated or corrupted cooked files
+ */
+inline uint32_t checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Builds a cooked file: fixed header, record arrays, string table
+ *
+ * Records are plain structs copied as bytes in native layout (every target
+ * is little-endian). Each section starts 4-byte aligned. The last of the
+ * kSections sections is the string table; equal strings are stored once.
+ */
+template <size_t kSections>
+class TableWriter {
+ public:
+    static constexpr uint32_t kStrings = kSections - 1;
+
+    StrRef intern(const std::string& value) {
+        auto iter = interned_.find(value);
+        if (iter != interned_.end()) {
+            return iter->second;
+        }
+        const StrRef ref{static_cast<uint32_t>(strings_.size()),
+                         static_cast<uint32_t>(value.size())};
+        strings_ += value;
+        interned_.emplace(value, ref);
+        return ref;
+    }
+
+    template <typename T>
+    void add(uint32_t section, const T& record) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&record);
+        sections_[section].insert(
+            sections_[section].end(), bytes, bytes + sizeof(T));
+        ++counts_[section];
+    }
+
+    [[nodiscard]] uint32_t count(uint32_t section) const {
+        return counts_[section];
+    }
+
+    /**
+     * @brief Lay the sections out after header_size bytes
+     * @param layout Receives each section's final offset and count
+     * @return The file with a zeroed header, for the caller to fill in
+     */
+    std::vector<uint8_t> finish(size_t header_size, Section* layout) {
+        sections_[kStrings].assign(strings_.begin(), strings_.end());
+        counts_[kStrings] = static_cast<uint32_t>(strings_.size());
+
+        auto offset = static_cast<uint32_t>(align4(header_size));
+        for (size_t id = 0; id < kSections; ++id) {
+            layout[id] = Section{offset, counts_[id]};
+            offset += static_cast<uint32_t>(align4(sections_[id].size()));
+        }
+
+        std::vector<uint8_t> out(offset, 0);
+        for (size_t id = 0; id < kSections; ++id) {
+            std::copy(sections_[id].begin(),
+                      sections_[id].end(),
+                      out.begin() + layout[id].offset);
+        }
+        return out;
+    }
+
+ private:
+    static size_t align4(size_t size) { return (size + 3u) & ~size_t{3u}; }
+
+    std::array<std::vector<uint8_t>, kSections> sections_;
+    std::array<uint32_t, kSections> counts_{};
+    std::string strings_;
+    std::unordered_map<std::string, StrRef> interned_;
+};
+
+/**
+ * @brief Bounds-checked reads from a cooked file laid out by TableWriter
+ *
+ * Call fits() once; record and range accesses are then safe as long as
+ * indices are checked with has_range().
+ */
+template <size_t kSections>
+class TableReader {
+ public:
+    static constexpr uint32_t kStrings = kSections - 1;
+
+    TableReader(const uint8_t* data, size_t size, const Section* layout,
+                const std::array<size_t, kSections>& record_sizes)
+        : data_(data), size_(size), layout_(layout),
+          record_sizes_(record_sizes) {}
+
+    // True if every section lies inside the file, aligned
+    [[nodiscard]] bool fits(size_t header_size) const {
+        for (size_t id = 0; id < kSections; ++id) {
+            const uint64_t end =
+                uint64_t{layout_[id].offset} +
+                uint64_t{layout_[id].count} * record_sizes_[id];
+            if (layout_[id].offset < header_size || end > size_ ||
+                layout_[id].offset % 4 != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    T at(uint32_t section, uint32_t index) const {
+        T record;
+        std::memcpy(&record,
+                    data_ + layout_[section].offset + index * sizeof(T),
+                    sizeof(T));
+        return record;
+    }
+
+    [[nodiscard]] uint32_t count(uint32_t section) const {
+        return layout_[section].count;
+    }
+
+    // True if [first, first + count) lies inside the section
+    [[nodiscard]] bool has_range(uint32_t section, uint32_t first,
+                                 uint32_t count) const {
+        return first <= layout_[section].count &&
+               count <= layout_[section].count - first;
+    }
+
+    // Out-of-range references read as empty strings
+    [[nodiscard]] std::string str(const StrRef& ref) const {
+        if (!has_range(kStrings, ref.offset, ref.length)) {
+            return {};
+        }
+        return std::string(reinterpret_cast<const char*>(
+                               data_ + layout_[kStrings].offset + ref.offset),
+                           ref.length);
+    }
+
+ private:
+    const uint8_t* data_;
+    size_t size_;
+    const Section* layout_;
+    std::array<size_t, kSections> record_sizes_;
+};
+
+}  // namespace udj::core::binary
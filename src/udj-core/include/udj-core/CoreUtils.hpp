@@ -2,6 +2,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <cstdio>  // FILE, fopen, fclose
 #include "udj-core/Logger.hpp"
 
@@ -12,16 +13,42 @@ namespace udj::core {
  */
 namespace filesystem {
 
+namespace internal {
+// Set by set_assets_base_path; empty means the built-in ASSETS_BASE_PATH
+inline std::string& assets_base_path_override() {
+    static std::string path;
+    return path;
+}
+}  // namespace internal
+
 /**
  * @brief Get the base path for assets
  *
  * Returns the platform-dependent base asset directory path.
- * This is either "assets/" for Linux or "/rd/" for Dreamcast.
+ * This is either "assets/" for Linux or "/rd/" for Dreamcast, unless
+ * set_assets_base_path() replaced it.
  *
  * @return A std::string containing the base asset path with trailing slash
  */
 inline std::string get_assets_base_path() {
-    return std::string(ASSETS_BASE_PATH);
+    const std::string& path = internal::assets_base_path_override();
+    return path.empty() ? std::string(ASSETS_BASE_PATH) : path;
+}
+
+/**
+ * @brief Resolve assets under another directory from now on
+ *
+ * Used by the host cook tools, which take the romdisk they work on as a
+ * command-line argument. A trailing slash is added if missing.
+ *
+ * @param path The new base asset directory
+ */
+inline void set_assets_base_path(const std::string& path) {
+    std::string& base = internal::assets_base_path_override();
+    base = path;
+    if (!base.empty() && base.back() != '/') {
+        base += '/';
+    }
 }
 
 /**
@@ -58,6 +85,21 @@ inline bool file_exists(const std::string& filepath) {
     return false;
 }
 
+/**
+ * @brief Check that a file derived from sources (cooked, compiled or
+ * cached) can be used instead of them
+ *
+ * On the host, derived must exist and no source may be newer than it; a
+ * missing source does not count. On Dreamcast only existence is checked,
+ * since the romdisk is built in one go.
+ *
+ * @param derived Path of the derived file
+ * @param sources Paths of the files it was made from
+ * @return true if derived is up to date
+ */
+bool is_up_to_date(const std::string& derived,
+                   const std::vector<std::string>& sources);
+
 }  // namespace filesystem
 
 /**
@@ -94,6 +136,8 @@ namespace udjourney::coreutils {
 using udj::core::filesystem::file_exists;
 using udj::core::filesystem::get_assets_base_path;
 using udj::core::filesystem::get_assets_path;
+using udj::core::filesystem::is_up_to_date;
+using udj::core::filesystem::set_assets_base_path;
 
 // Math utilities
 namespace math = udj::core::math;
@@ -0,0 +1,26 @@
+// Copyright 2025 Quentin Cartier
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace udj::core::lz4 {
+
+/**
+ * @brief Compress into a raw LZ4 block (no frame header, no checksum)
+ *
+ * Greedy single-pass matcher: much weaker than the reference encoder, but
+ * its output is a valid LZ4 block and it only runs at cook time.
+ */
+std::vector<uint8_t> compress(const uint8_t* src, size_t size);
+
+/**
+ * @brief Decompress a raw LZ4 block into exactly dst_size bytes
+ * @return False on malformed input or size mismatch
+ */
+bool decompress(const uint8_t* src, size_t src_size, uint8_t* dst,
+                size_t dst_size);
+
+}  // namespace udj::core::lz4
@@ -0,0 +1,43 @@
+// Copyright 2025 Quentin Cartier
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace udj::core::filesystem {
+
+/**
+ * @brief Read-only view of a whole file
+ *
+ * Memory-mapped on POSIX hosts, so only the pages actually touched are
+ * read. On Dreamcast (and anywhere mmap is unavailable) the file is read
+ * into one buffer with a single call instead.
+ */
+class MappedFile {
+ public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // False if the file is missing, unreadable or empty
+    bool open(const std::string& path);
+    void close();
+
+    [[nodiscard]] bool is_open() const noexcept { return data_ != nullptr; }
+    [[nodiscard]] const uint8_t* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+ private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<uint8_t> buffer_;  // Backing store when not mapped
+};
+
+}  // namespace udj::core::filesystem
@@ -0,0 +1,154 @@
+// Copyright 2025 Quentin Cartier
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace udj::core {
+
+/**
+ * @brief Small, fast PCG32 generator (16 bytes of state)
+ *
+ * Same seed and stream always produce the same sequence on every platform.
+ * Satisfies UniformRandomBitGenerator, so it can also drive <random>
+ * distributions when needed.
+ */
+class Rng {
+ public:
+    using result_type = uint32_t;
+
+    struct State {
+        uint64_t state = 0;
+        uint64_t inc = 0;
+    };
+
+    Rng() { seed(0x853c49e6748fea9bULL); }
+    explicit Rng(uint64_t seed_value, uint64_t stream = 0) {
+        seed(seed_value, stream);
+    }
+
+    /**
+     * @brief Reset the generator
+     * @param seed_value Starting point in the sequence
+     * @param stream Sequence selector: different streams never overlap
+     */
+    void seed(uint64_t seed_value, uint64_t stream = 0) {
+        state_.state = 0;
+        state_.inc = (stream << 1u) | 1u;
+        next_u32();
+        state_.state += seed_value;
+        next_u32();
+    }
+
+    uint32_t next_u32() {
+        const uint64_t old = state_.state;
+        state_.state = old * 6364136223846793005ULL + state_.inc;
+        const auto xorshifted =
+            static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const auto rot = static_cast<uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31u));
+    }
+
+    /**
+     * @brief Uniform float in [0, 1)
+     */
+    float next_float() {
+        return static_cast<float>(next_u32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * @brief Uniform float in [min, max)
+     */
+    float range(float min, float max) {
+        return min + (max - min) * next_float();
+    }
+
+    /**
+     * @brief Uniform integer in [min, max] (returns min if max < min)
+     */
+    int range_int(int min, int max) {
+        if (max <= min) return min;
+        const auto span = static_cast<uint64_t>(
+            static_cast<int64_t>(max) - static_cast<int64_t>(min) + 1);
+        return static_cast<int>(min + static_cast<int64_t>(
+                                          (next_u32() * span) >> 32));
+    }
+
+    /**
+     * @brief Fill an array with uniform floats in [min, max)
+     *
+     * Cheaper than drawing one value at a time through a distribution;
+     * meant for spawning many particles at once.
+     */
+    void fill_range(float* out, size_t count, float min, float max) {
+        const float scale = (max - min) * (1.0f / 16777216.0f);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = min + static_cast<float>(next_u32() >> 8) * scale;
+        }
+    }
+
+    [[nodiscard]] State get_state() const { return state_; }
+    void set_state(const State& state) { state_ = state; }
+
+    // UniformRandomBitGenerator interface
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+    result_type operator()() { return next_u32(); }
+
+ private:
+    State state_;
+};
+
+/**
+ * @brief Independent random streams, one per subsystem
+ *
+ * Keeping subsystems on separate streams means that, for example, adding a
+ * particle effect does not change where platforms spawn for a given seed.
+ */
+enum class RngStream : uint8_t {
+    Gameplay = 0,
+    Platforms,
+    Bonus,
+    Particles,
+    Count
+};
+
+/**
+ * @brief Process-wide source of seeded random streams
+ */
+class RngService {
+ public:
+    static constexpr size_t kStreamCount =
+        static_cast<size_t>(RngStream::Count);
+
+    struct Snapshot {
+        uint64_t seed = 0;
+        std::array<Rng::State, kStreamCount> streams{};
+    };
+
+    static RngService& get_instance();
+
+    /**
+     * @brief Reseed every stream from a single master seed
+     */
+    void seed(uint64_t seed_value);
+    [[nodiscard]] uint64_t get_seed() const { return seed_; }
+
+    Rng& stream(RngStream id) { return streams_[static_cast<size_t>(id)]; }
+
+    /**
+     * @brief Capture the state of every stream (e.g. for replays)
+     */
+    [[nodiscard]] Snapshot save() const;
+    void restore(const Snapshot& snapshot);
+
+ private:
+    RngService();
+
+    uint64_t seed_ = 0;
+    std::array<Rng, kStreamCount> streams_;
+};
+
+}  // namespace udj::core
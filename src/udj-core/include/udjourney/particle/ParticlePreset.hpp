@@ -43,6 +43,21 @@ struct ParticlePreset {
     // Emitter properties
     float emitter_lifetime =
         0.0f;  // 0 = infinite, >0 = auto-destroy after time
+
+    // World collision against static platforms (opt-in)
+    bool collide_with_world = false;
+    float world_bounce = 0.4f;  // Velocity kept on impact, 0 = die on contact
+
+    // Baked flipbook (burst presets only). When enabled, bursts play a
+    // pre-rendered sprite sheet produced by udj-particle-baker instead of
+    // simulating every particle at runtime.
+    bool bake = false;
+    std::string bake_sheet;      // Defaults to particles/baked/<name>.png
+    int bake_frame_count = 16;   // Number of frames in the flipbook
+    int bake_columns = 4;        // Frames per row in the sheet
+    int bake_frame_size = 64;    // Square frame size in pixels
+    float bake_fps = 20.0f;      // Playback rate in frames per second
+    unsigned int bake_seed = 1;  // Fixed seed used when baking
 };
 
 }  // namespace udjourney
@@ -1,4 +1,115 @@
 // Copyright 2025 Quentin Cartier
 #include "udj-core/CoreUtils.hpp"
+#include "udj-core/MappedFile.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifndef _arch_dreamcast
+#include <filesystem>
+#endif
+
+// KOS has no useful mmap for the romdisk; plain reads there
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_arch_dreamcast)
+#define UDJ_CORE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 // Additional filesystem utilities can be implemented here as needed
+
+namespace udj::core::filesystem {
+
+bool is_up_to_date(const std::string& derived,
+                   const std::vector<std::string>& sources) {
+#ifdef _arch_dreamcast
+    (void)sources;
+    return file_exists(derived);
+#else
+    std::error_code error;
+    const auto derived_time = std::filesystem::last_write_time(derived, error);
+    if (error) {
+        return false;
+    }
+    for (const auto& source : sources) {
+        const auto source_time =
+            std::filesystem::last_write_time(source, error);
+        if (!error && source_time > derived_time) {
+            Logger::info("% is older than %, ignoring it", derived, source);
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+#ifdef UDJ_CORE_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* mapping = ::mmap(nullptr,
+                           static_cast<size_t>(info.st_size),
+                           PROT_READ,
+                           MAP_PRIVATE,
+                           fd,
+                           0);
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (mapping != MAP_FAILED) {
+        data_ = static_cast<const uint8_t*>(mapping);
+        size_ = static_cast<size_t>(info.st_size);
+        mapped_ = true;
+        return true;
+    }
+#endif
+
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    const long length = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (length > 0) {
+        buffer_.resize(static_cast<size_t>(length));
+        if (std::fread(buffer_.data(), 1, buffer_.size(), file) !=
+            buffer_.size()) {
+            buffer_.clear();
+        }
+    }
+    std::fclose(file);
+
+    if (buffer_.empty()) {
+        return false;
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+}
+
+void MappedFile::close() {
+#ifdef UDJ_CORE_HAS_MMAP
+    if (mapped_) {
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+}
+
+}  // namespace udj::core::filesystem
@@ -0,0 +1,174 @@
+// Copyright 2025 Quentin Cartier
+#include "udj-core/Lz4.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace udj::core::lz4 {
+
+namespace {
+
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;   // Block must end with literals
+constexpr size_t kMatchSafeEnd = 12;  // No match may start past size - 12
+constexpr size_t kMaxOffset = 65535;
+constexpr int kHashBits = 12;
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+void write_length(std::vector<uint8_t>* out, size_t length) {
+    while (length >= 255) {
+        out->push_back(255);
+        length -= 255;
+    }
+    out->push_back(static_cast<uint8_t>(length));
+}
+
+void write_sequence(std::vector<uint8_t>* out, const uint8_t* literals,
+                    size_t literal_count, size_t offset, size_t match_length) {
+    const size_t match_code = match_length - kMinMatch;
+    const auto token = static_cast<uint8_t>(
+        (std::min<size_t>(literal_count, 15) << 4) |
+        std::min<size_t>(match_code, 15));
+    out->push_back(token);
+    if (literal_count >= 15) {
+        write_length(out, literal_count - 15);
+    }
+    out->insert(out->end(), literals, literals + literal_count);
+    out->push_back(static_cast<uint8_t>(offset & 0xFF));
+    out->push_back(static_cast<uint8_t>(offset >> 8));
+    if (match_code >= 15) {
+        write_length(out, match_code - 15);
+    }
+}
+
+void write_last_literals(std::vector<uint8_t>* out, const uint8_t* literals,
+                         size_t literal_count) {
+    out->push_back(
+        static_cast<uint8_t>(std::min<size_t>(literal_count, 15) << 4));
+    if (literal_count >= 15) {
+        write_length(out, literal_count - 15);
+    }
+    out->insert(out->end(), literals, literals + literal_count);
+}
+
+// Reads a 15 + 255 + ... extended length; false if it runs off the input
+bool read_length(const uint8_t** ip, const uint8_t* end, size_t* length) {
+    uint8_t byte = 0;
+    do {
+        if (*ip >= end) {
+            return false;
+        }
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+}  // namespace
+
+std::vector<uint8_t> compress(const uint8_t* src, size_t size) {
+    std::vector<uint8_t> out;
+    out.reserve(size / 2 + 16);
+
+    std::array<int64_t, size_t{1} << kHashBits> table;
+    table.fill(-1);
+
+    size_t anchor = 0;
+    size_t i = 0;
+    const size_t match_limit = size > kMatchSafeEnd ? size - kMatchSafeEnd : 0;
+    while (i < match_limit) {
+        const uint32_t sequence = read32(src + i);
+        const uint32_t h = hash(sequence);
+        const int64_t candidate = table[h];
+        table[h] = static_cast<int64_t>(i);
+
+        if (candidate < 0 ||
+            i - static_cast<size_t>(candidate) > kMaxOffset ||
+            read32(src + candidate) != sequence) {
+            ++i;
+            continue;
+        }
+
+        const auto match = static_cast<size_t>(candidate);
+        size_t length = kMinMatch;
+        const size_t max_length = size - kLastLiterals - i;
+        while (length < max_length && src[match + length] == src[i + length]) {
+            ++length;
+        }
+
+        write_sequence(&out, src + anchor, i - anchor, i - match, length);
+        i += length;
+        anchor = i;
+    }
+
+    write_last_literals(&out, src + anchor, size - anchor);
+    return out;
+}
+
+bool decompress(const uint8_t* src, size_t src_size, uint8_t* dst,
+                size_t dst_size) {
+    const uint8_t* ip = src;
+    const uint8_t* const ip_end = src + src_size;
+    uint8_t* op = dst;
+    uint8_t* const op_end = dst + dst_size;
+
+    while (ip < ip_end) {
+        const uint8_t token = *ip++;
+
+        size_t literal_count = token >> 4;
+        if (literal_count == 15 && !read_length(&ip, ip_end, &literal_count)) {
+            return false;
+        }
+        if (literal_count > static_cast<size_t>(ip_end - ip) ||
+            literal_count > static_cast<size_t>(op_end - op)) {
+            return false;
+        }
+        std::memcpy(op, ip, literal_count);
+        ip += literal_count;
+        op += literal_count;
+
+        // The last sequence carries literals only
+        if (ip == ip_end) {
+            break;
+        }
+
+        if (ip_end - ip < 2) {
+            return false;
+        }
+        const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t match_length = token & 15;
+        if (match_length == 15 && !read_length(&ip, ip_end, &match_length)) {
+            return false;
+        }
+        match_length += kMinMatch;
+        if (match_length > static_cast<size_t>(op_end - op)) {
+            return false;
+        }
+
+        // Byte copy: the match may overlap the bytes it produces
+        const uint8_t* match = op - offset;
+        for (size_t k = 0; k < match_length; ++k) {
+            op[k] = match[k];
+        }
+        op += match_length;
+    }
+
+    return op == op_end;
+}
+
+}  // namespace udj::core::lz4
@@ -0,0 +1,36 @@
+// Copyright 2025 Quentin Cartier
+#include "udj-core/Random.hpp"
+
+namespace udj::core {
+
+RngService& RngService::get_instance() {
+    static RngService instance;
+    return instance;
+}
+
+RngService::RngService() { seed(0); }
+
+void RngService::seed(uint64_t seed_value) {
+    seed_ = seed_value;
+    for (size_t i = 0; i < kStreamCount; ++i) {
+        streams_[i].seed(seed_value, i);
+    }
+}
+
+RngService::Snapshot RngService::save() const {
+    Snapshot snapshot;
+    snapshot.seed = seed_;
+    for (size_t i = 0; i < kStreamCount; ++i) {
+        snapshot.streams[i] = streams_[i].get_state();
+    }
+    return snapshot;
+}
+
+void RngService::restore(const Snapshot& snapshot) {
+    seed_ = snapshot.seed;
+    for (size_t i = 0; i < kStreamCount; ++i) {
+        streams_[i].set_state(snapshot.streams[i]);
+    }
+}
+
+}  // namespace udj::core
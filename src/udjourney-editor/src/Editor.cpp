@@ -35,6 +35,7 @@
 #include "udjourney-editor/ParticlePresetPanel.hpp"
 #include "udjourney-editor/ToastNotification.hpp"
 #include "udj-core/CoreUtils.hpp"
+#include "udjourney/scene/Scene.hpp"
 
 struct Editor::PImpl {
     bool running = true;
@@ -265,12 +266,25 @@ void Editor::export_platform_level_json(const std::string &export_path) {
     out.close();
     pimpl->last_export_path = export_path;
 
+    // Compiled copy next to the JSON, read by the game instead of the JSON
+    udjourney::scene::Scene compiled;
+    const bool compiled_ok =
+        compiled.load_from_json(export_path) &&
+        compiled.save_to_binary(
+            udjourney::scene::Scene::compiled_path_for(export_path));
+
     // Show success toast
     std::filesystem::path path(export_path);
     pimpl->toast_manager.add_toast(
         "Successfully exported level at " + path.filename().string(),
         udjourney::editor::ToastType::Success,
         4.0f);
+    if (!compiled_ok) {
+        pimpl->toast_manager.add_toast(
+            "Could not write the compiled level (.udl)",
+            udjourney::editor::ToastType::Warning,
+            4.0f);
+    }
 }
 
 void Editor::import_platform_level_json(const std::string &import_path) {
@@ -229,6 +229,32 @@ void ParticlePresetPanel::draw_preset_editor_() {
     tooltip(
         "If > 0, spawns this many particles at once (burst).\nIf 0, the effect "
         "relies on Emission Rate.");
+    if (p.burst_count > 0) {
+        if (ImGui::Checkbox("Bake Flipbook", &p.bake)) {
+            has_unsaved_changes_ = true;
+        }
+        tooltip(
+            "Play a pre-rendered sprite sheet instead of simulating each "
+            "particle.\nRun the bake_particles target after saving to "
+            "regenerate the sheet.");
+        if (p.bake) {
+            bool bake_changed = false;
+            bake_changed |= ImGui::InputInt("Bake Frames", &p.bake_frame_count);
+            bake_changed |= ImGui::InputInt("Bake Columns", &p.bake_columns);
+            bake_changed |=
+                ImGui::InputInt("Bake Frame Size", &p.bake_frame_size);
+            bake_changed |= ImGui::InputFloat(
+                "Bake FPS", &p.bake_fps, 1.0f, 5.0f, "%.1f");
+            tooltip("Flipbook playback rate (frames per second).");
+            if (bake_changed) {
+                p.bake_frame_count = std::max(1, p.bake_frame_count);
+                p.bake_columns = std::max(1, p.bake_columns);
+                p.bake_frame_size = std::max(1, p.bake_frame_size);
+                p.bake_fps = std::max(1.0f, p.bake_fps);
+                has_unsaved_changes_ = true;
+            }
+        }
+    }
 
     // Lifetimes
     if (ImGui::InputFloat(
@@ -346,6 +372,18 @@ void ParticlePresetPanel::draw_preset_editor_() {
     tooltip(
         "How long the emitter keeps spawning particles (seconds).\n0 means "
         "infinite (never auto-stops).");
+    if (ImGui::Checkbox("Collide With World", &p.collide_with_world)) {
+        has_unsaved_changes_ = true;
+    }
+    tooltip(
+        "Particles bounce off (or die against) static platforms in game.\n"
+        "Not simulated in this preview.");
+    if (p.collide_with_world) {
+        if (ImGui::SliderFloat("World Bounce", &p.world_bounce, 0.0f, 1.0f)) {
+            has_unsaved_changes_ = true;
+        }
+        tooltip("Fraction of velocity kept on impact. 0 kills the particle.");
+    }
 }
 
 void ParticlePresetPanel::draw_preview_() {
@@ -454,6 +492,17 @@ bool ParticlePresetPanel::load_from_assets_() {
             p.rotation_speed = pjson.value("rotation_speed", 0.0f);
             p.emitter_lifetime = pjson.value("emitter_lifetime", 0.0f);
 
+            p.collide_with_world = pjson.value("collide_with_world", false);
+            p.world_bounce = pjson.value("world_bounce", 0.4f);
+
+            p.bake = pjson.value("bake", false);
+            p.bake_sheet = pjson.value("bake_sheet", "");
+            p.bake_frame_count = pjson.value("bake_frame_count", 16);
+            p.bake_columns = pjson.value("bake_columns", 4);
+            p.bake_frame_size = pjson.value("bake_frame_size", 64);
+            p.bake_fps = pjson.value("bake_fps", 20.0f);
+            p.bake_seed = pjson.value("bake_seed", 1u);
+
             if (!p.name.empty()) {
                 presets_.push_back(p);
             }
@@ -507,6 +556,23 @@ bool ParticlePresetPanel::save_to_assets_() {
             pj["rotation_speed"] = p.rotation_speed;
             pj["emitter_lifetime"] = p.emitter_lifetime;
 
+            if (p.collide_with_world) {
+                pj["collide_with_world"] = true;
+                pj["world_bounce"] = p.world_bounce;
+            }
+
+            if (p.bake) {
+                pj["bake"] = true;
+                if (!p.bake_sheet.empty()) {
+                    pj["bake_sheet"] = p.bake_sheet;
+                }
+                pj["bake_frame_count"] = p.bake_frame_count;
+                pj["bake_columns"] = p.bake_columns;
+                pj["bake_frame_size"] = p.bake_frame_size;
+                pj["bake_fps"] = p.bake_fps;
+                pj["bake_seed"] = p.bake_seed;
+            }
+
             j["particles"].push_back(pj);
         }
 
@@ -0,0 +1,227 @@
+// Copyright 2025 Quentin Cartier
+//
+// udj-atlas-packer: packs the sprite sheets listed in atlas_sources.json into
+// a few power-of-two atlas pages, so sprites from different sheets can share
+// one texture bind and batch together.
+//
+// Usage: udj-atlas-packer <romdisk_dir>
+//
+// Writes <romdisk_dir>/atlases/atlas_<n>.png and the remap table
+// <romdisk_dir>/atlases/atlas_map.json. TextureManager loads the table at
+// startup and the loaders offset their source rects by each sheet's place
+// in its page. Whole sheets are packed (not single frames), so frame grids
+// stay valid after the offset. Each sheet is surrounded by `padding` pixels
+// of its own extruded border, so filtering or rounding never samples a
+// neighbour.
+
+#include <raylib/raylib.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "udjourney/managers/AtlasMap.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Sheet {
+    std::string path;  // Asset-relative
+    Image image{};     // RGBA8
+    int page = -1;     // -1 until placed
+    int x = 0;         // Padded slot position in the page
+    int y = 0;
+};
+
+// Shelf packer: rows of items sharing the height of their tallest item
+struct Shelf {
+    int y = 0;
+    int height = 0;
+    int used_width = 0;
+};
+
+struct Page {
+    std::vector<Shelf> shelves;
+    int used_width = 0;
+    int used_height = 0;
+};
+
+int next_pow2(int value) {
+    int result = 8;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+bool place_in_page(Page* page, int width, int height, int page_size,
+                   int* out_x, int* out_y) {
+    for (Shelf& shelf : page->shelves) {
+        if (height <= shelf.height && shelf.used_width + width <= page_size) {
+            *out_x = shelf.used_width;
+            *out_y = shelf.y;
+            shelf.used_width += width;
+            page->used_width = std::max(page->used_width, shelf.used_width);
+            return true;
+        }
+    }
+
+    const int shelf_y = page->shelves.empty()
+                            ? 0
+                            : page->shelves.back().y +
+                                  page->shelves.back().height;
+    if (shelf_y + height > page_size || width > page_size) {
+        return false;
+    }
+    page->shelves.push_back(Shelf{shelf_y, height, width});
+    page->used_width = std::max(page->used_width, width);
+    page->used_height = shelf_y + height;
+    *out_x = 0;
+    *out_y = shelf_y;
+    return true;
+}
+
+// Copies sheet into pixels at (x, y) plus padding, clamping to the border
+void blit_extruded(const Sheet& sheet, int padding, std::vector<Color>* pixels,
+                   int page_width) {
+    const auto* src = static_cast<const Color*>(sheet.image.data);
+    const int w = sheet.image.width;
+    const int h = sheet.image.height;
+    for (int py = -padding; py < h + padding; ++py) {
+        const int sy = std::clamp(py, 0, h - 1);
+        for (int px = -padding; px < w + padding; ++px) {
+            const int sx = std::clamp(px, 0, w - 1);
+            const int dx = sheet.x + padding + px;
+            const int dy = sheet.y + padding + py;
+            (*pixels)[dy * page_width + dx] = src[sy * w + sx];
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <romdisk_dir>" << std::endl;
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    const fs::path romdisk_dir(argv[1]);
+    std::ifstream config_file(romdisk_dir / "atlas_sources.json");
+    if (!config_file.is_open()) {
+        std::cerr << "Cannot open " << (romdisk_dir / "atlas_sources.json")
+                  << std::endl;
+        return 1;
+    }
+    nlohmann::json config;
+    try {
+        config_file >> config;
+    } catch (const nlohmann::json::exception& e) {
+        std::cerr << "Cannot parse atlas_sources.json: " << e.what()
+                  << std::endl;
+        return 1;
+    }
+
+    const int page_size = config.value("page_size", 1024);
+    const int padding = config.value("padding", 2);
+
+    std::vector<Sheet> sheets;
+    for (const auto& path : config.value("sheets", nlohmann::json::array())) {
+        Sheet sheet;
+        sheet.path = path.get<std::string>();
+        sheet.image = LoadImage((romdisk_dir / sheet.path).string().c_str());
+        if (sheet.image.data == nullptr) {
+            std::cerr << "  skipping " << sheet.path << ": cannot load"
+                      << std::endl;
+            continue;
+        }
+        ImageFormat(&sheet.image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        sheets.push_back(sheet);
+    }
+
+    // Tallest first keeps shelves tight
+    std::sort(sheets.begin(), sheets.end(), [](const Sheet& a, const Sheet& b) {
+        return a.image.height != b.image.height
+                   ? a.image.height > b.image.height
+                   : a.image.width > b.image.width;
+    });
+
+    std::vector<Page> pages;
+    for (Sheet& sheet : sheets) {
+        const int width = sheet.image.width + 2 * padding;
+        const int height = sheet.image.height + 2 * padding;
+        if (width > page_size || height > page_size) {
+            std::cerr << "  skipping " << sheet.path << ": larger than a "
+                      << page_size << " px page" << std::endl;
+            continue;
+        }
+
+        for (size_t i = 0; i <= pages.size() && sheet.page < 0; ++i) {
+            if (i == pages.size()) {
+                pages.emplace_back();
+            }
+            if (place_in_page(
+                    &pages[i], width, height, page_size, &sheet.x, &sheet.y)) {
+                sheet.page = static_cast<int>(i);
+            }
+        }
+    }
+
+    fs::create_directories(romdisk_dir / "atlases");
+    AtlasMap atlas_map;
+    bool ok = true;
+    for (size_t i = 0; i < pages.size(); ++i) {
+        const int page_width = next_pow2(pages[i].used_width);
+        const int page_height = next_pow2(pages[i].used_height);
+        std::vector<Color> pixels(
+            static_cast<size_t>(page_width) * page_height, BLANK);
+
+        const std::string page_path =
+            "atlases/atlas_" + std::to_string(i) + ".png";
+        int sheet_count = 0;
+        for (const Sheet& sheet : sheets) {
+            if (sheet.page != static_cast<int>(i)) continue;
+            blit_extruded(sheet, padding, &pixels, page_width);
+            atlas_map.add(
+                sheet.path,
+                AtlasEntry{page_path,
+                           Rectangle{static_cast<float>(sheet.x + padding),
+                                     static_cast<float>(sheet.y + padding),
+                                     static_cast<float>(sheet.image.width),
+                                     static_cast<float>(sheet.image.height)}});
+            ++sheet_count;
+        }
+
+        Image page{pixels.data(),
+                   page_width,
+                   page_height,
+                   1,
+                   PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        const fs::path out_path = romdisk_dir / page_path;
+        if (ExportImage(page, out_path.string().c_str())) {
+            std::cout << "  " << out_path.string() << ": " << sheet_count
+                      << " sheet(s), " << page_width << "x" << page_height
+                      << std::endl;
+        } else {
+            ok = false;
+        }
+    }
+
+    for (Sheet& sheet : sheets) {
+        UnloadImage(sheet.image);
+    }
+
+    const fs::path map_path = romdisk_dir / "atlases" / "atlas_map.json";
+    ok = atlas_map.save_to_file(map_path.string()) && ok;
+    std::cout << "Packed " << atlas_map.size() << " sheet(s) into "
+              << pages.size() << " page(s)" << std::endl;
+    return ok ? 0 : 1;
+}
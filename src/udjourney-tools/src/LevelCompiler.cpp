@@ -0,0 +1,72 @@
+// Copyright 2025 Quentin Cartier
+//
+// udj-level-compiler: compiles each level JSON into the binary .udl next to
+// it (levels/foo.json -> levels/foo.udl). Scene::load_from_file picks the
+// .udl up instead of parsing the JSON.
+//
+// Usage: udj-level-compiler <romdisk_dir> [level.json...]
+//
+// Without level arguments every levels/*.json of <romdisk_dir> is
+// processed.
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <udj-core/CoreUtils.hpp>
+
+#include "udjourney/scene/Scene.hpp"
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <romdisk_dir> [level.json...]"
+                  << std::endl;
+        return 1;
+    }
+
+    udjourney::coreutils::set_assets_base_path(argv[1]);
+    std::vector<fs::path> levels(argv + 2, argv + argc);
+    if (levels.empty()) {
+        const fs::path levels_dir(
+            udjourney::coreutils::get_assets_path("levels"));
+        for (const auto& entry : fs::directory_iterator(levels_dir)) {
+            if (entry.path().extension() == ".json") {
+                levels.push_back(entry.path());
+            }
+        }
+    }
+
+    int written = 0;
+    int failed = 0;
+    for (const auto& level : levels) {
+        // Always from the JSON: a stale .udl must not be recompiled
+        udjourney::scene::Scene scene;
+        if (!scene.load_from_json(level.string())) {
+            std::cerr << "  skipping " << level << ": cannot load scene"
+                      << std::endl;
+            ++failed;
+            continue;
+        }
+
+        const std::string out =
+            udjourney::scene::Scene::compiled_path_for(level.string());
+        if (scene.save_to_binary(out)) {
+            std::cout << "  " << out << ": " << scene.get_platforms().size()
+                      << " platform(s), " << fs::file_size(out) << " bytes"
+                      << std::endl;
+            ++written;
+        } else {
+            ++failed;
+        }
+    }
+
+    std::cout << "Compiled " << written << " level(s)";
+    if (failed > 0) {
+        std::cout << ", " << failed << " failed";
+    }
+    std::cout << std::endl;
+    return failed == 0 ? 0 : 1;
+}
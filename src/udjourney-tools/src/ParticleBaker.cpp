@@ -0,0 +1,202 @@
+// Copyright 2025 Quentin Cartier
+//
+// udj-particle-baker: renders burst particle presets marked "bake": true into
+// sprite-sheet flipbooks that ParticleManager::create_burst plays back as a
+// single quad.
+//
+// Usage: udj-particle-baker <romdisk_dir> [preset_name...]
+//
+// Presets are read from <romdisk_dir>/particles.json and each sheet is written
+// to <romdisk_dir>/<bake_sheet>. The simulation is seeded with bake_seed, so
+// re-baking an unchanged preset produces an identical image.
+
+#include <raylib/raylib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "udjourney/loaders/ParticlePresetLoader.hpp"
+#include "udjourney/particle/Particle.hpp"
+#include "udjourney/particle/ParticleEmitter.hpp"
+#include "udjourney/particle/ParticlePreset.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Simulation sub-steps per flipbook frame (smooths fast particles)
+constexpr int kSubSteps = 4;
+
+void blend_pixel(Image* image, int x, int y, Color color) {
+    if (x < 0 || y < 0 || x >= image->width || y >= image->height) return;
+    Color dst = GetImageColor(*image, x, y);
+    ImageDrawPixel(image, x, y, ColorAlphaBlend(dst, color, WHITE));
+}
+
+void draw_circle(Image* image, Vector2 center, float radius, Color color) {
+    const int min_x = static_cast<int>(std::floor(center.x - radius));
+    const int max_x = static_cast<int>(std::ceil(center.x + radius));
+    const int min_y = static_cast<int>(std::floor(center.y - radius));
+    const int max_y = static_cast<int>(std::ceil(center.y + radius));
+    const float radius_sq = radius * radius;
+
+    for (int y = min_y; y <= max_y; ++y) {
+        for (int x = min_x; x <= max_x; ++x) {
+            const float dx = static_cast<float>(x) + 0.5f - center.x;
+            const float dy = static_cast<float>(y) + 0.5f - center.y;
+            if (dx * dx + dy * dy <= radius_sq) {
+                blend_pixel(image, x, y, color);
+            }
+        }
+    }
+}
+
+// Renders one frame of particles into the sheet cell at (cell_x, cell_y).
+// Rotation is not baked: textured particles are drawn axis-aligned.
+void draw_frame(Image* sheet, const udjourney::ParticlePreset& preset,
+                const std::vector<udjourney::Particle>& particles,
+                const Image& particle_image, float cell_x, float cell_y) {
+    const float half = static_cast<float>(preset.bake_frame_size) / 2.0f;
+
+    for (const auto& particle : particles) {
+        if (!particle.alive) continue;
+
+        const Color color = particle.get_current_color();
+        const float size = particle.get_current_size();
+        const Vector2 center{cell_x + half + particle.position.x,
+                             cell_y + half + particle.position.y};
+
+        if (particle_image.data != nullptr) {
+            Rectangle source =
+                preset.use_atlas
+                    ? particle.texture_rect
+                    : Rectangle{0.0f,
+                                0.0f,
+                                static_cast<float>(particle_image.width),
+                                static_cast<float>(particle_image.height)};
+            Rectangle dest{
+                center.x - size / 2.0f, center.y - size / 2.0f, size, size};
+            ImageDraw(sheet, particle_image, source, dest, color);
+        } else {
+            draw_circle(sheet, center, size / 2.0f, color);
+        }
+    }
+}
+
+bool bake_preset(const udjourney::ParticlePreset& preset,
+                 const fs::path& romdisk_dir) {
+    const int frame_size = std::max(1, preset.bake_frame_size);
+    const int frame_count = std::max(1, preset.bake_frame_count);
+    const int columns = std::max(1, preset.bake_columns);
+    const int rows = (frame_count + columns - 1) / columns;
+    const float fps = preset.bake_fps > 0.0f ? preset.bake_fps : 20.0f;
+    const float step = 1.0f / (fps * static_cast<float>(kSubSteps));
+
+    Image particle_image{};
+    if (!preset.texture_file.empty()) {
+        const fs::path texture_path = romdisk_dir / preset.texture_file;
+        particle_image = LoadImage(texture_path.string().c_str());
+        if (particle_image.data == nullptr) {
+            std::cerr << "  warning: cannot load " << texture_path
+                      << ", baking circles instead" << std::endl;
+        }
+    }
+
+    Image sheet = GenImageColor(columns * frame_size, rows * frame_size, BLANK);
+
+    udjourney::ParticleEmitter emitter(preset, preset.bake_seed);
+    emitter.set_position(Vector2{0.0f, 0.0f});
+    emitter.emit_burst();
+    emitter.set_active(false);
+
+    for (int frame = 0; frame < frame_count; ++frame) {
+        const float cell_x = static_cast<float>((frame % columns) * frame_size);
+        const float cell_y = static_cast<float>((frame / columns) * frame_size);
+        draw_frame(&sheet,
+                   preset,
+                   emitter.get_particles(),
+                   particle_image,
+                   cell_x,
+                   cell_y);
+
+        for (int i = 0; i < kSubSteps; ++i) {
+            emitter.update(step);
+        }
+    }
+
+    if (emitter.get_particle_count() > 0) {
+        std::cerr << "  warning: " << emitter.get_particle_count()
+                  << " particles still alive after the last frame, raise "
+                     "bake_frame_count or lower bake_fps"
+                  << std::endl;
+    }
+
+    const fs::path out_path = romdisk_dir / preset.bake_sheet;
+    fs::create_directories(out_path.parent_path());
+    const bool ok = ExportImage(sheet, out_path.string().c_str());
+
+    UnloadImage(sheet);
+    if (particle_image.data != nullptr) {
+        UnloadImage(particle_image);
+    }
+
+    if (ok) {
+        std::cout << "  " << preset.name << " -> " << out_path.string() << " ("
+                  << frame_count << " frames @ " << fps << " fps)" << std::endl;
+    }
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <romdisk_dir> [preset_name...]"
+                  << std::endl;
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    const fs::path romdisk_dir(argv[1]);
+    std::vector<std::string> requested(argv + 2, argv + argc);
+
+    udjourney::ParticlePresetLoader loader;
+    if (!loader.load_from_path((romdisk_dir / "particles.json").string())) {
+        return 1;
+    }
+
+    int baked = 0;
+    int failed = 0;
+    for (const auto& name : loader.get_preset_names()) {
+        const udjourney::ParticlePreset* preset = loader.get_preset(name);
+        const bool explicitly_requested =
+            std::find(requested.begin(), requested.end(), name) !=
+            requested.end();
+        if (!requested.empty() && !explicitly_requested) continue;
+        if (requested.empty() && !preset->bake) continue;
+
+        if (preset->burst_count <= 0) {
+            std::cerr << "  skipping " << name
+                      << ": only burst presets can be baked" << std::endl;
+            continue;
+        }
+
+        if (bake_preset(*preset, romdisk_dir)) {
+            ++baked;
+        } else {
+            ++failed;
+        }
+    }
+
+    std::cout << "Baked " << baked << " preset(s)";
+    if (failed > 0) {
+        std::cout << ", " << failed << " failed";
+    }
+    std::cout << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+// Copyright 2025 Quentin Cartier
+//
+// udj-preset-bundler: cooks every monster, animation, particle and
+// projectile preset of the romdisk into one binary bundle (presets.udp),
+// so startup reads a single file instead of parsing a JSON per preset.
+//
+// Usage: udj-preset-bundler <romdisk_dir> [output.udp]
+//
+// Reads monsters/*.json, animations/*.json, particles.json and
+// projectiles.json under <romdisk_dir> and writes <romdisk_dir>/presets.udp
+// by default. Each monster's animation_preset is resolved to an index into
+// the bundle; a reference to a missing animation preset is reported and
+// left to the JSON fallback at runtime.
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <udj-core/CoreUtils.hpp>
+
+#include "udjourney/ProjectilePresetLoader.hpp"
+#include "udjourney/loaders/AnimationConfigLoader.hpp"
+#include "udjourney/loaders/MonsterPresetLoader.hpp"
+#include "udjourney/loaders/ParticlePresetLoader.hpp"
+#include "udjourney/loaders/PresetBundle.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Asset-relative paths of the *.json files in dir, sorted for stable output
+std::vector<std::string> list_json(const std::string& dir) {
+    std::vector<std::string> files;
+    const fs::path full_dir(udjourney::coreutils::get_assets_path(dir));
+    std::error_code error;
+    for (const auto& entry : fs::directory_iterator(full_dir, error)) {
+        if (entry.path().extension() == ".json") {
+            files.push_back(dir + "/" + entry.path().filename().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <romdisk_dir> [output.udp]"
+                  << std::endl;
+        return 1;
+    }
+
+    udjourney::coreutils::set_assets_base_path(argv[1]);
+    const std::string output =
+        argc > 2 ? std::string(argv[2])
+                 : udjourney::coreutils::get_assets_path(
+                       udjourney::loaders::PresetBundle::kDefaultPath);
+
+    udjourney::loaders::PresetBundle bundle;
+    int failed = 0;
+
+    for (const auto& path : list_json("animations")) {
+        try {
+            bundle.add_animation(
+                path,
+                udjourney::loaders::AnimationConfigLoader::load_preset(
+                    udjourney::coreutils::get_assets_path(path)));
+        } catch (const std::exception& e) {
+            std::cerr << "  skipping " << path << ": " << e.what()
+                      << std::endl;
+            ++failed;
+        }
+    }
+
+    for (const auto& path : list_json("monsters")) {
+        try {
+            const auto preset = udjourney::MonsterPresetLoader::load_preset(
+                path.substr(std::string("monsters/").size()));
+            if (!bundle.find_animation("animations/" +
+                                       preset->animation_preset_file)) {
+                std::cerr << "  warning: " << path << " uses missing "
+                          << "animation preset "
+                          << preset->animation_preset_file << std::endl;
+            }
+            bundle.add_monster(path, *preset);
+        } catch (const std::exception& e) {
+            std::cerr << "  skipping " << path << ": " << e.what()
+                      << std::endl;
+            ++failed;
+        }
+    }
+
+    // Stored before atlas remapping; the loaders remap at runtime
+    udjourney::ParticlePresetLoader particles;
+    if (particles.load_from_path(
+            udjourney::coreutils::get_assets_path("particles.json"))) {
+        std::vector<udjourney::ParticlePreset> presets;
+        for (const auto& name : particles.get_preset_names()) {
+            presets.push_back(*particles.get_preset(name));
+        }
+        bundle.set_particles("particles.json", std::move(presets));
+    } else {
+        ++failed;
+    }
+
+    udjourney::ProjectilePresetLoader projectiles;
+    if (projectiles.load_from_path(
+            udjourney::coreutils::get_assets_path("projectiles.json"))) {
+        std::vector<udjourney::ProjectilePreset> presets;
+        for (const auto& name : projectiles.get_preset_names()) {
+            presets.push_back(*projectiles.get_preset(name));
+        }
+        bundle.set_projectiles("projectiles.json", std::move(presets));
+    } else {
+        ++failed;
+    }
+
+    if (!bundle.save_to_path(output)) {
+        return 1;
+    }
+    std::cout << "Bundled " << bundle.monster_count() << " monster(s) and "
+              << bundle.animation_count() << " animation preset(s) into "
+              << output;
+    if (failed > 0) {
+        std::cout << ", " << failed << " failed";
+    }
+    std::cout << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+// Copyright 2025 Quentin Cartier
+//
+// udj-scene-manifest: writes the texture closure of each level next to it
+// (levels/foo.json -> levels/foo.assets), so Game::preload_scene_assets_
+// reads the list instead of walking the referenced JSON at load time.
+//
+// Usage: udj-scene-manifest <romdisk_dir> [level.json...]
+//
+// Without level arguments every levels/*.json of the romdisk is processed.
+// Asset references resolve against <romdisk_dir>.
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <udj-core/CoreUtils.hpp>
+
+#include "udjourney/scene/Scene.hpp"
+#include "udjourney/scene/SceneAssetManifest.hpp"
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <romdisk_dir> [level.json...]"
+                  << std::endl;
+        return 1;
+    }
+
+    udjourney::coreutils::set_assets_base_path(argv[1]);
+    std::vector<fs::path> levels(argv + 2, argv + argc);
+    if (levels.empty()) {
+        const fs::path levels_dir(
+            udjourney::coreutils::get_assets_path("levels"));
+        for (const auto& entry : fs::directory_iterator(levels_dir)) {
+            if (entry.path().extension() == ".json") {
+                levels.push_back(entry.path());
+            }
+        }
+    }
+
+    int written = 0;
+    int failed = 0;
+    for (const auto& level : levels) {
+        udjourney::scene::Scene scene;
+        if (!scene.load_from_file(level.string())) {
+            std::cerr << "  skipping " << level << ": cannot load scene"
+                      << std::endl;
+            ++failed;
+            continue;
+        }
+
+        const auto manifest =
+            udjourney::scene::SceneAssetManifest::collect(scene);
+        const std::string out =
+            udjourney::scene::SceneAssetManifest::cache_path_for(
+                level.string());
+        if (manifest.save_to_file(out)) {
+            std::cout << "  " << out << ": "
+                      << manifest.get_textures().size() << " texture(s)"
+                      << std::endl;
+            ++written;
+        } else {
+            ++failed;
+        }
+    }
+
+    std::cout << "Wrote " << written << " manifest(s)";
+    if (failed > 0) {
+        std::cout << ", " << failed << " failed";
+    }
+    std::cout << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+// Copyright 2025 Quentin Cartier
+//
+// udj-texture-cooker: converts the romdisk PNGs into cooked .udt textures
+// (see CookedTexture), written next to each source. TextureManager prefers
+// the .udt when it exists, so the console skips PNG decoding and uploads
+// 16-bit data instead of RGBA8.
+//
+// Usage: udj-texture-cooker <romdisk_dir>
+//
+// Reads <romdisk_dir>/texture_cook.json:
+//   "format":  default format, "auto" or one of the names below
+//   "lz4":     compress payloads (kept raw when that does not help)
+//   "formats": per-texture overrides, asset-relative path -> format name
+//
+// "auto" picks the smallest lossless-enough layout: 4/8-bit indexed when
+// the image has at most 16/256 colors, otherwise 16-bit direct. The 16-bit
+// layout follows the alpha: RGB565 when opaque, RGBA5551 when alpha is only
+// 0 or 255, RGBA4444 otherwise.
+
+#include <raylib/raylib.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "udjourney/managers/CookedTexture.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const std::map<std::string, CookedFormat> kFormatNames = {
+    {"rgba8888", CookedFormat::Rgba8888},
+    {"rgba5551", CookedFormat::Rgba5551},
+    {"rgb565", CookedFormat::Rgb565},
+    {"rgba4444", CookedFormat::Rgba4444},
+    {"indexed4", CookedFormat::Indexed4},
+    {"indexed8", CookedFormat::Indexed8},
+};
+
+struct Choice {
+    CookedFormat format = CookedFormat::Rgba8888;
+    CookedFormat palette_format = CookedFormat::Rgba8888;
+};
+
+Choice choose_auto(const Image& image) {
+    const auto* pixels = static_cast<const Color*>(image.data);
+    const size_t count =
+        static_cast<size_t>(image.width) * static_cast<size_t>(image.height);
+
+    std::unordered_set<uint32_t> colors;
+    bool opaque = true;
+    bool binary_alpha = true;
+    for (size_t i = 0; i < count; ++i) {
+        const Color& c = pixels[i];
+        opaque = opaque && c.a == 255;
+        binary_alpha = binary_alpha && (c.a == 0 || c.a == 255);
+        if (colors.size() <= 256) {
+            colors.insert(static_cast<uint32_t>(c.r) << 24 | c.g << 16 |
+                          c.b << 8 | c.a);
+        }
+    }
+
+    Choice choice;
+    choice.palette_format = opaque         ? CookedFormat::Rgb565
+                            : binary_alpha ? CookedFormat::Rgba5551
+                                           : CookedFormat::Rgba4444;
+    if (colors.size() <= 16) {
+        choice.format = CookedFormat::Indexed4;
+    } else if (colors.size() <= 256) {
+        choice.format = CookedFormat::Indexed8;
+    } else {
+        choice.format = choice.palette_format;
+    }
+    return choice;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <romdisk_dir>" << std::endl;
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    const fs::path romdisk_dir(argv[1]);
+    nlohmann::json config = nlohmann::json::object();
+    std::ifstream config_file(romdisk_dir / "texture_cook.json");
+    if (config_file.is_open()) {
+        try {
+            config_file >> config;
+        } catch (const nlohmann::json::exception& e) {
+            std::cerr << "Cannot parse texture_cook.json: " << e.what()
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    const std::string default_format = config.value("format", "auto");
+    const bool compress = config.value("lz4", true);
+    const auto overrides = config.value("formats", nlohmann::json::object());
+
+    std::vector<fs::path> sources;
+    for (const auto& entry : fs::recursive_directory_iterator(romdisk_dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".png") {
+            sources.push_back(entry.path());
+        }
+    }
+
+    int cooked = 0;
+    int failed = 0;
+    size_t png_bytes = 0;
+    size_t udt_bytes = 0;
+    for (const auto& source : sources) {
+        const std::string relative =
+            fs::relative(source, romdisk_dir).generic_string();
+        const std::string format_name =
+            overrides.value(relative, default_format);
+
+        Image image = LoadImage(source.string().c_str());
+        if (image.data == nullptr) {
+            std::cerr << "  skipping " << relative << ": cannot load"
+                      << std::endl;
+            ++failed;
+            continue;
+        }
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+        Choice choice = choose_auto(image);
+        if (format_name != "auto") {
+            const auto iter = kFormatNames.find(format_name);
+            if (iter == kFormatNames.end()) {
+                std::cerr << "  skipping " << relative << ": unknown format "
+                          << format_name << std::endl;
+                UnloadImage(image);
+                ++failed;
+                continue;
+            }
+            choice.format = iter->second;
+        }
+
+        std::vector<uint8_t> data = CookedTexture::encode(
+            image, choice.format, choice.palette_format, compress);
+        if (data.empty() && choice.format == CookedFormat::Indexed4) {
+            // Forced indexed4 with too many colors: widen before going direct
+            choice.format = CookedFormat::Indexed8;
+            data = CookedTexture::encode(
+                image, choice.format, choice.palette_format, compress);
+        }
+        if (data.empty()) {
+            choice.format = choice.palette_format;
+            data = CookedTexture::encode(
+                image, choice.format, choice.palette_format, compress);
+        }
+        UnloadImage(image);
+
+        const fs::path out_path =
+            CookedTexture::cooked_path_for(source.string());
+        std::ofstream out(out_path, std::ios::binary);
+        if (data.empty() ||
+            !out.write(reinterpret_cast<const char*>(data.data()),
+                       static_cast<std::streamsize>(data.size()))) {
+            std::cerr << "  failed " << relative << std::endl;
+            ++failed;
+            continue;
+        }
+
+        png_bytes += fs::file_size(source);
+        udt_bytes += data.size();
+        std::cout << "  " << out_path.string() << ": format "
+                  << static_cast<int>(choice.format) << ", "
+                  << data.size() / 1024 << " KB" << std::endl;
+        ++cooked;
+    }
+
+    std::cout << "Cooked " << cooked << " texture(s), " << png_bytes / 1024
+              << " KB of PNG -> " << udt_bytes / 1024 << " KB";
+    if (failed > 0) {
+        std::cout << ", " << failed << " failed";
+    }
+    std::cout << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -1,30 +1,35 @@
 // Copyright 2025 Quentin Cartier
 #pragma once
 #include <raylib/raylib.h>
-#include <unordered_map>
-#include <string>
-#include "udjourney/SpriteAnim.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#include "udjourney/AnimationClipLibrary.hpp"
 #include "udjourney/AnimationConfig.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
 
 namespace udjourney {
 
 enum class PlayerState { IDLE, RUNNING, JUMPING, DASHING, FALLING };
 
+/**
+ * @brief One actor's view of a shared ClipSet: current state and cursor
+ *
+ * Cheap to copy; the clips themselves live in AnimationClipLibrary.
+ */
 class AnimSpriteController {
  public:
     AnimSpriteController();
+    explicit AnimSpriteController(
+        std::shared_ptr<const animation::ClipSet> clips);
 
-    // Animation management
-    void add_animation(PlayerState state, const std::string& name,
-                       SpriteAnim animation);
-    void add_animation(int state, const std::string& name,
-                       SpriteAnim animation);
-    void add_animation(int state, const std::string& name, SpriteAnim animation,
-                       const udjourney::animation::CollisionBounds& bounds);
     void set_current_state(PlayerState state);
     void set_current_state(int state);
     void update(float delta_time);
-    void draw(Rectangle dest_rect, bool flip_horizontal = false) const;
+    void draw(Rectangle dest_rect, bool flip_horizontal = false,
+              SpriteBatch* batch = nullptr,
+              uint8_t layer = SpriteBatch::layer(RenderLayer::Actors)) const;
 
     // State queries
     PlayerState get_current_state() const { return current_state_; }
@@ -40,19 +45,16 @@ class AnimSpriteController {
     bool is_facing_right() const { return facing_right_; }
 
  private:
+    // Clip the cursor plays, or nullptr if the state has none
+    const animation::AnimationClip* current_clip_() const;
+    void restart_();
+
+    std::shared_ptr<const animation::ClipSet> clips_;
+    animation::PlaybackCursor cursor_;
     PlayerState current_state_ = PlayerState::IDLE;
-    PlayerState previous_state_ = PlayerState::IDLE;
     int current_state_int_ = 0;  // For non-PlayerState animations
-    int previous_state_int_ = 0;
-    std::unordered_map<PlayerState, SpriteAnim> animations_;
-    std::unordered_map<int, SpriteAnim>
-        animations_int_;  // For generic state support
-    std::unordered_map<int, animation::CollisionBounds>
-        collision_bounds_;  // Collision bounds per state
     bool facing_right_ = true;
     bool using_player_state_ = true;  // Track which state system we're using
-
-    void on_state_change(PlayerState old_state, PlayerState new_state);
 };
 
 }  // namespace udjourney
@@ -0,0 +1,113 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "udjourney/AnimationConfig.hpp"
+#include "udjourney/managers/TextureHandle.hpp"
+
+namespace udjourney {
+namespace animation {
+
+/**
+ * @brief Frames, timing and collision bounds of one animation state
+ *
+ * Immutable once built and shared by every actor playing it. Frames run
+ * left to right from first_frame, as laid out in the sheet.
+ */
+struct AnimationClip {
+    int state_id = 0;
+    Texture2D texture{};      // Sheet, or the atlas page that holds it
+    Rectangle first_frame{};  // Texture-space source rect of frame 0
+    int frame_count = 0;
+    float frame_time = 0.1f;
+    bool loop = true;
+    CollisionBounds collision_bounds;
+
+    [[nodiscard]] Rectangle frame_rect(int frame) const noexcept {
+        return Rectangle{first_frame.x + frame * first_frame.width,
+                         first_frame.y,
+                         first_frame.width,
+                         first_frame.height};
+    }
+};
+
+/**
+ * @brief Every clip of one animation preset
+ *
+ * Owns one TextureManager reference per clip sheet, released when the last
+ * holder drops the set.
+ */
+struct ClipSet {
+    std::vector<AnimationClip> clips;  // In preset order
+    bool player_states = false;  // All state ids are PlayerState values
+    std::vector<TextureHandle> textures;  // Acquired sheets, one per clip
+
+    ClipSet() = default;
+    ClipSet(const ClipSet&) = delete;
+    ClipSet& operator=(const ClipSet&) = delete;
+    ~ClipSet();
+
+    // Index of the clip for state_id, or -1
+    [[nodiscard]] int find(int state_id) const noexcept;
+};
+
+/**
+ * @brief Per-actor playback position: all an actor owns of its animation
+ */
+struct PlaybackCursor {
+    int clip = -1;  // Index into the ClipSet, -1 if the state has no clip
+    int frame = 0;
+    float elapsed = 0.0f;
+    bool finished = false;
+
+    void reset(int clip_index) noexcept { *this = PlaybackCursor{clip_index}; }
+};
+
+/**
+ * @brief Step cursor by delta_time through clip
+ *
+ * Non-looping clips stop on their last frame and report finished.
+ */
+void advance(const AnimationClip& clip, PlaybackCursor* cursor,
+             float delta_time) noexcept;
+
+/**
+ * @brief Clip sets keyed by animation preset path, built once per preset
+ *
+ * Every actor created from the same preset shares one ClipSet and keeps
+ * only a PlaybackCursor, so spawning a monster copies no frame data and
+ * acquires no texture. Sheets are acquired from TextureManager when a set
+ * is built and stay resident while the set is alive: after clear(), they
+ * are released by the last actor holding the set.
+ */
+class AnimationClipLibrary {
+ public:
+    static AnimationClipLibrary& get_instance();
+
+    // Set registered under path, or nullptr if it was never added
+    [[nodiscard]] std::shared_ptr<const ClipSet> find(
+        const std::string& path) const;
+
+    // Build the set of config and register it under path
+    std::shared_ptr<const ClipSet> add(const std::string& path,
+                                       const AnimationPresetConfig& config);
+
+    // Build a set without registering it
+    static std::shared_ptr<const ClipSet> build(
+        const AnimationPresetConfig& config);
+
+    // Forget every set; actors keep the sets they hold
+    void clear() { sets_.clear(); }
+
+ private:
+    std::unordered_map<std::string, std::shared_ptr<const ClipSet>> sets_;
+};
+
+}  // namespace animation
+}  // namespace udjourney
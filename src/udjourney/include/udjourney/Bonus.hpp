@@ -21,7 +21,7 @@ class Bonus : public IActor {
         return CheckCollisionRecs(m_rect, other.get_rectangle());
     }
     [[nodiscard]] inline constexpr uint8_t get_group_id() const override {
-        return 2;
+        return BONUS_TYPE_ID;
     }
 
  private:
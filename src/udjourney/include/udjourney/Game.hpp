@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "udjourney/InputLatency.hpp"
 #include "udjourney/ScoreHistory.hpp"
 #include "udjourney/core/events/EventDispatcher.hpp"
 #include "udjourney/interfaces/IActor.hpp"
@@ -24,7 +25,10 @@
 #include "udjourney/managers/MenuManager.hpp"
 #include "udjourney/managers/ParticleManager.hpp"
 #include "udjourney/render/IStateRenderer.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
+#include "udjourney/render/StaticChunkCache.hpp"
 #include "udjourney/scene/Scene.hpp"
+#include "udjourney/scene/TileOccupancyGrid.hpp"
 #include "udjourney/Player.hpp"
 #include "udjourney/WorldBounds.hpp"
 #include "udjourney/hud/scene/IHUD.hpp"
@@ -78,7 +82,20 @@ class Game : public IGame, public IObserver {
     void draw_huds() const { draw_huds_(); }
     void draw_particles() const {
         Rectangle rect = get_rectangle();
-        m_particle_manager.draw(Vector2{rect.x, rect.y});
+        m_particle_manager.draw(Vector2{rect.x, rect.y}, &m_sprite_batch);
+    }
+    void draw_static_chunks() const { m_static_chunks.draw(m_rect); }
+
+    // Last gameplay frame, captured when the game pauses (nullptr if none)
+    const RenderTexture2D *get_frozen_frame() const {
+        return m_frozen_frame_valid ? &m_frozen_frame : nullptr;
+    }
+    // Recapture the frozen frame on next draw (world changed while paused)
+    void invalidate_frozen_frame() noexcept { m_frozen_frame_valid = false; }
+
+    // Rebake static platform chunks after editing platforms in world_rect
+    void mark_static_geometry_dirty(Rectangle world_rect) const override {
+        m_static_chunks.mark_dirty(world_rect);
     }
 
     // Scene management
@@ -101,6 +118,9 @@ class Game : public IGame, public IObserver {
         return m_particle_manager;
     }
 
+    // Sprite batch shared by actors, particles and backgrounds
+    SpriteBatch *get_sprite_batch() const override { return &m_sprite_batch; }
+
  private:
     void register_core_event_handlers_();
 
@@ -111,16 +131,25 @@ class Game : public IGame, public IObserver {
     void on_level_select_cancelled();
 
     void clear_scene();
+    void preload_scene_assets_();
+    void draw_preload_progress_(size_t done, size_t total) const;
 
     // Game menu helper methods
     void show_game_menu();
     void hide_game_menu();
 
     void draw() const;
+    void draw_logical_frame_() const;
+    void present_offscreen_() const;
+    void capture_frozen_frame_() const;
+    bool ui_screen_is_idle_();
+    void set_offscreen_scale_(int scale);
     void draw_backgrounds_() const;
     void draw_finish_line_() const;
+    void prepare_huds_() const;
     void draw_huds_() const;
     bool should_continue_scrolling_() const noexcept;
+    void remove_static_platform_cells_(const Rectangle &world_rect);
     void attack_nearby_monsters();
 
     // Widget and scene management
@@ -152,6 +181,33 @@ class Game : public IGame, public IObserver {
     HUDManager m_hud_manager;
     BackgroundManager m_background_manager;
     ParticleManager m_particle_manager;
+    mutable SpriteBatch m_sprite_batch;  // Recorded by the state renderers
+    bool m_show_render_stats = false;    // F3: sprite batch counters
+    // Input poll to frame present, shown with the F3 counters
+    mutable InputLatency m_input_latency;
+    // When raylib last polled input: end of EndDrawing or an idle UI poll
+    mutable double m_last_input_poll_time = 0.0;
+    // Offscreen rendering: 0 draws straight to the window, 1 or 2 renders
+    // the 640x480 frame at that multiple and blits it once (F4, UDJ_OFFSCREEN)
+    int m_offscreen_scale = 0;
+    mutable RenderTexture2D m_offscreen_target{};
+    // Gameplay frame shown under the pause/menu overlays
+    mutable RenderTexture2D m_frozen_frame{};
+    mutable bool m_frozen_frame_valid = false;
+    // Idle UI screens keep the last presented frame until one of these
+    // changes (or a widget, the background or particles animate)
+    struct UiFrameKey {
+        GameState state = GameState::TITLE;
+        const void *scene = nullptr;
+        int selected_widget = -1;
+        int screen_width = 0;
+        int screen_height = 0;
+        int offscreen_scale = 0;
+        bool render_stats = false;
+        bool operator==(const UiFrameKey &) const = default;
+    };
+    UiFrameKey m_last_ui_frame;
+    double m_last_ui_draw_time = 0.0;
     udjourney::core::events::EventDispatcher m_event_dispatcher;
     std::unique_ptr<udjourney::scene::Scene> m_current_scene;
     float m_level_height = 0.0f;  // Track level height for win condition
@@ -161,6 +217,9 @@ class Game : public IGame, public IObserver {
     udjourney::managers::MenuManager m_menu_manager{
         *this};                             // Game menu manager
     udjourney::WorldBounds m_world_bounds;  // World boundary management
+    udjourney::scene::TileOccupancyGrid
+        m_static_tile_grid;  // Static platforms, for particle collision
+    mutable StaticChunkCache m_static_chunks;  // Baked static platforms
     mutable std::map<std::string, Texture2D>
         m_hud_textures;               // Cache for HUD textures
     int m_selected_widget_index = 0;  // Currently focused widget
@@ -0,0 +1,54 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace udjourney {
+
+/**
+ * @brief Input-to-present latency of the last few input edges.
+ *
+ * mark_input() takes the time the press was polled; the next mark_present()
+ * (after the swap returns) turns it into a sample. Presses arriving before
+ * that frame is presented are folded into the oldest pending one, so each
+ * sample is the worst case of its frame. Time spent in the OS and display
+ * before the poll and after the swap is not visible here.
+ * Timestamps are passed in (seconds), which keeps the tracker testable
+ * without a window.
+ */
+class InputLatency {
+ public:
+    static constexpr size_t kSampleCount = 120;  // About 2 s of presses
+
+    /**
+     * @brief Record an input edge delivered by the event poll at now
+     */
+    void mark_input(double now) noexcept;
+
+    /**
+     * @brief Close the pending input edge, if any, with a frame presented now
+     */
+    void mark_present(double now) noexcept;
+
+    /**
+     * @brief Latency in ms at percentile (0-100) of the recorded samples
+     */
+    [[nodiscard]] float get_percentile_ms(float percentile) const;
+
+    [[nodiscard]] float get_last_ms() const noexcept { return m_last_ms; }
+    [[nodiscard]] size_t get_sample_count() const noexcept { return m_count; }
+    [[nodiscard]] bool has_pending() const noexcept { return m_pending; }
+
+    void reset() noexcept;
+
+ private:
+    std::array<float, kSampleCount> m_samples_ms{};  // Ring buffer
+    size_t m_next = 0;
+    size_t m_count = 0;
+    float m_last_ms = 0.0f;
+    double m_pending_since = 0.0;
+    bool m_pending = false;
+};
+
+}  // namespace udjourney
@@ -13,7 +13,6 @@
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/interfaces/IObservable.hpp"
 #include "udjourney/MonsterPreset.hpp"
-#include "udjourney/loaders/MonsterPresetLoader.hpp"
 #include "udjourney/scene/LevelPhysicsConfig.hpp"
 
 // Forward declarations
@@ -44,8 +43,7 @@ class Monster : public IActor, public IObservable {
     }
 
     [[nodiscard]] inline constexpr uint8_t get_group_id() const override {
-        return 3;  // Monster group ID (3 to avoid conflict with Bonus which is
-                   // 2)
+        return MONSTER_TYPE_ID;
     }
 
     // Monster-specific methods
@@ -104,7 +102,7 @@ class Monster : public IActor, public IObservable {
     udjourney::core::events::EventDispatcher &dispatcher_;
 
     // Preset system
-    std::unique_ptr<udjourney::MonsterPreset> preset_;
+    std::shared_ptr<const udjourney::MonsterPreset> preset_;  // Shared
     std::string preset_name_;
 
     // State pattern - using IActorState
@@ -56,7 +56,7 @@ class Player : public IActor, public IObservable {
     void notify(const std::string &iEvent) override;
 
     [[nodiscard]] inline constexpr uint8_t get_group_id() const override {
-        return 0;
+        return PLAYER_TYPE_ID;
     }
 
     void set_invicibility(float iDuration) noexcept {
@@ -99,7 +99,6 @@ class Player : public IActor, public IObservable {
     std::vector<IObserver *> observers;
     struct PImpl;
     std::unique_ptr<struct PImpl> m_pimpl;
-    Texture2D m_texture = {};
     AnimSpriteController anim_controller_;
     udjourney::core::events::EventDispatcher &m_dispatcher;
 
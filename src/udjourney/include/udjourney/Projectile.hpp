@@ -9,6 +9,7 @@
 #include "raylib/raymath.h"
 
 #include "udjourney/interfaces/IActor.hpp"
+#include "udjourney/managers/TextureHandle.hpp"
 
 namespace udjourney {
 
@@ -66,7 +67,7 @@ class Projectile : public IActor {
         return CheckCollisionRecs(get_rectangle(), other.get_rectangle());
     }
     [[nodiscard]] constexpr uint8_t get_group_id() const override {
-        return 5;  // Projectile group
+        return PROJECTILE_TYPE_ID;
     }
 
     bool is_alive() const { return alive_; }
@@ -82,7 +83,8 @@ class Projectile : public IActor {
     float elapsed_time_ = 0.0f;
     float distance_traveled_ = 0.0f;
     bool alive_ = true;
-    Texture2D texture_{0};
+    Texture2D texture_{0};  // Acquired from TextureManager
+    TextureHandle texture_handle_;
     bool texture_loaded_ = false;
 };
 
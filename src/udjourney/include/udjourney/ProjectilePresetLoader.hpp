@@ -21,6 +21,17 @@ class ProjectilePresetLoader {
      */
     bool load_from_file(const std::string& filepath);
 
+    /**
+     * @brief Load projectile presets from an already resolved path
+     *
+     * Unlike load_from_file, the path is not prefixed with the assets
+     * directory and sheets are not remapped to their atlas (used by
+     * offline tools working on the romdisk tree).
+     * @param full_path Filesystem path to the JSON file
+     * @return true if loading succeeded, false otherwise
+     */
+    bool load_from_path(const std::string& full_path);
+
     /**
      * @brief Get a projectile preset by name
      * @param name Name of the preset to retrieve
@@ -26,7 +26,7 @@ class DialogBoxHUD : public HUDComponent {
         }
     }
 
-    void draw() const override;
+    void draw(udjourney::SpriteBatch* batch) const override;
 
     [[nodiscard]] std::string get_type() const override {
         return "DialogBoxHUD";
@@ -25,7 +25,7 @@ class GameMenuHUD : public HUDComponent {
                 const std::string& title = "GAME MENU");
     ~GameMenuHUD() override = default;
 
-    void draw() const override;
+    void draw(SpriteBatch* batch) const override;
     void update(float delta) override;
     void handle_input() override;
     [[nodiscard]] std::string get_type() const override {
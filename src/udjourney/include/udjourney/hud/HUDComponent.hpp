@@ -2,6 +2,10 @@
 #pragma once
 #include <string>
 
+namespace udjourney {
+class SpriteBatch;
+}  // namespace udjourney
+
 class HUDComponent {
  public:
     [[nodiscard]] virtual std::string get_type() const = 0;
@@ -9,7 +13,8 @@ class HUDComponent {
     [[nodiscard]] inline bool is_focusable() const noexcept {
         return m_is_focusable;
     }
-    virtual void draw() const = 0;
+    // Text goes to batch, which the HUD manager records around each HUD
+    virtual void draw(udjourney::SpriteBatch* batch) const = 0;
     virtual void handle_input() {}
     virtual ~HUDComponent() = default;
 
@@ -14,7 +14,7 @@ class LevelSelectHUD : public HUDComponent {
     ~LevelSelectHUD() override = default;
 
     void update(float deltaTime) override;
-    void draw() const override;
+    void draw(udjourney::SpriteBatch* batch) const override;
     void handle_input() override;
     [[nodiscard]] std::string get_type() const override {
         return "LevelSelectHUD";
@@ -27,7 +27,7 @@ class LevelSelectHUD : public HUDComponent {
 
  private:
     void scan_levels_directory();
-    void draw_menu() const;
+    void draw_menu(udjourney::SpriteBatch* batch) const;
 
     Rectangle m_rect;
     std::string m_levels_dir;
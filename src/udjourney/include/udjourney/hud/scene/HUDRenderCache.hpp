@@ -0,0 +1,81 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <cstdint>
+#include <functional>
+
+namespace udjourney {
+namespace hud {
+namespace scene {
+
+/**
+ * @brief Render texture holding the last drawn contents of a scene HUD.
+ *
+ * A HUD re-renders into the cache only when its bound value, its bounds or
+ * the render scale change; in between, drawing it is a single textured quad.
+ * The bound value is summarized by a caller-chosen contents key (the score,
+ * packed health, a weapon change counter...).
+ *
+ * update() uses render texture mode, so it must run outside
+ * BeginDrawing()/EndDrawing() (see IHUD::prepare).
+ *
+ * Not available on Dreamcast (no render textures): update() fails and the
+ * HUD keeps drawing its contents directly.
+ */
+class HUDRenderCache {
+ public:
+    HUDRenderCache() = default;
+    virtual ~HUDRenderCache();
+    HUDRenderCache(const HUDRenderCache&) = delete;
+    HUDRenderCache& operator=(const HUDRenderCache&) = delete;
+
+    /**
+     * @brief True when the cache holds contents for this key, bounds and
+     * scale
+     */
+    [[nodiscard]] bool is_current(Rectangle bounds, float scale,
+                                  uint64_t contents) const;
+
+    /**
+     * @brief Re-render contents drawn in logical coordinates inside bounds
+     * @param scale Logical-to-window scale; the texture matches window pixels
+     * @return false if no render texture could be used
+     */
+    bool update(Rectangle bounds, float scale, uint64_t contents,
+                const std::function<void()>& draw_contents);
+
+    /**
+     * @brief Draw the cached contents at their logical bounds
+     * @return false (and draws nothing) if the cache is empty or holds
+     *         other contents: the HUD then draws directly
+     */
+    bool draw(uint64_t contents) const;
+
+    void invalidate() noexcept { m_valid = false; }
+
+    /**
+     * @brief Window-pixel size of the texture caching bounds at scale
+     */
+    [[nodiscard]] static Vector2 texture_size(Rectangle bounds, float scale);
+
+ protected:
+    // Render draw_contents into a size texture; false if unavailable
+    virtual bool render_(Vector2 size, Rectangle bounds, float scale,
+                         const std::function<void()>& draw_contents);
+    // Draw the cached texture over dest (logical coordinates)
+    virtual void blit_(Rectangle dest) const;
+
+ private:
+    RenderTexture2D m_target{};
+    Rectangle m_bounds{};
+    Vector2 m_size{};
+    float m_scale = 0.0f;
+    uint64_t m_contents = 0;
+    bool m_valid = false;
+};
+
+}  // namespace scene
+}  // namespace hud
+}  // namespace udjourney
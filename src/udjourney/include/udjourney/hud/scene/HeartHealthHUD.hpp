@@ -4,8 +4,8 @@
 
 #include <raylib/raylib.h>
 #include <string>
-#include <unordered_map>
 #include "udjourney/scene/Scene.hpp"
+#include "udjourney/hud/scene/HUDRenderCache.hpp"
 #include "udjourney/hud/scene/IHUD.hpp"
 
 namespace udjourney::core::events {
@@ -22,15 +22,16 @@ class HeartHealthHUD : public IHUD {
                    udjourney::core::events::EventDispatcher& event_dispatcher);
     ~HeartHealthHUD() override = default;
 
-    void draw() const override;
+    void draw(SpriteBatch* batch) const override;
+    void prepare(float scale) const override;
     bool is_visible() const override { return m_visible; }
     void set_visible(bool visible) override { m_visible = visible; }
 
  private:
     Vector2 calculate_position() const;
-    Texture2D get_texture(const std::string& path) const;
-    void draw_heart(Vector2 pos, int heart_index,
-                    int current_half_hearts) const;
+    Rectangle calculate_bounds() const;
+    int get_max_hearts() const;
+    void draw_contents() const;
 
     const udjourney::scene::HUDData& m_hud_data;
     bool m_visible;
@@ -38,8 +39,9 @@ class HeartHealthHUD : public IHUD {
     int m_current_half_hearts = -1;
     int m_max_half_hearts = -1;
 
-    // Shared texture cache
-    static std::unordered_map<std::string, Texture2D> s_texture_cache;
+    // Rendered once per health change (HealthChangedEvent)
+    mutable HUDRenderCache m_cache;
+    mutable Rectangle m_cached_bounds{};
 };
 
 }  // namespace scene
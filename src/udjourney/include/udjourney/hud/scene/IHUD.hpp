@@ -3,6 +3,8 @@
 #define UDJOURNEY_HUD_SCENE_IHUD_HPP
 
 namespace udjourney {
+class SpriteBatch;
+
 namespace hud {
 namespace scene {
 
@@ -10,7 +12,11 @@ namespace scene {
 class IHUD {
  public:
     virtual ~IHUD() = default;
-    virtual void draw() const = 0;
+    // Text goes to batch, recorded by the game around each HUD
+    virtual void draw(SpriteBatch* batch) const = 0;
+    // Refresh cached rendering before the frame starts (outside
+    // BeginDrawing); scale is the logical-to-window scale of the frame
+    virtual void prepare(float /*scale*/) const {}
     virtual bool is_visible() const = 0;
     virtual void set_visible(bool visible) = 0;
 };
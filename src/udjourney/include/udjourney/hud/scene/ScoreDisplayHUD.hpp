@@ -4,6 +4,7 @@
 
 #include <raylib/raylib.h>
 #include "udjourney/scene/Scene.hpp"
+#include "udjourney/hud/scene/HUDRenderCache.hpp"
 #include "udjourney/hud/scene/IHUD.hpp"
 
 namespace udjourney {
@@ -20,16 +21,23 @@ class ScoreDisplayHUD : public IHUD {
                     udjourney::Game* game);
     ~ScoreDisplayHUD() override = default;
 
-    void draw() const override;
+    void draw(SpriteBatch* batch) const override;
+    void prepare(float scale) const override;
     bool is_visible() const override { return m_visible; }
     void set_visible(bool visible) override { m_visible = visible; }
 
  private:
     Vector2 calculate_position() const;
+    Rectangle calculate_bounds(const char* score_text) const;
+    void draw_contents(int score, SpriteBatch* batch) const;
 
     const udjourney::scene::HUDData& m_hud_data;
     udjourney::Game* m_game;
     bool m_visible;
+
+    // Rendered once per score change (the score is the contents key)
+    mutable HUDRenderCache m_cache;
+    mutable Rectangle m_cached_bounds{};
 };
 
 }  // namespace scene
@@ -3,10 +3,11 @@
 
 #include <raylib/raylib.h>
 
-#include <map>
+#include <cstdint>
 #include <memory>
 #include <string>
 
+#include "udjourney/hud/scene/HUDRenderCache.hpp"
 #include "udjourney/hud/scene/IHUD.hpp"
 #include "udjourney/scene/Scene.hpp"
 
@@ -29,7 +30,8 @@ class WeaponHUD : public IHUD {
               udjourney::core::events::EventDispatcher& event_dispatcher);
     ~WeaponHUD() override;
 
-    void draw() const override;
+    void draw(SpriteBatch* batch) const override;
+    void prepare(float scale) const override;
     bool is_visible() const override { return m_visible; }
     void set_visible(bool visible) override { m_visible = visible; }
 
@@ -38,8 +40,9 @@ class WeaponHUD : public IHUD {
 
  private:
     void set_weapon_name(const std::string& weapon_name);
-    Texture2D load_texture_cached(const std::string& texture_path);
     Vector2 calculate_position() const;
+    Rectangle calculate_bounds() const;
+    void draw_contents(SpriteBatch* batch) const;
 
     const udjourney::scene::HUDData& m_hud_data;
     bool m_visible;
@@ -47,7 +50,12 @@ class WeaponHUD : public IHUD {
 
     // Projectile preset system for weapon preview
     std::unique_ptr<udjourney::ProjectilePresetLoader> m_projectile_loader;
-    mutable std::map<std::string, Texture2D> m_texture_cache;
+
+    // Rendered once per weapon change (WeaponSelectedEvent), keyed by
+    // m_weapon_version
+    mutable HUDRenderCache m_render_cache;
+    mutable Rectangle m_cached_bounds{};
+    uint64_t m_weapon_version = 0;
 };
 
 }  // namespace scene
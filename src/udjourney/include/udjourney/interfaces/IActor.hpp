@@ -2,6 +2,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -14,6 +15,14 @@ namespace udjourney {
 // Forward declarations
 class IGame;
 
+// Actor groups, as returned by IActor::get_group_id()
+inline constexpr uint8_t PLAYER_TYPE_ID = 0;
+inline constexpr uint8_t PLATFORM_TYPE_ID = 1;
+inline constexpr uint8_t BONUS_TYPE_ID = 2;
+inline constexpr uint8_t MONSTER_TYPE_ID = 3;
+inline constexpr uint8_t WIDGET_TYPE_ID = 4;
+inline constexpr uint8_t PROJECTILE_TYPE_ID = 5;
+
 enum class ActorState {
     ONGOING,
     CONSUMED  // Need to be removed from the game
@@ -12,6 +12,7 @@ class IActor;
 class Player;
 class WorldBounds;
 class ParticleManager;
+class SpriteBatch;
 
 class IGame {
  public:
@@ -28,5 +29,14 @@ class IGame {
 
     // Particle system access
     [[nodiscard]] virtual ParticleManager& get_particle_manager() = 0;
+
+    // Deferred sprite renderer, or nullptr to draw immediately
+    [[nodiscard]] virtual SpriteBatch* get_sprite_batch() const {
+        return nullptr;
+    }
+
+    // A baked static platform inside world_rect changed or went away: its
+    // cached chunks must be rebaked
+    virtual void mark_static_geometry_dirty(Rectangle /*world_rect*/) const {}
 };
 }  // namespace udjourney
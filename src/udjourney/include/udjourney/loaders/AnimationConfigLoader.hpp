@@ -26,6 +26,8 @@ class AnimationConfigLoader {
 
     /**
      * Create an AnimSpriteController from a preset configuration
+     * (its clips are built for this controller alone and release their
+     * sheets when it is destroyed)
      * @param config The animation preset configuration
      * @return Configured AnimSpriteController ready to use
      */
@@ -34,7 +36,8 @@ class AnimationConfigLoader {
 
     /**
      * Convenience method: Load preset from file and create controller in one
-     * call
+     * call. The file is read once; later calls share its clips through
+     * AnimationClipLibrary.
      * @param filename Path to the JSON configuration file
      * @return Configured AnimSpriteController ready to use
      */
@@ -0,0 +1,46 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "udjourney/MonsterPreset.hpp"
+
+namespace udjourney {
+
+/**
+ * @brief Process-wide cache of monster presets, shared by every spawn
+ *
+ * Each preset is loaded once (from the preset bundle or its JSON) on first
+ * use and handed out as an immutable shared pointer, so any number of
+ * monsters of one kind share a single MonsterPreset. Failed loads are
+ * remembered too, so a bad preset is reported once instead of per spawn.
+ *
+ * Nothing is reloaded implicitly: call invalidate() or clear() after
+ * editing a preset. Monsters already spawned keep the preset they were
+ * given; later spawns load the new one.
+ */
+class MonsterPresetRegistry {
+ public:
+    static MonsterPresetRegistry& get_instance();
+
+    /**
+     * @brief Preset of monsters/<preset_name>.json, loaded on first use
+     * @return nullptr if the preset cannot be loaded
+     */
+    std::shared_ptr<const MonsterPreset> get(const std::string& preset_name);
+
+    // Drop one cached preset (hot reload); the next get() loads it again
+    void invalidate(const std::string& preset_name);
+    void clear();
+
+    [[nodiscard]] size_t size() const { return presets_.size(); }
+
+ private:
+    // A null entry marks a preset that failed to load
+    std::unordered_map<std::string, std::shared_ptr<const MonsterPreset>>
+        presets_;
+};
+
+}  // namespace udjourney
@@ -1,6 +1,7 @@
 // Copyright 2025 Quentin Cartier
 #pragma once
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -21,6 +22,16 @@ class ParticlePresetLoader {
      */
     bool load_from_file(const std::string& filepath);
 
+    /**
+     * @brief Load particle presets from an already resolved path
+     *
+     * Unlike load_from_file, the path is not prefixed with the assets
+     * directory (used by offline tools working on the romdisk tree).
+     * @param full_path Filesystem path to the JSON file
+     * @return true if loading succeeded, false otherwise
+     */
+    bool load_from_path(const std::string& full_path);
+
     /**
      * @brief Get a particle preset by name
      * @param name Name of the preset to retrieve
@@ -41,6 +52,12 @@ class ParticlePresetLoader {
      */
     std::vector<std::string> get_preset_names() const;
 
+    /**
+     * @brief Visit every loaded preset, e.g. to resolve runtime handles
+     * @param visitor Called once per preset, in name order
+     */
+    void for_each_preset(const std::function<void(ParticlePreset&)>& visitor);
+
  private:
     std::map<std::string, ParticlePreset> presets_;
 };
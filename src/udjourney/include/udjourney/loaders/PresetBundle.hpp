@@ -0,0 +1,113 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "udjourney/AnimationConfig.hpp"
+#include "udjourney/MonsterPreset.hpp"
+#include "udjourney/Projectile.hpp"
+#include "udjourney/particle/ParticlePreset.hpp"
+
+namespace udjourney {
+namespace loaders {
+
+/**
+ * @brief Every monster, animation, particle and projectile preset in one
+ * cooked file (presets.udp), written by udj-preset-bundler.
+ *
+ * Loaded with a single read and checked against a checksum; strings are
+ * interned and each monster's animation preset is resolved to an index at
+ * cook time. The JSON loaders look here first and only open their files
+ * for presets the bundle does not hold, so a romdisk without a bundle
+ * works unchanged.
+ *
+ * Entries are keyed by asset-relative path ("monsters/goblin.json",
+ * "animations/player_animations.json", "particles.json", ...). Projectile
+ * and particle presets are stored before atlas remapping; their loaders
+ * still remap at load time.
+ */
+class PresetBundle {
+ public:
+    static constexpr const char* kDefaultPath = "presets.udp";
+
+    static PresetBundle& get_instance();
+
+    /**
+     * @brief Load a bundle from an already resolved path
+     *
+     * On the host a bundle older than any of its source files is ignored,
+     * so edited JSON is picked up without re-cooking.
+     * @return False (and the bundle left empty) if missing, stale or
+     *         corrupted
+     */
+    bool load_from_path(const std::string& full_path);
+    bool save_to_path(const std::string& full_path) const;
+    void clear();
+
+    [[nodiscard]] bool empty() const noexcept {
+        return monsters_.empty() && animations_.empty() &&
+               particle_file_.empty() && projectile_file_.empty();
+    }
+
+    // Lookups return nullptr when the bundle does not hold the file
+    [[nodiscard]] const MonsterPreset* find_monster(
+        const std::string& asset_path) const;
+    [[nodiscard]] const animation::AnimationPresetConfig* find_animation(
+        const std::string& asset_path) const;
+    // The monster's animation_preset_file, resolved at cook time
+    [[nodiscard]] const animation::AnimationPresetConfig*
+    find_monster_animation(const std::string& monster_asset_path) const;
+    [[nodiscard]] const std::vector<ParticlePreset>* find_particles(
+        const std::string& asset_path) const;
+    [[nodiscard]] const std::vector<ProjectilePreset>* find_projectiles(
+        const std::string& asset_path) const;
+
+    // Cook-time construction
+    void add_monster(const std::string& asset_path,
+                     const MonsterPreset& preset);
+    void add_animation(const std::string& asset_path,
+                       const animation::AnimationPresetConfig& config);
+    void set_particles(const std::string& asset_path,
+                       std::vector<ParticlePreset> presets);
+    void set_projectiles(const std::string& asset_path,
+                         std::vector<ProjectilePreset> presets);
+
+    [[nodiscard]] size_t monster_count() const { return monsters_.size(); }
+    [[nodiscard]] size_t animation_count() const {
+        return animations_.size();
+    }
+
+ private:
+    struct MonsterEntry {
+        std::string asset_path;
+        MonsterPreset preset;
+        uint32_t animation;  // Index into animations_, or kNoAnimation
+    };
+    struct AnimationEntry {
+        std::string asset_path;
+        animation::AnimationPresetConfig config;
+    };
+
+    static constexpr uint32_t kNoAnimation = UINT32_MAX;
+
+    // animations/<animation_preset_file>, or kNoAnimation
+    [[nodiscard]] uint32_t resolve_animation_(
+        const MonsterPreset& preset) const;
+    [[nodiscard]] std::vector<std::string> sources_() const;
+
+    std::vector<MonsterEntry> monsters_;
+    std::vector<AnimationEntry> animations_;
+    std::unordered_map<std::string, size_t> monster_index_;
+    std::unordered_map<std::string, size_t> animation_index_;
+
+    std::string particle_file_;
+    std::vector<ParticlePreset> particles_;
+    std::string projectile_file_;
+    std::vector<ProjectilePreset> projectiles_;
+};
+
+}  // namespace loaders
+}  // namespace udjourney
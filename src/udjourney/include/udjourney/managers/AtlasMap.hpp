@@ -0,0 +1,37 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include "raylib/raylib.h"
+
+/**
+ * @brief Where a packed sheet sits inside a cooked atlas
+ */
+struct AtlasEntry {
+    std::string atlas;  // Asset-relative path of the atlas page
+    Rectangle rect{};   // Sheet bounds in the page, padding excluded
+};
+
+/**
+ * @brief Sheet -> atlas remap table written by udj-atlas-packer.
+ *
+ * Stored as atlases/atlas_map.json. Sheets missing from the table are
+ * loaded from their own file, so a romdisk without cooked atlases works
+ * unchanged.
+ */
+class AtlasMap {
+ public:
+    bool load_from_file(const std::string& filename);
+    bool save_to_file(const std::string& filename) const;
+
+    void add(const std::string& sheet, const AtlasEntry& entry);
+    [[nodiscard]] const AtlasEntry* find(const std::string& sheet) const;
+    [[nodiscard]] size_t size() const noexcept { return entries.size(); }
+    void clear() { entries.clear(); }
+
+ private:
+    std::unordered_map<std::string, AtlasEntry> entries;
+};
@@ -3,19 +3,36 @@
 
 #include <raylib/raylib.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "udjourney/managers/TextureHandle.hpp"
+
 namespace udjourney::scene {
 class Scene;
 struct BackgroundLayerData;
+struct BackgroundObjectData;
 }  // namespace udjourney::scene
 
 namespace udjourney {
 
+class SpriteBatch;
+
 class BackgroundManager {
  public:
+    // Object indices of a layer sorted by y, for viewport range queries
+    struct YIndex {
+        std::vector<float> ys;         // Ascending
+        std::vector<uint32_t> order;   // Object index of each ys entry
+
+        void build(const std::vector<float>& object_y);
+        // Append the objects whose y lies in [top, bottom], by y
+        void query(float top, float bottom, std::vector<uint32_t>& out) const;
+    };
+
     BackgroundManager() = default;
     ~BackgroundManager();
 
@@ -29,32 +46,97 @@ class BackgroundManager {
     // UI-only scroll state (used by TITLE/GAMEOVER/WIN screens).
     void reset_ui_scroll() noexcept { m_ui_scroll_y = 0.0f; }
     float ui_scroll_y() const noexcept { return m_ui_scroll_y; }
+    // True when the last update_ui_scroll() moved the UI background
+    bool is_ui_scrolling() const noexcept { return m_ui_scroll_moving; }
 
     // Call every frame (only needed for UiScreen scenes).
     void update_ui_scroll(float dt, float viewport_height);
 
+    // Load sprite sheets and composite static layers once the window exists.
+    // Call before BeginDrawing(): compositing uses render texture mode.
+    void prepare() const { ensure_textures_loaded_(); }
+
     // Draw backgrounds. If use_ui_scroll == true, camera Y comes from
-    // m_ui_scroll_y, otherwise it comes from gameplay_camera_y.
+    // m_ui_scroll_y, otherwise it comes from gameplay_camera_y. When a batch
+    // is given, tiles are submitted to it (Background layer + layer index).
     void draw(float gameplay_camera_y, bool use_ui_scroll, float viewport_width,
-              float viewport_height) const;
+              float viewport_height, SpriteBatch* batch = nullptr) const;
 
-    void clear();  // unload textures + detach scene
+    void clear();  // release textures + detach scene
+
+    // GPU memory allowed for pre-composited layer strips, applied when the
+    // next scene's textures load. 0 draws every layer per object.
+    void set_composite_budget(size_t bytes) noexcept {
+        m_composite_budget = bytes;
+    }
+    size_t composite_bytes() const noexcept { return m_composite_bytes; }
 
  private:
+    // Per-object data resolved once per scene
+    struct ObjectEntry {
+        const udjourney::scene::BackgroundObjectData* data = nullptr;
+        Rectangle source{};
+        float size = 0.0f;       // tile_size * scale
+        float extent_up = 0.0f;  // Reach above/left of (x, y) once rotated
+        float extent_down = 0.0f;  // Reach below/right of (x, y)
+        mutable const Texture2D* texture = nullptr;  // Set once loaded
+    };
+
+    // Layer objects with cached wrap bounds and a y-sorted index
+    struct LayerEntry {
+        const udjourney::scene::BackgroundLayerData* data = nullptr;
+        std::vector<ObjectEntry> objects;  // Scene order (draw order)
+        YIndex index;
+        float max_extent_up = 0.0f;
+        float max_extent_down = 0.0f;
+        float min_y = 0.0f;
+        float max_y = 0.0f;
+        bool has_bounds = false;
+
+        // Static layers are pre-composited into kStripHeight tall strips
+        // (empty: draw per object). composite_top is the layer y of strip 0.
+        mutable std::vector<RenderTexture2D> strips;
+        mutable float composite_top = 0.0f;
+        mutable float composite_height = 0.0f;
+    };
+
+    static constexpr int kStripHeight = 512;
+    static constexpr int kCompositeWidth = 640;  // Base coordinate system
+#ifdef PLATFORM_DREAMCAST
+    static constexpr size_t kDefaultCompositeBudget = 0;  // No FBOs
+#else
+    static constexpr size_t kDefaultCompositeBudget = 16u * 1024u * 1024u;
+#endif
+
     void rebuild_sorted_layers_();
     void ensure_textures_loaded_() const;
+    void resolve_textures_() const;
     void unload_textures_();
+    void composite_layers_() const;
+    void composite_layer_(const LayerEntry& layer) const;
+    void release_composites_() const;
+    void draw_composite_(const LayerEntry& layer, float screen_x,
+                         float screen_top, float period,
+                         float viewport_height) const;
 
     const udjourney::scene::Scene* m_scene = nullptr;
-    std::vector<const udjourney::scene::BackgroundLayerData*> m_sorted_layers;
+    std::vector<LayerEntry> m_sorted_layers;  // By depth
+
+    // Scratch list of visible objects, reused every frame
+    mutable std::vector<uint32_t> m_visible;
+
+    size_t m_composite_budget = kDefaultCompositeBudget;
+    mutable size_t m_composite_bytes = 0;
 
     float m_ui_scroll_y = 0.0f;
+    bool m_ui_scroll_moving = false;
 
     // Textures are loaded lazily once the raylib window/context exists.
     mutable bool m_textures_loaded = false;
 
-    // sprite_sheet (relative) -> Texture2D
+    // sprite_sheet (relative) -> Texture2D, acquired from TextureManager
     mutable std::unordered_map<std::string, Texture2D> m_textures;
+    mutable std::vector<TextureHandle> m_acquired;  // Released on clear()
 };
 
 }  // namespace udjourney
@@ -0,0 +1,68 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "raylib/raylib.h"
+
+/**
+ * @brief Pixel layouts of a cooked texture (values are stored in the file)
+ *
+ * The 16-bit layouts match raylib's R5G5B5A1 / R5G6B5 / R4G4B4A4, which the
+ * PVR takes natively. Indexed layouts keep a palette in one of the other
+ * formats.
+ */
+enum class CookedFormat : uint8_t {
+    Rgba8888 = 0,
+    Rgba5551 = 1,
+    Rgb565 = 2,
+    Rgba4444 = 3,
+    Indexed4 = 4,  // Two pixels per byte, first pixel in the low nibble
+    Indexed8 = 5,
+};
+
+/**
+ * @brief Project texture format (.udt) written by udj-texture-cooker.
+ *
+ * A 24-byte little-endian header ("UDT1", width, height, format, palette
+ * format, palette size, flags, raw and stored payload sizes) followed by
+ * the payload: palette entries, then pixel rows. With the LZ4 flag the
+ * payload is one LZ4 block.
+ *
+ * Loading skips the PNG inflate and filter pass entirely: 16-bit data is
+ * uploaded as is, indexed data is expanded to its palette format on the
+ * way. raylib has no paletted upload, so indexed textures save romdisk
+ * space and read time, not VRAM.
+ */
+class CookedTexture {
+ public:
+    // "sprites/foo.png" -> "sprites/foo.udt"
+    static std::string cooked_path_for(const std::string& source_path);
+
+    // True if cooked_path exists and, on the host, is not older than
+    // source_path (a PNG edited since the last cook wins)
+    static bool is_current(const std::string& cooked_path,
+                           const std::string& source_path);
+
+    /**
+     * @brief Encode an R8G8B8A8 image
+     * @param palette_format Entry format of Indexed4/Indexed8 palettes
+     * @return Empty if the image is not R8G8B8A8 or has more colors than
+     *         the indexed format holds
+     */
+    static std::vector<uint8_t> encode(const Image& image, CookedFormat format,
+                                       CookedFormat palette_format,
+                                       bool compress);
+
+    /**
+     * @brief Decode into an Image released with UnloadImage
+     * @return False (and *out untouched) on malformed data
+     */
+    static bool decode(const uint8_t* data, size_t size, Image* out);
+
+    // False without logging if the file does not exist
+    static bool load_from_file(const std::string& path, Image* out);
+};
@@ -29,7 +29,11 @@ class HUDManager {
     [[nodiscard]] inline HUDComponent* get_top_focus() const {
         return m_focus_stacks.empty() ? nullptr : m_focus_stacks.back().get();
     }
-    void draw() const;
+    /**
+     * @brief Draw all HUDs; each one is its own batch pass, so the text of
+     * a HUD stays below the HUDs stacked above it
+     */
+    void draw(udjourney::SpriteBatch* batch) const;
 
     HUDComponent* get_component_by_type(const std::string& type_str);
     void clear_background_huds() { m_background_components.clear(); }
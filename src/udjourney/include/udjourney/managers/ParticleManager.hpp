@@ -2,17 +2,21 @@
 #pragma once
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 #include <string>
 
 #include "raylib/raylib.h"
+#include "udjourney/particle/BakedBurst.hpp"
 #include "udjourney/particle/ParticleEmitter.hpp"
 #include "udjourney/particle/ParticlePreset.hpp"
 #include "udjourney/loaders/ParticlePresetLoader.hpp"
 
 namespace udjourney {
 
+namespace scene {
+class TileOccupancyGrid;
+}  // namespace scene
+
 /**
  * @brief Manages all particle emitters in the game
  *
@@ -23,7 +27,6 @@ namespace udjourney {
 class ParticleManager {
  public:
     ParticleManager() = default;
-    ~ParticleManager();
 
     ParticleManager(const ParticleManager&) = delete;
     ParticleManager& operator=(const ParticleManager&) = delete;
@@ -43,8 +46,10 @@ class ParticleManager {
      * @brief Draw all particles from all emitters with a camera offset
      * @param camera_offset Camera position in world space (subtracted from
      * particle world positions)
+     * @param batch Sprite batch to submit textured particles to (Effects
+     * layer), or nullptr to draw immediately
      */
-    void draw(Vector2 camera_offset) const;
+    void draw(Vector2 camera_offset, SpriteBatch* batch = nullptr) const;
 
     /**
      * @brief Create a new emitter from a preset name
@@ -58,12 +63,24 @@ class ParticleManager {
 
     /**
      * @brief Create a one-shot burst effect from a preset name
+     *
+     * Presets marked `bake: true` play their baked flipbook (one quad) when
+     * the sheet is available, and fall back to full simulation otherwise.
+     *
      * @param preset_name Name of the preset to use
      * @param position Position to spawn the burst
      * @return true if burst was created successfully
      */
     bool create_burst(const std::string& preset_name, Vector2 position);
 
+    /**
+     * @brief Set the static world used by presets with collide_with_world
+     * @param grid Occupancy grid owned by the caller, or nullptr to disable
+     */
+    void set_world_grid(const scene::TileOccupancyGrid* grid) {
+        world_grid_ = grid;
+    }
+
     /**
      * @brief Remove all emitters
      */
@@ -79,6 +96,13 @@ class ParticleManager {
      */
     [[nodiscard]] size_t get_emitter_count() const { return emitters_.size(); }
 
+    /**
+     * @brief Get number of baked flipbook bursts currently playing
+     */
+    [[nodiscard]] size_t get_baked_burst_count() const {
+        return baked_bursts_.size();
+    }
+
     /**
      * @brief Load particle presets from a JSON file
      * @param filename Path to the preset file
@@ -96,15 +120,11 @@ class ParticleManager {
 
  private:
     void cleanup_dead_emitters_();
-    void ensure_textures_loaded_() const;
-    void unload_textures_();
 
     std::vector<std::unique_ptr<ParticleEmitter>> emitters_;
+    std::vector<BakedBurst> baked_bursts_;
     ParticlePresetLoader preset_loader_;
-
-    // Texture cache (similar to BackgroundManager pattern)
-    mutable bool textures_loaded_ = false;
-    mutable std::unordered_map<std::string, Texture2D> textures_;
+    const scene::TileOccupancyGrid* world_grid_ = nullptr;
 };
 
 }  // namespace udjourney
@@ -0,0 +1,51 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <cstdint>
+
+#include "raylib/raylib.h"
+
+/**
+ * @brief Slot of a texture registered with TextureManager.
+ *
+ * Resolved once from a path (TextureManager::get_handle) when a level, a
+ * preset or a widget is loaded; draw paths then fetch the Texture2D by
+ * index without hashing the path. Index 0 is the null handle.
+ */
+struct TextureHandle {
+    uint32_t index = 0;
+
+    [[nodiscard]] bool is_valid() const noexcept { return index != 0; }
+    bool operator==(const TextureHandle&) const = default;
+};
+
+/**
+ * @brief A sheet as drawn: the texture holding it and where it sits there.
+ *
+ * Sheets packed by udj-atlas-packer live inside a shared atlas page, so
+ * their frame rects are offset by rect. A standalone sheet has an empty
+ * rect and fills its whole texture.
+ */
+struct TextureRegion {
+    TextureHandle handle;
+    Rectangle rect{};  // Sheet bounds in the texture; empty if standalone
+
+    [[nodiscard]] bool is_packed() const noexcept { return rect.width > 0; }
+
+    // Sheet-space rect -> texture-space rect
+    [[nodiscard]] Rectangle map(Rectangle sheet_rect) const noexcept {
+        return Rectangle{sheet_rect.x + rect.x,
+                         sheet_rect.y + rect.y,
+                         sheet_rect.width,
+                         sheet_rect.height};
+    }
+
+    // Like map(), but an empty rect stands for the whole sheet: packed
+    // sheets then get their bounds instead of the whole page
+    [[nodiscard]] Rectangle map_or_sheet(Rectangle sheet_rect) const noexcept {
+        if (sheet_rect.width > 0 && sheet_rect.height > 0) {
+            return map(sheet_rect);
+        }
+        return is_packed() ? rect : sheet_rect;
+    }
+};
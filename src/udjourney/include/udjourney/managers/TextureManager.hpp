@@ -2,23 +2,208 @@
 #ifndef SRC_UDJOURNEY_INCLUDE_UDJOURNEY_MANAGERS_TEXTUREMANAGER_HPP_
 #define SRC_UDJOURNEY_INCLUDE_UDJOURNEY_MANAGERS_TEXTUREMANAGER_HPP_
 
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "raylib/raylib.h"
+#include "udjourney/managers/AtlasMap.hpp"
+#include "udjourney/managers/TextureHandle.hpp"
 
+/**
+ * @brief Owner of every game texture (one upload per path).
+ *
+ * Residency: a loaded texture stays in video memory while it is referenced
+ * (acquire/release, for holders of a Texture2D copy), pinned by the current
+ * scene, or drawn this frame. Anything else is evicted, least recently used
+ * first, when the resident bytes exceed the budget; its handle stays valid
+ * and reloads on the next get().
+ *
+ * Loading: get() loads synchronously, unless the handle was request()ed.
+ * Requested files are decoded on a worker thread and uploaded by
+ * pump_uploads() on the main thread; until then get() returns a transparent
+ * placeholder.
+ */
 class TextureManager {
  public:
+    /**
+     * @brief File decoding and GPU upload used by the manager
+     *
+     * Defaults to raylib. Replaceable so residency can be exercised without
+     * a GL context (tests); decode runs on the worker thread.
+     */
+    struct Backend {
+        Image (*decode)(const std::string& full_path);
+        Texture2D (*upload)(const Image& image);
+        void (*unload)(Texture2D texture);
+    };
+
     static TextureManager& get_instance();
 
-    Texture2D get_texture(const std::string& path);
+    [[nodiscard]] static Backend default_backend();
+    // Unload everything first: textures are freed by the backend that
+    // uploaded them
+    void set_backend(const Backend& new_backend) { backend = new_backend; }
+
+    /**
+     * @brief Register path and return its handle (stable until exit)
+     *
+     * Does not load anything: the texture is loaded on the first get(), so
+     * handles can be resolved before the window exists.
+     */
+    TextureHandle get_handle(const std::string& path);
+
+    /**
+     * @brief Handle and placement of sheet path, through the atlas remap
+     * table when one is loaded (the atlas page then stands in for the sheet)
+     *
+     * For sheets drawn by sub-rect. Repeat-wrapped textures must keep their
+     * own file and use get_handle.
+     */
+    TextureRegion get_region(const std::string& path);
+
+    /**
+     * @brief Point a (file, sheet-space source rect) pair at the atlas page
+     * holding file, for loaders that store both
+     *
+     * has_rect false means the whole sheet: rect then becomes the sheet
+     * bounds and has_rect true. Unpacked sheets are left untouched.
+     * @return True if the pair was remapped
+     */
+    bool remap_to_atlas(std::string& file, Rectangle& rect, bool& has_rect);
+
+    /**
+     * @brief Load udj-atlas-packer's remap table (asset-relative path)
+     * @return False if absent: every sheet then loads from its own file
+     */
+    bool load_atlas_map(const std::string& path);
+
+    /**
+     * @brief Texture of handle, loaded on first use (empty for null handle)
+     *
+     * While a request()ed load is in flight, returns the placeholder.
+     */
+    Texture2D get(TextureHandle handle);
+
+    /**
+     * @brief Start decoding handle's file in the background (no-op if it is
+     * loaded or already on its way)
+     */
+    void request(TextureHandle handle);
+
+    // True once handle's texture is uploaded (or its load failed)
+    [[nodiscard]] bool is_ready(TextureHandle handle) const;
+
+    /**
+     * @brief Upload decoded images until budget_seconds have elapsed
+     *
+     * Main thread, outside BeginTextureMode. Uploads at least one image per
+     * call so a slow frame cannot stall the queue.
+     * @return Number of textures uploaded
+     */
+    size_t pump_uploads(double budget_seconds);
+
+    // Same as get, with repeat wrapping enabled (set once per load)
+    Texture2D get_repeating(TextureHandle handle);
+
+    [[nodiscard]] const std::string& get_path(TextureHandle handle) const;
+
+    Texture2D get_texture(const std::string& path) {
+        return get(get_handle(path));
+    }
+    Texture2D get_repeating_texture(const std::string& path) {
+        return get_repeating(get_handle(path));
+    }
+
+    /**
+     * @brief get(), and keep the texture resident until release()
+     *
+     * For callers that keep the returned Texture2D (widgets, animation
+     * controllers, projectiles): an evicted texture would leave them with a
+     * dead id. Always loads synchronously, never returns the placeholder.
+     */
+    Texture2D acquire(TextureHandle handle);
+    void release(TextureHandle handle);
+
+    // Keep handle resident until the scene changes (unpin_all)
+    void pin(TextureHandle handle);
+    void unpin_all();
+
+    // Resident bytes above which unused textures are evicted
+    void set_budget_bytes(size_t bytes) noexcept { budget_bytes = bytes; }
+    [[nodiscard]] size_t get_budget_bytes() const noexcept {
+        return budget_bytes;
+    }
+    [[nodiscard]] size_t get_resident_bytes() const noexcept {
+        return resident_bytes;
+    }
+    [[nodiscard]] size_t get_resident_count() const noexcept {
+        return resident_count;
+    }
+
+    /**
+     * @brief Advance the LRU clock and evict down to the budget
+     *
+     * Call once per frame after EndDrawing, when no draw still refers to
+     * the evicted textures.
+     */
+    void end_frame();
+
+    // Unload every texture; handles stay valid and reload on next get()
     void unload_all();
 
  private:
-    TextureManager() = default;
+    enum class LoadState : uint8_t { Unloaded, Decoding, Loaded };
+
+    struct Slot {
+        std::string path;
+        Texture2D texture{};
+        size_t bytes = 0;
+        uint64_t last_used = 0;  // Frame of the last get()
+        uint32_t ref_count = 0;
+        LoadState state = LoadState::Unloaded;
+        bool repeating = false;
+        bool pinned = false;
+    };
+
+    TextureManager();
     ~TextureManager();
 
-    std::unordered_map<std::string, Texture2D> textures;
+    void load_(Slot& slot);
+    void upload_(Slot& slot, const Image& image);
+    void unload_(Slot& slot);
+    [[nodiscard]] bool is_evictable_(const Slot& slot) const;
+    Texture2D get_placeholder_();
+
+    // Worker thread: decode queued files into CPU images
+    void decode_loop_();
+    void stop_worker_();
+
+    std::vector<Slot> slots;  // Indexed by TextureHandle::index, 0 unused
+    std::unordered_map<std::string, uint32_t> handles;
+    size_t budget_bytes;
+    size_t resident_bytes = 0;
+    size_t resident_count = 0;
+    uint64_t frame = 1;
+    Texture2D placeholder{};
+    AtlasMap atlas_map;
+    Backend backend;
+
+    // Shared with the worker. It only sees indices and full paths, never
+    // the slots (get_handle may grow the vector meanwhile).
+    std::thread worker;
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<std::pair<uint32_t, std::string>> decode_queue;
+    std::deque<std::pair<uint32_t, Image>> decoded;  // Awaiting upload
+    bool stopping = false;
 };
 
 #endif  // SRC_UDJOURNEY_INCLUDE_UDJOURNEY_MANAGERS_TEXTUREMANAGER_HPP_
@@ -0,0 +1,67 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include "raylib/raylib.h"
+#include "udjourney/managers/TextureHandle.hpp"
+#include "udjourney/particle/ParticlePreset.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
+
+namespace udjourney {
+
+/**
+ * @brief One-shot playback of a baked particle burst
+ *
+ * Plays the flipbook produced by udj-particle-baker for a preset marked
+ * `bake: true`. Each burst costs a single textured quad per frame, no matter
+ * how many particles the preset would have simulated.
+ *
+ * The sheet is looked up through its handle on every draw, which keeps it
+ * resident while the burst plays.
+ */
+class BakedBurst {
+ public:
+    BakedBurst(const ParticlePreset& preset, TextureHandle sheet,
+               Vector2 position);
+
+    /**
+     * @brief Advance playback
+     * @param delta Time step in seconds
+     */
+    void update(float delta) { age_ += delta; }
+
+    /**
+     * @brief Draw the current flipbook frame
+     * @param camera_offset Camera position in world space
+     * @param batch Sprite batch to submit to, or nullptr to draw immediately
+     */
+    void draw(Vector2 camera_offset, SpriteBatch* batch = nullptr) const;
+
+    /**
+     * @brief Check if the last frame has been played
+     */
+    [[nodiscard]] bool is_dead() const { return age_ >= duration_; }
+
+    /**
+     * @brief Flipbook frame shown at the current age (held on the last one)
+     */
+    [[nodiscard]] int get_frame() const;
+
+    /**
+     * @brief Sheet rectangle of the current frame
+     */
+    [[nodiscard]] Rectangle get_source_rect() const;
+
+    [[nodiscard]] Vector2 get_position() const { return position_; }
+
+ private:
+    TextureHandle sheet_;
+    Vector2 position_;
+    int frame_count_;
+    int columns_;
+    float frame_size_;
+    float fps_;
+    float duration_;
+    float age_ = 0.0f;
+};
+
+}  // namespace udjourney
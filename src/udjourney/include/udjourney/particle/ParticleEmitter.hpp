@@ -2,18 +2,34 @@
 #pragma once
 
 #include <vector>
+
+#include <udj-core/Random.hpp>
+
 #include "raylib/raylib.h"
 #include "udjourney/particle/Particle.hpp"
 #include "udjourney/particle/ParticlePreset.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
 
 namespace udjourney {
 
+namespace scene {
+class TileOccupancyGrid;
+}  // namespace scene
+
 /**
  * @brief Emitter that spawns and manages particles based on a preset
  */
 class ParticleEmitter {
  public:
     explicit ParticleEmitter(const ParticlePreset& preset);
+
+    /**
+     * @brief Construct an emitter with a fixed random seed
+     *
+     * Two emitters built from the same preset and seed, updated with the same
+     * time steps, produce identical particles (used to bake flipbooks).
+     */
+    ParticleEmitter(const ParticlePreset& preset, unsigned int seed);
     ~ParticleEmitter() = default;
 
     [[nodiscard]] const ParticlePreset& get_preset() const { return preset_; }
@@ -24,13 +40,25 @@ class ParticleEmitter {
      */
     void update(float delta);
 
+    /**
+     * @brief Bounce or kill particles that entered a solid world cell
+     *
+     * Must run right after update() with the same delta: the previous
+     * position is reconstructed from the integrated velocity.
+     * @param grid Static world occupancy
+     * @param delta Time step used by the last update()
+     */
+    void collide_with_world(const scene::TileOccupancyGrid& grid, float delta);
+
     /**
      * @brief Emit particles (called by ParticleManager during rendering)
      * @param texture Texture to use for rendering
      * @param camera_offset Camera position in world space (subtracted from
      * particle world positions)
+     * @param batch Sprite batch for textured particles, or nullptr
      */
-    void draw(Texture2D texture, Vector2 camera_offset) const;
+    void draw(Texture2D texture, Vector2 camera_offset,
+              SpriteBatch* batch = nullptr) const;
 
     /**
      * @brief Set emitter position
@@ -59,6 +87,13 @@ class ParticleEmitter {
         return particles_.size();
     }
 
+    /**
+     * @brief Get live particles (read-only)
+     */
+    [[nodiscard]] const std::vector<Particle>& get_particles() const {
+        return particles_;
+    }
+
     /**
      * @brief Enable/disable emitter
      */
@@ -70,10 +105,11 @@ class ParticleEmitter {
     [[nodiscard]] bool is_active() const { return active_; }
 
  private:
-    void spawn_particle_();
+    void spawn_particles_(int count);
     void cleanup_dead_particles_();
 
     ParticlePreset preset_;
+    udj::core::Rng rng_;
     Vector2 position_{0.0f, 0.0f};
     std::vector<Particle> particles_;
 
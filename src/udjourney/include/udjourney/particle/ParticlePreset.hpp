@@ -4,6 +4,7 @@
 #include <string>
 
 #include "raylib/raylib.h"
+#include "udjourney/managers/TextureHandle.hpp"
 
 namespace udjourney {
 
@@ -13,6 +14,7 @@ namespace udjourney {
 struct ParticlePreset {
     std::string name;
     std::string texture_file;
+    TextureHandle texture;  // Resolved from texture_file by ParticleManager
 
     // Atlas/tile rendering
     bool use_atlas = false;
@@ -43,6 +45,22 @@ struct ParticlePreset {
     // Emitter properties
     float emitter_lifetime =
         0.0f;  // 0 = infinite, >0 = auto-destroy after time
+
+    // World collision against static platforms (opt-in)
+    bool collide_with_world = false;
+    float world_bounce = 0.4f;  // Velocity kept on impact, 0 = die on contact
+
+    // Baked flipbook (burst presets only). When enabled, bursts play a
+    // pre-rendered sprite sheet produced by udj-particle-baker instead of
+    // simulating every particle at runtime.
+    bool bake = false;
+    std::string bake_sheet;      // Defaults to particles/baked/<name>.png
+    TextureHandle bake_texture;  // Resolved from bake_sheet
+    int bake_frame_count = 16;   // Number of frames in the flipbook
+    int bake_columns = 4;        // Frames per row in the sheet
+    int bake_frame_size = 64;    // Square frame size in pixels
+    float bake_fps = 20.0f;      // Playback rate in frames per second
+    unsigned int bake_seed = 1;  // Fixed seed used when baking
 };
 
 }  // namespace udjourney
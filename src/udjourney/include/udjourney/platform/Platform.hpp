@@ -14,9 +14,11 @@
 
 #include "udjourney/interfaces/IActor.hpp"
 #include "udjourney/interfaces/IGame.hpp"
+#include "udjourney/managers/TextureHandle.hpp"
 #include "udjourney/platform/behavior_strategies/PlatformBehaviorStrategy.hpp"
 #include "udjourney/platform/features/PlatformFeatureBase.hpp"
 #include "udjourney/platform/reuse_strategies/PlatformReuseStrategy.hpp"
+#include "udjourney/render/TriangleList.hpp"
 namespace udjourney {
 
 class Platform : public IActor {
@@ -33,18 +35,43 @@ class Platform : public IActor {
 
     void draw() const override;
     void update(float delta) override;
+
+    /**
+     * @brief Draw the parts that never change (texture, outline, features)
+     *
+     * Used by StaticChunkCache to bake the platform; draw() then only draws
+     * the dynamic feature overlays.
+     */
+    void draw_static() const;
+
+    // Static behavior and no reuse strategy: safe to bake into a chunk
+    [[nodiscard]] bool is_bakeable() const noexcept;
+    void set_baked(bool baked) noexcept {
+        mark_baked_dirty_();  // Leaving a chunk clears it from the bake
+        m_baked = baked;
+    }
+    [[nodiscard]] bool is_baked() const noexcept { return m_baked; }
     [[nodiscard]] Rectangle get_drawing_rect() const;
 
     [[nodiscard]] float get_dx() const noexcept { return m_delta_x; }
     void process_input() override;
-    void set_rectangle(Rectangle iRect) override { this->m_rect = iRect; }
+    void set_rectangle(Rectangle iRect) override {
+        const bool resized = iRect.width != m_rect.width ||
+                             iRect.height != m_rect.height;
+        mark_baked_dirty_();
+        this->m_rect = iRect;
+        mark_baked_dirty_();
+        if (resized) {
+            invalidate_geometry_();
+        }
+    }
     [[nodiscard]] Rectangle get_rectangle() const override { return m_rect; }
     [[nodiscard]] bool check_collision(
         const IActor& iOtherActor) const override {
         return CheckCollisionRecs(m_rect, iOtherActor.get_rectangle());
     }
     [[nodiscard]] inline constexpr uint8_t get_group_id() const override {
-        return 1;
+        return PLATFORM_TYPE_ID;
     }
     [[nodiscard]] inline constexpr auto is_y_repeated() const noexcept -> bool {
         return m_repeated_y;
@@ -86,9 +113,8 @@ class Platform : public IActor {
 
     void add_feature(std::unique_ptr<PlatformFeatureBase> feature);
 
-    void set_texture_file(std::string texture_file) {
-        m_texture_file = std::move(texture_file);
-    }
+    // Resolves the texture handle once; draws never look the path up
+    void set_texture_file(const std::string& texture_file);
     void set_texture_tiled(bool tiled) noexcept { m_texture_tiled = tiled; }
     [[nodiscard]] bool is_texture_tiled() const noexcept {
         return m_texture_tiled;
@@ -99,9 +125,12 @@ class Platform : public IActor {
     [[nodiscard]] Rectangle get_source_rect() const noexcept {
         return m_source_rect;
     }
-    void clear_texture() { m_texture_file.clear(); }
+    void clear_texture() noexcept { m_texture = TextureHandle{}; }
     [[nodiscard]] bool has_texture() const noexcept {
-        return !m_texture_file.empty();
+        return m_texture.is_valid();
+    }
+    [[nodiscard]] TextureHandle get_texture_handle() const noexcept {
+        return m_texture;
     }
 
     [[nodiscard]] auto get_features() const
@@ -117,17 +146,24 @@ class Platform : public IActor {
     }
 
  private:
+    void invalidate_geometry_() noexcept;
+    // Tell the game the chunks under a baked platform need a rebake
+    void mark_baked_dirty_() const noexcept;
+
     bool m_collidable = true;
+    bool m_baked = false;  // Drawn by StaticChunkCache
     float m_delta_x = 0.0F;
     std::unique_ptr<PlatformReuseStrategy> m_reuse_strategy;
     Rectangle m_rect;
     Color m_color = BLUE;
-    std::string m_texture_file;
+    TextureHandle m_texture;
     bool m_texture_tiled = false;
     bool m_use_atlas = false;
     Rectangle m_source_rect = {0, 0, 0, 0};
     bool m_repeated_y = false;
     std::unique_ptr<PlatformBehaviorStrategy> m_behavior;
+    // Rounded outline for textured platforms, built once per size
+    mutable TriangleList m_outline;
     // Align vector to 8 bytes for SH4 safety
     alignas(8) std::vector<std::unique_ptr<PlatformFeatureBase>> m_features;
 };
@@ -9,12 +9,15 @@
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/platform/Platform.hpp"
 #include "udjourney/platform/features/PlatformFeatureBase.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/TriangleList.hpp"
 namespace udjourney {
 struct DownwardSpikeFeature : public PlatformFeatureBase {
     float height = 20.0f;  // Default spike height
     int damage = 1;        // Default damage
     Rectangle collision_rect;
     Color c = ORANGE;
+    mutable TriangleList spike_geometry;  // Relative to the platform corner
 
     int_fast8_t get_type() const override {
         return 2;
@@ -23,22 +26,30 @@ struct DownwardSpikeFeature : public PlatformFeatureBase {
     void draw(const Platform& platform) const override {
         /* draw downward spikes */
         auto rect = platform.get_drawing_rect();
-        DrawRectangleLinesEx(rect, 1.0F, DARKPURPLE);
-
-        // Draw spikes on bottom of the platform (pointing downward)
-        float spike_width = rect.width / 8.0f;
-        for (int i = 0; i < 8; ++i) {
-            float x = rect.x + i * spike_width;
-            DrawTriangle(
-                Vector2{x, rect.y + rect.height},
-                Vector2{x + spike_width, rect.y + rect.height},
-                Vector2{x + spike_width / 2, rect.y + rect.height + 20},
-                DARKPURPLE);
+        draw::rectangle_lines_ex(rect, 1.0F, DARKPURPLE);
+
+        // Draw spikes on bottom of the platform (pointing downward), built
+        // once per size
+        if (spike_geometry.empty()) {
+            float spike_width = rect.width / 8.0f;
+            for (int i = 0; i < 8; ++i) {
+                float x = i * spike_width;
+                spike_geometry.add_triangle(
+                    Vector2{x, rect.height},
+                    Vector2{x + spike_width, rect.height},
+                    Vector2{x + spike_width / 2, rect.height + 20});
+            }
         }
+        spike_geometry.draw(Vector2{rect.x, rect.y}, DARKPURPLE);
+    }
 
-        DrawRectangleLinesEx(collision_rect, 1.0F, c);
+    void draw_overlay(const Platform& /*platform*/) const override {
+        // Collision debug rect, colored by the last collision check
+        draw::rectangle_lines_ex(collision_rect, 1.0F, c);
     }
 
+    void invalidate_geometry() override { spike_geometry.clear(); }
+
     void handle_collision(Platform& platform, IActor& actor) override {
         auto rect = platform.get_drawing_rect();
         // Handle collision logic here, e.g., reduce player health
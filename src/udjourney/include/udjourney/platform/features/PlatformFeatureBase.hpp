@@ -11,6 +11,10 @@ struct PlatformFeatureBase {
     virtual int_fast8_t get_type() const { return 0; }
     virtual ~PlatformFeatureBase() = default;
     virtual void draw(const Platform&) const {}
+    // State-dependent visuals, drawn every frame even for baked platforms
+    virtual void draw_overlay(const Platform&) const {}
     virtual void handle_collision(Platform&, class IActor&) {}
+    // Called when the platform size changes; drop size-dependent caches
+    virtual void invalidate_geometry() {}
 };
 }  // namespace udjourney
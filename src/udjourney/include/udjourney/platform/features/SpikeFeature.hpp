@@ -9,12 +9,15 @@
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/platform/Platform.hpp"
 #include "udjourney/platform/features/PlatformFeatureBase.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/TriangleList.hpp"
 namespace udjourney {
 struct SpikeFeature : public PlatformFeatureBase {
     float height = 20.0f;  // Default spike height
     int damage = 1;        // Default damage
     Rectangle collision_rect;
     Color c = ORANGE;
+    mutable TriangleList spike_geometry;  // Relative to the platform corner
 
     int_fast8_t get_type() const override {
         return 1;
@@ -23,21 +26,29 @@ struct SpikeFeature : public PlatformFeatureBase {
     void draw(const Platform& platform) const override {
         /* draw spikes */
         auto rect = platform.get_drawing_rect();
-        DrawRectangleLinesEx(rect, 1.0F, RED);
-
-        // Draw spikes on top of the platform
-        float spike_width = rect.width / 8.0f;
-        for (int i = 0; i < 8; ++i) {
-            float x = rect.x + i * spike_width;
-            DrawTriangle(Vector2{x, rect.y},
-                         Vector2{x + spike_width, rect.y},
-                         Vector2{x + spike_width / 2, rect.y - 20},
-                         RED);
+        draw::rectangle_lines_ex(rect, 1.0F, RED);
+
+        // Draw spikes on top of the platform (built once per size)
+        if (spike_geometry.empty()) {
+            float spike_width = rect.width / 8.0f;
+            for (int i = 0; i < 8; ++i) {
+                float x = i * spike_width;
+                spike_geometry.add_triangle(
+                    Vector2{x, 0.0f},
+                    Vector2{x + spike_width, 0.0f},
+                    Vector2{x + spike_width / 2, -20.0f});
+            }
         }
+        spike_geometry.draw(Vector2{rect.x, rect.y}, RED);
+    }
 
-        DrawRectangleLinesEx(collision_rect, 1.0F, c);
+    void draw_overlay(const Platform& /*platform*/) const override {
+        // Collision debug rect, colored by the last collision check
+        draw::rectangle_lines_ex(collision_rect, 1.0F, c);
     }
 
+    void invalidate_geometry() override { spike_geometry.clear(); }
+
     void handle_collision(Platform& platform, IActor& actor) override {
         auto rect = platform.get_drawing_rect();
         // Handle collision logic here, e.g., reduce player health
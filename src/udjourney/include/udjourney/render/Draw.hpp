@@ -0,0 +1,106 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <cstddef>
+
+#include "udjourney/render/DrawStats.hpp"
+#include "udjourney/render/TextRenderer.hpp"
+
+/**
+ * @brief Instrumented wrappers over raylib's immediate draw calls.
+ *
+ * Each wrapper forwards to the raylib function of the same name and records
+ * the call, its vertex count and its texture in DrawStats. Vertex counts
+ * follow the geometry raylib emits (quads count 4, circles 36 segments).
+ * Text goes through TextRenderer, whose quad runs record themselves.
+ */
+namespace udjourney::draw {
+
+constexpr size_t kQuadVertices = 4;
+constexpr size_t kCircleSegments = 36;  // raylib's default for DrawCircle*
+
+inline void texture_pro(Texture2D texture, Rectangle source, Rectangle dest,
+                        Vector2 origin, float rotation, Color tint) {
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    DrawStats::record(kQuadVertices, texture.id);
+}
+
+inline void texture_rec(Texture2D texture, Rectangle source,
+                        Vector2 position, Color tint) {
+    DrawTextureRec(texture, source, position, tint);
+    DrawStats::record(kQuadVertices, texture.id);
+}
+
+inline void texture_ex(Texture2D texture, Vector2 position, float rotation,
+                       float scale, Color tint) {
+    DrawTextureEx(texture, position, rotation, scale, tint);
+    DrawStats::record(kQuadVertices, texture.id);
+}
+
+inline void rectangle(int x, int y, int width, int height, Color color) {
+    DrawRectangle(x, y, width, height, color);
+    DrawStats::record(kQuadVertices, DrawStats::kShapesTexture);
+}
+
+inline void rectangle_rec(Rectangle rect, Color color) {
+    DrawRectangleRec(rect, color);
+    DrawStats::record(kQuadVertices, DrawStats::kShapesTexture);
+}
+
+inline void rectangle_pro(Rectangle rect, Vector2 origin, float rotation,
+                          Color color) {
+    DrawRectanglePro(rect, origin, rotation, color);
+    DrawStats::record(kQuadVertices, DrawStats::kShapesTexture);
+}
+
+inline void rectangle_lines_ex(Rectangle rect, float thickness, Color color) {
+    DrawRectangleLinesEx(rect, thickness, color);
+    // Four edge rectangles in one call
+    DrawStats::record(4 * kQuadVertices, DrawStats::kShapesTexture);
+}
+
+inline void text(const char* str, int x, int y, int font_size, Color color,
+                 SpriteBatch* batch = nullptr) {
+    TextRenderer::get_instance().draw(str, x, y, font_size, color, batch);
+}
+
+inline int measure_text(const char* str, int font_size) {
+    return TextRenderer::get_instance().measure(str, font_size);
+}
+
+inline void circle(int center_x, int center_y, float radius, Color color) {
+    DrawCircle(center_x, center_y, radius, color);
+    DrawStats::record(kCircleSegments * 3, DrawStats::kShapesTexture);
+}
+
+inline void circle_v(Vector2 center, float radius, Color color) {
+    DrawCircleV(center, radius, color);
+    DrawStats::record(kCircleSegments * 3, DrawStats::kShapesTexture);
+}
+
+inline void circle_sector(Vector2 center, float radius, float start_angle,
+                          float end_angle, int segments, Color color) {
+    DrawCircleSector(center, radius, start_angle, end_angle, segments, color);
+    DrawStats::record(static_cast<size_t>(segments > 0 ? segments : 1) * 3,
+                      DrawStats::kShapesTexture);
+}
+
+inline void circle_lines(int center_x, int center_y, float radius,
+                         Color color) {
+    DrawCircleLines(center_x, center_y, radius, color);
+    DrawStats::record(kCircleSegments * 2, DrawStats::kShapesTexture);
+}
+
+inline void line_ex(Vector2 start, Vector2 end, float thickness, Color color) {
+    DrawLineEx(start, end, thickness, color);
+    DrawStats::record(kQuadVertices, DrawStats::kShapesTexture);
+}
+
+inline void triangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    DrawTriangle(v1, v2, v3, color);
+    DrawStats::record(3, DrawStats::kShapesTexture);
+}
+
+}  // namespace udjourney::draw
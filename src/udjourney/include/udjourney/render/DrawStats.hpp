@@ -0,0 +1,92 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace udjourney {
+
+/**
+ * @brief Systems that draw-call counters are attributed to.
+ */
+enum class DrawSubsystem : uint8_t {
+    Other = 0,  // Anything outside a DrawStats::Scope
+    Background,
+    Platforms,
+    Player,
+    Monsters,
+    Projectiles,
+    Particles,
+    Hud,
+    SpriteBatch,  // SpriteBatch::flush() runs outside any other scope
+    Count,
+};
+
+/**
+ * @brief Per-frame draw call, vertex and texture change counters.
+ *
+ * Filled by the udjourney::draw facade (render/Draw.hpp) and by the rlgl
+ * emitters (SpriteBatch, TriangleList). Calls are attributed to the
+ * innermost DrawStats::Scope. Counters only touch plain memory, so they can
+ * be driven and read from headless tests.
+ */
+class DrawStats {
+ public:
+    struct Counters {
+        size_t calls = 0;            // Draw calls issued
+        size_t vertices = 0;         // Vertices emitted
+        size_t texture_changes = 0;  // Texture differs from previous call
+
+        Counters& operator+=(const Counters& other) {
+            calls += other.calls;
+            vertices += other.vertices;
+            texture_changes += other.texture_changes;
+            return *this;
+        }
+    };
+
+    // Pseudo texture id for raylib's internal shapes texture
+    static constexpr unsigned int kShapesTexture = 0;
+
+    /**
+     * @brief Attribute draws to a subsystem until the scope ends (nestable)
+     */
+    class Scope {
+     public:
+        explicit Scope(DrawSubsystem subsystem);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+     private:
+        DrawSubsystem previous_;
+    };
+
+    /**
+     * @brief Count draw calls using texture_id to the current subsystem
+     */
+    static void record(size_t vertices, unsigned int texture_id,
+                       size_t calls = 1);
+
+    /**
+     * @brief Publish this frame's counters and reset them
+     */
+    static void end_frame();
+
+    /**
+     * @brief Drop all counters, published ones included (tests)
+     */
+    static void reset();
+
+    [[nodiscard]] static DrawSubsystem get_current();
+    [[nodiscard]] static const Counters& get_frame(DrawSubsystem subsystem);
+    [[nodiscard]] static Counters get_frame_total();
+    [[nodiscard]] static const char* get_name(DrawSubsystem subsystem);
+
+ private:
+    using Table =
+        std::array<Counters, static_cast<size_t>(DrawSubsystem::Count)>;
+};
+
+}  // namespace udjourney
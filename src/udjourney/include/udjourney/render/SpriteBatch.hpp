@@ -0,0 +1,125 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace udjourney {
+
+/**
+ * @brief Coarse draw layers, lowest first.
+ *
+ * Values are spaced so a system can add a sub-layer (e.g. the background
+ * layer index) with SpriteBatch::layer().
+ */
+enum class RenderLayer : uint8_t {
+    Background = 0,  // + background layer index
+    Platforms = 64,
+    Actors = 96,
+    Player = 128,
+    Effects = 160,
+    Overlay = 224,
+};
+
+/**
+ * @brief Deferred, texture-sorted sprite renderer.
+ *
+ * Between begin() and flush(), sprites are recorded instead of drawn. flush()
+ * sorts them by (layer, texture, depth), keeping submission order for equal
+ * keys, and emits one quad run per texture through rlgl. Outside a
+ * begin()/flush() pair, submissions are drawn immediately, so callers never
+ * need to check whether a frame is being recorded.
+ *
+ * Anything drawn with plain raylib calls while recording ends up *below* the
+ * batched sprites of that pass.
+ */
+class SpriteBatch {
+ public:
+    struct Stats {
+        size_t sprites = 0;        // Quads emitted
+        size_t draw_calls = 0;     // Texture runs (one GPU draw each)
+        size_t texture_binds = 0;  // Texture changes between runs
+    };
+
+    static constexpr uint8_t layer(RenderLayer base, int sublayer = 0) {
+        return static_cast<uint8_t>(static_cast<int>(base) + sublayer);
+    }
+
+    /**
+     * @brief Build a sort key: layer first, then texture, then depth.
+     */
+    static constexpr uint64_t make_sort_key(uint8_t layer_id,
+                                            uint32_t texture_id,
+                                            uint16_t depth) {
+        return (static_cast<uint64_t>(layer_id) << 56) |
+               (static_cast<uint64_t>(texture_id) << 16) |
+               static_cast<uint64_t>(depth);
+    }
+
+    void begin();
+    [[nodiscard]] bool is_recording() const { return recording_; }
+
+    /**
+     * @brief Submit a textured quad (same parameters as DrawTexturePro)
+     *
+     * A negative source width flips the sprite horizontally.
+     */
+    void draw_texture(uint8_t layer_id, Texture2D texture, Rectangle source,
+                      Rectangle dest, Vector2 origin = {0.0f, 0.0f},
+                      float rotation = 0.0f, Color tint = WHITE,
+                      uint16_t depth = 0);
+
+    /**
+     * @brief Submit a solid quad (same parameters as DrawRectanglePro)
+     */
+    void draw_rect(uint8_t layer_id, Rectangle dest, Color color,
+                   Vector2 origin = {0.0f, 0.0f}, float rotation = 0.0f,
+                   uint16_t depth = 0);
+
+    /**
+     * @brief Submit a rectangle outline as four solid quads
+     */
+    void draw_rect_lines(uint8_t layer_id, Rectangle rect, float thickness,
+                         Color color, uint16_t depth = 0);
+
+    /**
+     * @brief Sort and draw everything recorded since begin()
+     */
+    void flush();
+
+    /**
+     * @brief Publish this frame's counters and reset them
+     */
+    void end_frame();
+
+    [[nodiscard]] const Stats& get_frame_stats() const { return last_frame_; }
+    [[nodiscard]] size_t get_pending_count() const { return commands_.size(); }
+
+ private:
+    struct SpriteCommand {
+        unsigned int texture_id;  // 0 = solid color
+        float texture_width;
+        float texture_height;
+        Rectangle source;
+        Rectangle dest;
+        Vector2 origin;
+        float rotation;
+        Color tint;
+    };
+
+    void emit_quad_(const SpriteCommand& command) const;
+
+    bool recording_ = false;
+    std::vector<SpriteCommand> commands_;
+    std::vector<std::pair<uint64_t, uint32_t>> order_;  // (key, index)
+
+    unsigned int bound_texture_ = 0;
+    Stats current_;
+    Stats last_frame_;
+};
+
+}  // namespace udjourney
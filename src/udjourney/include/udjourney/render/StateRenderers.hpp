@@ -28,11 +28,20 @@ class PlayStateRenderer : public IStateRenderer {
 /**
  * @brief Renderer for pause overlay (PAUSE state).
  *
- * Draws gameplay scene + pause overlay text.
+ * Draws the gameplay frame captured when pausing (or the live scene if no
+ * capture is available), optionally dimmed, + pause overlay text.
  */
 class PauseStateRenderer : public IStateRenderer {
  public:
+    static constexpr float kDefaultDim = 0.3f;
+
+    // dim: opacity of the black veil over the captured frame (0 = none)
+    explicit PauseStateRenderer(float dim = kDefaultDim) : m_dim(dim) {}
+
     void render(const Game& game) const override;
+
+ private:
+    float m_dim;
 };
 
 }  // namespace udjourney
@@ -0,0 +1,109 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "udjourney/interfaces/IActor.hpp"
+
+namespace udjourney {
+
+class Platform;
+
+/**
+ * @brief Bakes static platforms into vertical render texture chunks.
+ *
+ * The level is split into bands of kChunkHeight world pixels. Only the
+ * chunks overlapping the camera are baked, into a small pool of render
+ * textures reused as the camera scrolls, so memory stays constant whatever
+ * the level height.
+ *
+ * build() flags the platforms it takes over (Platform::set_baked): those
+ * only draw their dynamic overlays per frame. Platforms that move, resize
+ * or get reused keep rendering per actor.
+ */
+class StaticChunkCache {
+ public:
+    static constexpr float kChunkHeight = 480.0f;
+    static constexpr size_t kSlotCount = 3;  // Two visible + one spare
+
+    StaticChunkCache() = default;
+    ~StaticChunkCache();
+
+    StaticChunkCache(const StaticChunkCache&) = delete;
+    StaticChunkCache& operator=(const StaticChunkCache&) = delete;
+
+    /**
+     * @brief Select the bakeable platforms among actors
+     *
+     * Call after the level's platforms are created. Drops baked chunks.
+     */
+    void build(const std::vector<std::unique_ptr<IActor>>& actors);
+
+    /**
+     * @brief Forget all chunks (platforms are about to be destroyed)
+     */
+    void clear();
+
+    /**
+     * @brief Rebake the chunks overlapping a world rectangle on next use
+     *
+     * For edits to baked platforms (editor, scripted changes).
+     */
+    void mark_dirty(Rectangle world_rect);
+    void mark_all_dirty();
+
+    /**
+     * @brief Bake the chunks visible from camera that are missing or dirty
+     *
+     * Must run outside BeginDrawing()'s matrix transforms, since render
+     * texture mode resets the modelview matrix.
+     */
+    void prepare(const std::vector<std::unique_ptr<IActor>>& actors,
+                 Rectangle camera);
+
+    /**
+     * @brief Draw the baked chunks visible from camera (screen space)
+     */
+    void draw(Rectangle camera) const;
+
+    [[nodiscard]] size_t get_baked_platform_count() const {
+        return baked_platforms_;
+    }
+    [[nodiscard]] size_t get_bake_count() const { return bake_count_; }
+
+ private:
+    struct Slot {
+        RenderTexture2D target{};
+        int chunk = 0;
+        float camera_x = 0.0f;  // Camera x the chunk was baked with
+        bool valid = false;
+        uint64_t last_used = 0;
+    };
+
+    static int chunk_index_(float world_y);
+    [[nodiscard]] const Slot* find_slot_(int chunk) const;
+    Slot& acquire_slot_(int chunk, int first_visible, int last_visible);
+    bool ensure_targets_(Rectangle camera);
+    void bake_(Slot& slot, int chunk,
+               const std::vector<std::unique_ptr<IActor>>& actors,
+               Rectangle camera);
+    void unload_targets_();
+
+    std::array<Slot, kSlotCount> slots_;
+    bool targets_loaded_ = false;
+#ifdef PLATFORM_DREAMCAST
+    bool disabled_ = true;  // No framebuffer objects on the Dreamcast
+#else
+    bool disabled_ = false;  // Set if render textures fail to load
+#endif
+    size_t baked_platforms_ = 0;
+    size_t bake_count_ = 0;
+    uint64_t frame_ = 0;
+};
+
+}  // namespace udjourney
@@ -0,0 +1,102 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "udjourney/render/SpriteBatch.hpp"
+
+namespace udjourney {
+
+/**
+ * @brief Glyph quads of one string, relative to its top-left corner.
+ */
+struct TextLayout {
+    struct Glyph {
+        Rectangle source;  // In the font atlas
+        Rectangle dest;    // Offset from the text position
+    };
+    std::vector<Glyph> glyphs;
+    float width = 0.0f;  // Same as raylib's MeasureText
+};
+
+/**
+ * @brief Draws text from a glyph atlas with cached layouts.
+ *
+ * Drop-in replacement for DrawText/MeasureText (same metrics and spacing).
+ * Each (string, size) is laid out once and cached. Glyphs are submitted to
+ * the frame's SpriteBatch when it is recording, so all text of a pass ends
+ * up in one run of the atlas texture. Otherwise each string is emitted as a
+ * single quad run.
+ *
+ * The atlas is raylib's built-in font unless set_font() installs another one
+ * (e.g. a BMFont loaded with LoadFont).
+ */
+class TextRenderer {
+ public:
+    static TextRenderer& get_instance();
+
+    /**
+     * @brief Draw text like DrawText; glyphs go to batch if it is recording
+     */
+    void draw(const char* text, int pos_x, int pos_y, int font_size,
+              Color color, SpriteBatch* batch = nullptr,
+              uint8_t layer_id = SpriteBatch::layer(RenderLayer::Overlay));
+
+    /**
+     * @brief Width of text in pixels, like MeasureText
+     */
+    int measure(const char* text, int font_size);
+
+    /**
+     * @brief Cached layout of text at font_size
+     */
+    const TextLayout& get_layout(const char* text, int font_size);
+
+    /**
+     * @brief Use another atlas font (the caller keeps ownership)
+     */
+    void set_font(const Font& font);
+
+    [[nodiscard]] size_t get_cached_layout_count() const {
+        return m_layout_count;
+    }
+
+    /**
+     * @brief Lay out text with a font, as raylib's DrawText would draw it
+     */
+    static TextLayout build_layout(const Font& font, const char* text,
+                                   int font_size);
+
+ private:
+    // Heterogeneous lookup, so a draw does not allocate a key string
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const {
+            return std::hash<std::string_view>{}(text);
+        }
+    };
+    using LayoutMap = std::unordered_map<std::string,
+                                         TextLayout,
+                                         StringHash,
+                                         std::equal_to<>>;
+
+    TextRenderer() = default;
+    bool ensure_font_();
+    void clear_layouts_();
+
+    Font m_font{};
+    bool m_custom_font = false;
+    std::unordered_map<int, LayoutMap> m_layouts;  // By font size
+    size_t m_layout_count = 0;
+    SpriteBatch m_immediate;  // Used when no recording batch is given
+};
+
+}  // namespace udjourney
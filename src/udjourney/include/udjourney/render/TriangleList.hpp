@@ -0,0 +1,50 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace udjourney {
+
+/**
+ * @brief Pre-built triangle geometry, drawn in a single rlgl batch.
+ *
+ * Used to cache decoration shapes (outlines, spikes) that only depend on an
+ * object's size: vertices are stored relative to the object's top-left
+ * corner and translated at draw time.
+ */
+class TriangleList {
+ public:
+    void clear() { vertices_.clear(); }
+    [[nodiscard]] bool empty() const { return vertices_.empty(); }
+    [[nodiscard]] size_t get_triangle_count() const {
+        return vertices_.size() / 3;
+    }
+
+    /**
+     * @brief Append a triangle (winding is normalized for raylib's culling)
+     */
+    void add_triangle(Vector2 a, Vector2 b, Vector2 c);
+
+    /**
+     * @brief Append a thick line segment as two triangles (like DrawLineEx)
+     */
+    void add_line(Vector2 start, Vector2 end, float thickness);
+
+    /**
+     * @brief Append a filled axis-aligned rectangle as two triangles
+     */
+    void add_rect(Rectangle rect);
+
+    /**
+     * @brief Draw all triangles translated by offset
+     */
+    void draw(Vector2 offset, Color color) const;
+
+ private:
+    std::vector<Vector2> vertices_;
+};
+
+}  // namespace udjourney
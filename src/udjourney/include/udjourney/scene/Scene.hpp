@@ -161,9 +161,24 @@ class Scene {
     virtual ~Scene() = default;
 
     // Load/Save
+    // Uses the compiled .udl next to a JSON level when it is up to date
     bool load_from_file(const std::string& filename);
+    bool load_from_json(const std::string& filename);
     bool save_to_file(const std::string& filename) const;
 
+    /**
+     * @brief Compiled level format (.udl), see SceneBinary.cpp
+     *
+     * Flat records plus one string table, read from a memory-mapped file
+     * without building a JSON document. Holds everything load_from_json
+     * reads, including backgrounds, HUDs and the game menu.
+     */
+    bool load_from_binary(const std::string& filename);
+    bool save_to_binary(const std::string& filename) const;
+
+    // "levels/foo.json" -> "levels/foo.udl"
+    static std::string compiled_path_for(const std::string& scene_file);
+
     // Getters
     const std::vector<PlatformData>& get_platforms() const {
         return m_platforms;
@@ -0,0 +1,56 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "udjourney/scene/Scene.hpp"
+
+namespace udjourney {
+namespace scene {
+
+/**
+ * @brief Every texture a scene loads while it runs (asset-relative paths)
+ *
+ * collect() follows the references of the scene through the JSON files they
+ * name: monster preset -> animation preset -> sprite sheets, HUD type
+ * defaults and overrides, background objects, and for levels the player
+ * animations, projectile presets and particle presets (plus their baked
+ * sheets). Only the reference keys are read, so
+ * the walk stays cheap and does not touch the GPU.
+ *
+ * The result can be cached next to the level JSON (cache_path_for) so the
+ * walk is skipped at load time. On the host, a cache older than the level
+ * JSON is ignored (load_cache_for).
+ */
+class SceneAssetManifest {
+ public:
+    static SceneAssetManifest collect(const Scene& scene);
+
+    // "levels/foo.json" -> "levels/foo.assets" (JSON, but kept out of the
+    // *.json scans of the level lists)
+    static std::string cache_path_for(const std::string& scene_file);
+
+    bool load_from_file(const std::string& filename);
+    // Load the cache of scene_file; false if missing, stale or unreadable
+    bool load_cache_for(const std::string& scene_file);
+    bool save_to_file(const std::string& filename) const;
+
+    // Sorted, without duplicates or empty paths
+    [[nodiscard]] const std::vector<std::string>& get_textures() const {
+        return m_textures;
+    }
+    void add_texture(const std::string& path);
+
+ private:
+    void add_animation_preset_(const std::string& animation_file);
+    void add_monster_preset_(const std::string& preset_name);
+    void add_hud_(const HUDData& hud);
+    void add_projectile_presets_(const std::string& config_file);
+    void add_particle_presets_(const std::string& config_file);
+
+    std::vector<std::string> m_textures;
+};
+
+}  // namespace scene
+}  // namespace udjourney
@@ -0,0 +1,84 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <raylib/raylib.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace udjourney::scene {
+
+class Scene;
+
+/**
+ * @brief Bit grid of world cells covered by static platforms
+ *
+ * Built once per scene load from the scene's Static platforms. Lookups are a
+ * single bit test, so systems with many small bodies (particles) can query
+ * the world without scanning actors.
+ */
+class TileOccupancyGrid {
+ public:
+    // A quarter tile, fine enough for thin (fractional) platforms
+    static constexpr float kCellSize = 8.0f;
+
+    /**
+     * @brief Rebuild the grid from the static platforms of a scene
+     */
+    void build(const Scene& scene);
+
+    /**
+     * @brief Mark every cell overlapped by a world rectangle as solid
+     *
+     * The grid must already cover the rectangle (see reset()).
+     */
+    void fill_rect(const Rectangle& world_rect);
+
+    /**
+     * @brief Mark every cell overlapped by a world rectangle as empty
+     *
+     * Cells shared with a neighbouring solid are cleared too; refill that
+     * neighbour with fill_rect() to keep it.
+     */
+    void clear_rect(const Rectangle& world_rect);
+
+    /**
+     * @brief Resize the grid to cover a world area and clear all cells
+     */
+    void reset(const Rectangle& world_area);
+
+    void clear();
+
+    /**
+     * @brief Check whether a world position lies in a solid cell
+     */
+    [[nodiscard]] bool is_solid(float world_x, float world_y) const {
+        const float fx = (world_x - origin_x_) * kInvCellSize;
+        const float fy = (world_y - origin_y_) * kInvCellSize;
+        if (fx < 0.0f || fy < 0.0f) return false;
+        const auto cx = static_cast<int>(fx);
+        const auto cy = static_cast<int>(fy);
+        if (cx >= cols_ || cy >= rows_) return false;
+        const int index = cy * cols_ + cx;
+        return (bits_[index >> 5] >> (index & 31)) & 1u;
+    }
+
+    [[nodiscard]] bool empty() const { return bits_.empty(); }
+    [[nodiscard]] int get_cols() const { return cols_; }
+    [[nodiscard]] int get_rows() const { return rows_; }
+
+ private:
+    static constexpr float kInvCellSize = 1.0f / kCellSize;
+
+    // Cells [x0, x1) x [y0, y1) overlapped by world_rect; false if none
+    bool cell_range_(const Rectangle& world_rect, int& x0, int& y0, int& x1,
+                     int& y1) const;
+
+    float origin_x_ = 0.0f;
+    float origin_y_ = 0.0f;
+    int cols_ = 0;
+    int rows_ = 0;
+    std::vector<uint32_t> bits_;
+};
+
+}  // namespace udjourney::scene
@@ -3,6 +3,7 @@
 #include <raylib/raylib.h>
 #include <string>
 #include <map>
+#include "udjourney/managers/TextureHandle.hpp"
 #include "udjourney/widgets/IWidget.hpp"
 #include "udjourney/scene/Scene.hpp"
 namespace udjourney {
@@ -26,6 +27,7 @@ class ButtonWidget : public IWidget {
      * @param hud HUD element containing button properties
      */
     ButtonWidget(const IGame& game, const udjourney::scene::HUDData& hud);
+    ~ButtonWidget() override;
 
     // IActor interface
     void draw() const override;
@@ -63,6 +65,7 @@ class ButtonWidget : public IWidget {
     Texture2D hover_texture_{0};
     Texture2D focused_texture_{0};
     Texture2D pressed_texture_{0};
+    TextureHandle sheet_handle_;  // Held while the button exists
 
     // Sprite sheet info (if using sheet)
     std::string sprite_sheet_path_;
@@ -62,7 +62,31 @@ class IWidget : public IActor {
     /**
      * @brief Set focus state
      */
-    virtual void set_focused(bool focused) { is_focused_ = focused; }
+    virtual void set_focused(bool focused) {
+        if (focused != is_focused_) {
+            request_redraw();
+        }
+        is_focused_ = focused;
+    }
+
+    /**
+     * @brief Check if the widget is animating and must be redrawn every frame
+     */
+    virtual bool is_animating() const { return false; }
+
+    /**
+     * @brief Flag the widget's appearance as changed since the last frame
+     */
+    void request_redraw() noexcept { redraw_requested_ = true; }
+
+    /**
+     * @brief Return and clear the redraw flag (used by idle UI throttling)
+     */
+    bool take_redraw_request() noexcept {
+        const bool requested = redraw_requested_;
+        redraw_requested_ = false;
+        return requested;
+    }
 
     /**
      * @brief Check if widget is selectable (can be navigated with keyboard)
@@ -79,7 +103,7 @@ class IWidget : public IActor {
     /**
      * @brief Get widget group ID (for querying)
      */
-    uint8_t get_group_id() const override { return 4; }  // WIDGET_TYPE_ID = 4
+    uint8_t get_group_id() const override { return WIDGET_TYPE_ID; }
 
  protected:
     std::string
@@ -87,5 +111,6 @@ class IWidget : public IActor {
     bool is_hovered_ = false;
     bool is_focused_ = false;
     bool is_selectable_ = true;  // By default, widgets are selectable
+    bool redraw_requested_ = true;  // Appearance changed since last frame
 };
 }  // namespace udjourney
@@ -58,6 +58,9 @@ class ScrollableListWidget : public IWidget {
     void draw() const override;
     void update(float delta) override;
     void process_input() override;
+    bool is_animating() const override {
+        return static_cast<float>(scroll_offset_) != scroll_animation_target_;
+    }
 
     bool contains_point(Vector2 point) const override;
 
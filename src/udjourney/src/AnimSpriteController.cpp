@@ -1,132 +1,101 @@
 // Copyright 2025 Quentin Cartier
 #include "udjourney/AnimSpriteController.hpp"
 
-#include <string>
+#include <memory>
 #include <utility>
 
+#include "udjourney/render/Draw.hpp"
+
 namespace udjourney {
 
 AnimSpriteController::AnimSpriteController() = default;
 
-void AnimSpriteController::add_animation(PlayerState state,
-                                         const std::string& name,
-                                         SpriteAnim animation) {
-    animations_[state] = std::move(animation);
-    using_player_state_ = true;
+AnimSpriteController::AnimSpriteController(
+    std::shared_ptr<const animation::ClipSet> clips) :
+    clips_(std::move(clips)) {
+    using_player_state_ = clips_ == nullptr || clips_->player_states;
+    restart_();
 }
 
-void AnimSpriteController::add_animation(int state, const std::string& name,
-                                         SpriteAnim animation) {
-    animations_int_[state] = std::move(animation);
-    using_player_state_ = false;
+void AnimSpriteController::restart_() {
+    if (!clips_) {
+        cursor_.reset(-1);
+        return;
+    }
+    cursor_.reset(clips_->find(using_player_state_
+                                   ? static_cast<int>(current_state_)
+                                   : current_state_int_));
 }
 
-void AnimSpriteController::add_animation(
-    int state, const std::string& name, SpriteAnim animation,
-    const animation::CollisionBounds& bounds) {
-    animations_int_[state] = std::move(animation);
-    collision_bounds_[state] = bounds;
-    using_player_state_ = false;
+const animation::AnimationClip* AnimSpriteController::current_clip_() const {
+    return cursor_.clip < 0 ? nullptr : &clips_->clips[cursor_.clip];
 }
 
 void AnimSpriteController::set_current_state(PlayerState state) {
     if (current_state_ != state) {
-        PlayerState old_state = current_state_;
-        previous_state_ = current_state_;
         current_state_ = state;
         using_player_state_ = true;
-        on_state_change(old_state, state);
+        restart_();  // Reset animation when state changes
     }
 }
 
 void AnimSpriteController::set_current_state(int state) {
     if (current_state_int_ != state) {
-        previous_state_int_ = current_state_int_;
         current_state_int_ = state;
         using_player_state_ = false;
-
-        // Reset animation when state changes
-        auto it = animations_int_.find(state);
-        if (it != animations_int_.end()) {
-            it->second.reset();
-        }
+        restart_();  // Reset animation when state changes
     }
 }
 
 void AnimSpriteController::update(float delta_time) {
-    if (using_player_state_) {
-        auto it = animations_.find(current_state_);
-        if (it != animations_.end()) {
-            it->second.update(delta_time);
-        }
-    } else {
-        auto it = animations_int_.find(current_state_int_);
-        if (it != animations_int_.end()) {
-            it->second.update(delta_time);
-        }
+    if (const auto* clip = current_clip_()) {
+        animation::advance(*clip, &cursor_, delta_time);
     }
 }
 
-void AnimSpriteController::draw(Rectangle dest_rect,
-                                bool flip_horizontal) const {
-    if (using_player_state_) {
-        auto it = animations_.find(current_state_);
-        if (it != animations_.end()) {
-            // Use the controller's facing direction unless explicitly
-            // overridden
-            bool should_flip = flip_horizontal || !facing_right_;
-            it->second.draw_with_dest(dest_rect, should_flip);
-        }
-    } else {
-        auto it = animations_int_.find(current_state_int_);
-        if (it != animations_int_.end()) {
-            bool should_flip = flip_horizontal || !facing_right_;
-            it->second.draw_with_dest(dest_rect, should_flip);
-        }
+void AnimSpriteController::draw(Rectangle dest_rect, bool flip_horizontal,
+                                SpriteBatch* batch, uint8_t layer) const {
+    const auto* clip = current_clip_();
+    if (!clip) {
+        return;
     }
-}
 
-void AnimSpriteController::on_state_change(PlayerState old_state,
-                                           PlayerState new_state) {
-    // Reset animation when state changes
-    auto it = animations_.find(new_state);
-    if (it != animations_.end()) {
-        it->second.reset();  // Reset to frame 0
+    Rectangle src_rect = clip->frame_rect(cursor_.frame);
+    // Use the controller's facing direction unless explicitly overridden
+    if (flip_horizontal || !facing_right_) {
+        src_rect.width = -src_rect.width;
     }
+
+    if (batch) {
+        batch->draw_texture(layer, clip->texture, src_rect, dest_rect);
+        return;
+    }
+    draw::texture_pro(clip->texture,
+                      src_rect,
+                      dest_rect,
+                      Vector2{0.0f, 0.0f},
+                      0.0f,
+                      WHITE);
 }
 
 bool AnimSpriteController::is_animation_finished() const {
-    if (using_player_state_) {
-        auto it = animations_.find(current_state_);
-        if (it != animations_.end()) {
-            return it->second.is_finished();
-        }
-    } else {
-        auto it = animations_int_.find(current_state_int_);
-        if (it != animations_int_.end()) {
-            return it->second.is_finished();
-        }
-    }
-    return false;
+    return current_clip_() != nullptr && cursor_.finished;
 }
 
 bool AnimSpriteController::has_collision_bounds() const {
     if (using_player_state_) {
         return false;  // Player states don't use this system yet
     }
-    auto it = collision_bounds_.find(current_state_int_);
-    return it != collision_bounds_.end() && it->second.is_valid();
+    const auto* clip = current_clip_();
+    return clip != nullptr && clip->collision_bounds.is_valid();
 }
 
 animation::CollisionBounds AnimSpriteController::get_collision_bounds() const {
-    if (using_player_state_) {
+    const auto* clip = current_clip_();
+    if (using_player_state_ || !clip) {
         return animation::CollisionBounds{};
     }
-    auto it = collision_bounds_.find(current_state_int_);
-    if (it != collision_bounds_.end()) {
-        return it->second;
-    }
-    return animation::CollisionBounds{};
+    return clip->collision_bounds;
 }
 
 }  // namespace udjourney
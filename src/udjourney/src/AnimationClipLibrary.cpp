@@ -0,0 +1,125 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/AnimationClipLibrary.hpp"
+
+#include <memory>
+#include <string>
+
+#include <udj-core/Logger.hpp>
+
+#include "udjourney/managers/TextureManager.hpp"
+
+namespace udjourney {
+namespace animation {
+
+ClipSet::~ClipSet() {
+    auto& texture_manager = TextureManager::get_instance();
+    for (const TextureHandle handle : textures) {
+        texture_manager.release(handle);
+    }
+}
+
+int ClipSet::find(int state_id) const noexcept {
+    for (size_t i = 0; i < clips.size(); ++i) {
+        if (clips[i].state_id == state_id) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void advance(const AnimationClip& clip, PlaybackCursor* cursor,
+             float delta_time) noexcept {
+    if (cursor->finished) return;
+
+    cursor->elapsed += delta_time;
+    if (cursor->elapsed >= clip.frame_time) {
+        cursor->elapsed = 0.0f;
+        cursor->frame++;
+        if (cursor->frame >= clip.frame_count) {
+            if (clip.loop) {
+                cursor->frame = 0;
+            } else {
+                cursor->frame = clip.frame_count - 1;
+                cursor->finished = true;
+            }
+        }
+    }
+}
+
+AnimationClipLibrary& AnimationClipLibrary::get_instance() {
+    // Constructed first so it outlives the sets releasing into it at exit
+    TextureManager::get_instance();
+    static AnimationClipLibrary instance;
+    return instance;
+}
+
+std::shared_ptr<const ClipSet> AnimationClipLibrary::find(
+    const std::string& path) const {
+    auto iter = sets_.find(path);
+    return iter == sets_.end() ? nullptr : iter->second;
+}
+
+std::shared_ptr<const ClipSet> AnimationClipLibrary::add(
+    const std::string& path, const AnimationPresetConfig& config) {
+    auto set = build(config);
+    sets_[path] = set;
+    return set;
+}
+
+std::shared_ptr<const ClipSet> AnimationClipLibrary::build(
+    const AnimationPresetConfig& config) {
+    auto set = std::make_shared<ClipSet>();
+    set->clips.reserve(config.animations.size());
+    set->textures.reserve(config.animations.size());
+    set->player_states = !config.animations.empty();
+    auto& texture_manager = TextureManager::get_instance();
+
+    for (const auto& anim_config : config.animations) {
+        const auto& sprite_cfg = anim_config.sprite_config;
+
+        // Held while the set lives: every actor of this preset draws from
+        // it. A packed sheet resolves to its atlas page.
+        const TextureRegion region =
+            texture_manager.get_region(sprite_cfg.filename);
+
+        // Frames are taken as a run starting at the first listed one
+        int start_row = 0;
+        int start_col = 0;
+        if (!sprite_cfg.frames.empty()) {
+            start_row = sprite_cfg.frames[0].row;
+            start_col = sprite_cfg.frames[0].col;
+        }
+
+        AnimationClip& clip = set->clips.emplace_back();
+        clip.state_id = anim_config.state_id;
+        clip.texture = texture_manager.acquire(region.handle);
+        set->textures.push_back(region.handle);
+        clip.first_frame = region.map(
+            Rectangle{static_cast<float>(start_col * sprite_cfg.sprite_width),
+                      static_cast<float>(start_row * sprite_cfg.sprite_height),
+                      static_cast<float>(sprite_cfg.sprite_width),
+                      static_cast<float>(sprite_cfg.sprite_height)});
+        clip.frame_count = static_cast<int>(sprite_cfg.frames.size());
+        clip.frame_time = sprite_cfg.frame_duration;
+        clip.loop = sprite_cfg.loop;
+        clip.collision_bounds = anim_config.collision_bounds;
+
+        // PlayerState covers IDLE=0 .. FALLING=4; anything else is a
+        // generic (monster) state
+        set->player_states = set->player_states &&
+                             anim_config.state_id >= 0 &&
+                             anim_config.state_id <= 4;
+
+        udj::core::Logger::debug(
+            "Built clip '%' (state %) with % frames from row %, col %",
+            anim_config.name,
+            anim_config.state_id,
+            clip.frame_count,
+            start_row,
+            start_col);
+    }
+    return set;
+}
+
+}  // namespace animation
+}  // namespace udjourney
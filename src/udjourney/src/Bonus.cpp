@@ -2,6 +2,9 @@
 
 #include "udjourney/Bonus.hpp"
 
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
+
 namespace udjourney {
 
 Bonus::Bonus(const IGame &iGame, Rectangle iRect) :
@@ -19,7 +22,15 @@ void Bonus::draw() const {
     auto rotation = static_cast<float>(GetTime() * 30.0);
 
     // Draw rotated rectangle
-    DrawRectanglePro(rect, origin, rotation, YELLOW);
+    if (SpriteBatch *batch = game.get_sprite_batch()) {
+        batch->draw_rect(SpriteBatch::layer(RenderLayer::Actors),
+                         rect,
+                         YELLOW,
+                         origin,
+                         rotation);
+    } else {
+        draw::rectangle_pro(rect, origin, rotation, YELLOW);
+    }
 }
 
 void Bonus::update(float iDelta) {
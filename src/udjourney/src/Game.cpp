@@ -10,6 +10,8 @@
 #include <array>
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
+#include <ctime>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -23,13 +25,14 @@
 
 #include <udj-core/CoreUtils.hpp>
 #include <udj-core/Logger.hpp>
+#include <udj-core/Random.hpp>
 
 #include "udjourney/Bonus.hpp"
 #include "udjourney/Monster.hpp"
 #include "udjourney/Player.hpp"
 #include "udjourney/Projectile.hpp"
 #include "udjourney/AnimSpriteController.hpp"
-#include "udjourney/SpriteAnim.hpp"
+#include "udjourney/AnimationClipLibrary.hpp"
 #include "udjourney/ScoreHistory.hpp"
 #include "udjourney/core/events/ScoreEvent.hpp"
 #include "udjourney/core/events/WeaponSelectedEvent.hpp"
@@ -44,13 +47,18 @@
 #include "udjourney/factories/UiFactory.hpp"
 #include "udjourney/hud/GameMenuHUD.hpp"
 #include "udjourney/hud/LevelSelectHUD.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/DrawStats.hpp"
 #include "udjourney/render/StateRenderers.hpp"
+#include "udjourney/scene/SceneAssetManifest.hpp"
 #include "udjourney/hud/scene/ScoreDisplayHUD.hpp"
 #include "udjourney/hud/scene/HeartHealthHUD.hpp"
 #include "udjourney/hud/scene/WeaponHUD.hpp"
 #include "udjourney/interfaces/IActor.hpp"
 #include "udjourney/managers/TextureManager.hpp"
 #include "udjourney/loaders/AnimationConfigLoader.hpp"
+#include "udjourney/loaders/MonsterPresetRegistry.hpp"
+#include "udjourney/loaders/PresetBundle.hpp"
 #include "udjourney/platform/Platform.hpp"
 #include "udjourney/platform/behavior_strategies/CameraFollowVerticalBehaviorStrategy.hpp"
 #include "udjourney/platform/behavior_strategies/EightTurnHorizontalBehaviorStrategy.hpp"
@@ -89,12 +97,6 @@ const std::vector<Resolution> kResolutions = {{640, 480, "640x480"},
 
 int current_resolution_idx = 0;  // Default to first resolution
 
-enum class ActorType : uint8_t {
-    PLAYER = 0,
-    PLATFORM = 1,
-    BONUS = 2,
-};
-
 namespace {
 struct InputMapping {
     std::function<bool()> pressed_start;
@@ -114,6 +116,15 @@ struct InputMapping {
     }
 } input_mapping;
 
+// Platforms the static tile grid is built from (TileOccupancyGrid::build)
+bool is_static_platform(const IActor &actor) {
+    if (actor.get_group_id() != PLATFORM_TYPE_ID) {
+        return false;
+    }
+    const auto *behavior = static_cast<const Platform &>(actor).get_behavior();
+    return behavior && behavior->get_type() == PlatformBehaviorType::Static;
+}
+
 // Helper function to create player animation controller from JSON
 AnimSpriteController create_player_animation_controller() {
     std::string config_path =
@@ -122,9 +133,39 @@ AnimSpriteController create_player_animation_controller() {
         config_path);
 }
 
+// True if any key, mouse or pad button went down since the last poll
+bool any_input_pressed() {
+    bool pressed = false;
+#ifndef PLATFORM_DREAMCAST
+    // Drain the key queue; nothing else in the game reads it
+    while (GetKeyPressed() != 0) {
+        pressed = true;
+    }
+    pressed = pressed || IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+#endif
+    if (IsGamepadAvailable(0)) {
+        for (int button = GAMEPAD_BUTTON_LEFT_FACE_UP;
+             button <= GAMEPAD_BUTTON_RIGHT_THUMB && !pressed;
+             ++button) {
+            pressed = IsGamepadButtonPressed(0, button);
+        }
+    }
+    return pressed;
+}
+
 }  // namespace
 
 const double kUpdateInterval = 0.0001;
+// Idle UI screens poll input at this rate instead of redrawing
+const double kUiIdlePollInterval = 1.0 / 60.0;
+// ...and still refresh the window this often (expose, compositor)
+const double kUiIdleRedrawInterval = 0.5;
+// Main-thread time per frame for uploading background-decoded textures
+const double kTextureUploadBudget = 0.002;
+// Upload slice between two progress frames while preloading a scene
+const double kPreloadUploadBudget = 1.0 / 60.0;
+// Upper bound for animation steps after idle frames skipped EndDrawing
+const float kMaxFrameTime = 0.1F;
 bool is_running = true;
 // player is now a member of Game class, not a global
 
@@ -142,17 +183,21 @@ std::vector<std::unique_ptr<IActor>> init_platforms(const Game &iGame) {
     const int kStepY = 100;
     const int kMaxY = 800;
 
+    auto &rng = udj::core::RngService::get_instance().stream(
+        udj::core::RngStream::Platforms);
+
     for (int cur_pos_y = 0; cur_pos_y < kMaxY; cur_pos_y += kStepY) {
         Rectangle rect{static_cast<float>(lastx),
                        static_cast<float>(cur_pos_y),
                        static_cast<float>(lastx2),
                        5};
-        int random_number = std::rand();
+        // Non-negative, like std::rand()
+        int random_number = static_cast<int>(rng.next_u32() >> 1);
         lastx = (random_number % 10) * kOffsetPosXMin;
         lastx2 = random_number % kMaxWidth + kOffsetPosXMin;
 
-        auto ra2 = std::rand();
-        if (ra2 % 100 < 20) {
+        auto ra2 = rng.range_int(0, 99);
+        if (ra2 < 20) {
             // 5% EightTurnHorizontalBehaviorStrategy, use ORANGE color
             res.emplace_back(std::make_unique<Platform>(
                 iGame,
@@ -175,7 +220,7 @@ std::vector<std::unique_ptr<IActor>> init_platforms(const Game &iGame) {
                 BLUE,
                 false,
                 std::make_unique<RandomizePositionStrategy>()));
-            if (ra2 % 100 < 25) {
+            if (ra2 < 25) {
                 // 20% HorizontalBehaviorStrategy
                 float speed_x =
                     static_cast<float>(std::max(5, random_number % 30));
@@ -184,23 +229,22 @@ std::vector<std::unique_ptr<IActor>> init_platforms(const Game &iGame) {
                 static_cast<Platform *>(res.back().get())
                     ->set_behavior(std::make_unique<HorizontalBehaviorStrategy>(
                         speed_x, max_offset));
-                if (std::rand() % 100 < 80) {
+                if (rng.range_int(0, 99) < 80) {
                     static_cast<Platform *>(res.back().get())
                         ->add_feature(
                             std::move(std::make_unique<SpikeFeature>()));
                 }
-            } else if (ra2 % 100 < 45) {
+            } else if (ra2 < 45) {
                 // 20% OscillatingSizeBehaviorStrategy
                 float speed_x =
                     static_cast<float>(std::max(5, random_number % 30));
                 const int kShrinkMinOffset = -100;
                 const int kShrinkMaxOffset = 150;
-                int min_offset =
-                    kShrinkMinOffset +
-                    (std::rand() %
-                     (1 + std::abs(kShrinkMinOffset)));  // -100 to 0
-                int max_offset =
-                    std::rand() % (kShrinkMaxOffset + 1);  // 0 to 150
+                // -100 to 0
+                int min_offset = kShrinkMinOffset +
+                                 rng.range_int(0, std::abs(kShrinkMinOffset));
+                // 0 to 150
+                int max_offset = rng.range_int(0, kShrinkMaxOffset);
                 static_cast<Platform *>(res.back().get())
                     ->set_behavior(
                         std::make_unique<OscillatingSizeBehaviorStrategy>(
@@ -218,6 +262,20 @@ std::vector<std::unique_ptr<IActor>> init_platforms(const Game &iGame) {
 }
 
 Game::Game(int iWidth, int iHeight) : IGame() {
+    // Seed every random stream once. UDJ_SEED replays a previous run.
+    const char *seed_env = std::getenv("UDJ_SEED");
+    const uint64_t seed = seed_env ? std::strtoull(seed_env, nullptr, 10)
+                                   : static_cast<uint64_t>(std::time(nullptr));
+    udj::core::RngService::get_instance().seed(seed);
+    udj::core::Logger::info("Random seed: %", seed);
+
+#ifndef PLATFORM_DREAMCAST
+    // UDJ_OFFSCREEN=1|2 renders at a fixed resolution and upscales once
+    if (const char *offscreen_env = std::getenv("UDJ_OFFSCREEN")) {
+        m_offscreen_scale = std::clamp(std::atoi(offscreen_env), 0, 2);
+    }
+#endif
+
     m_rect = Rectangle{
         0, 0, static_cast<float>(iWidth), static_cast<float>(iHeight)};
     m_actors.reserve(10);
@@ -233,10 +291,24 @@ Game::Game(int iWidth, int iHeight) : IGame() {
     // Initialize state renderers
     init_state_renderers_();
 
+    // Cooked atlases (udj-atlas-packer), before any preset resolves a sheet
+    if (!TextureManager::get_instance().load_atlas_map(
+            "atlases/atlas_map.json")) {
+        udj::core::Logger::info("No atlas map: sheets load individually");
+    }
+
+    // Cooked presets (udj-preset-bundler); the loaders fall back to JSON
+    if (!udjourney::loaders::PresetBundle::get_instance().load_from_path(
+            udjourney::coreutils::get_assets_path(
+                udjourney::loaders::PresetBundle::kDefaultPath))) {
+        udj::core::Logger::info("No preset bundle: presets load from JSON");
+    }
+
     // Load particle presets
     if (!m_particle_manager.load_presets("particles.json")) {
         udj::core::Logger::warning("Warning: Could not load particles.json");
     }
+    m_particle_manager.set_world_grid(&m_static_tile_grid);
 
     // Load title screen scene
     if (!load_scene(udjourney::coreutils::get_assets_path(
@@ -260,6 +332,7 @@ void Game::run() {
     create_huds_from_scene();
     SetTargetFPS(60);
     m_last_update_time = GetTime();
+    m_last_input_poll_time = m_last_update_time;
 
     while (is_running) {
         update();
@@ -283,7 +356,34 @@ void Game::remove_actor(IActor *actor) {
                              return actor2.get() == actor;
                          });
         if (iter != m_actors.end()) {
+            const Rectangle rect = actor->get_rectangle();
+            const bool static_platform = is_static_platform(*actor);
+            // A consumed baked platform is still in its cached chunk
+            if (static_platform &&
+                static_cast<Platform *>(actor)->is_baked()) {
+                m_static_chunks.mark_dirty(rect);
+            }
             m_actors.erase(iter);
+            // Particles would otherwise keep bouncing off it
+            if (static_platform) {
+                remove_static_platform_cells_(rect);
+            }
+        }
+    }
+}
+
+void Game::remove_static_platform_cells_(const Rectangle &world_rect) {
+    m_static_tile_grid.clear_rect(world_rect);
+    // Refill the edge cells shared with the static platforms left around it
+    constexpr float kCell = scene::TileOccupancyGrid::kCellSize;
+    const Rectangle shared{world_rect.x - kCell,
+                           world_rect.y - kCell,
+                           world_rect.width + 2.0f * kCell,
+                           world_rect.height + 2.0f * kCell};
+    for (const auto &actor : m_actors) {
+        if (is_static_platform(*actor) &&
+            CheckCollisionRecs(actor->get_rectangle(), shared)) {
+            m_static_tile_grid.fill_rect(actor->get_rectangle());
         }
     }
 }
@@ -308,6 +408,23 @@ void Game::process_input() {
         SetWindowSize(kResolutions[current_resolution_idx].width,
                       kResolutions[current_resolution_idx].height);
     }
+    // Press F3 to toggle sprite batch statistics
+    if (IsKeyPressed(KEY_F3)) {
+        m_show_render_stats = !m_show_render_stats;
+    }
+    // Press F4 to cycle direct / offscreen 1x / offscreen 2x rendering
+    if (IsKeyPressed(KEY_F4)) {
+        set_offscreen_scale_((m_offscreen_scale + 1) % 3);
+    }
+    // Press F5 to re-read edited monster and animation presets (applies to
+    // new spawns)
+    if (IsKeyPressed(KEY_F5)) {
+        udjourney::loaders::PresetBundle::get_instance().clear();
+        MonsterPresetRegistry::get_instance().clear();
+        animation::AnimationClipLibrary::get_instance().clear();
+        udj::core::Logger::info(
+            "Monster and animation presets will reload from JSON");
+    }
 #endif
 
     // Press 'B' to quit
@@ -360,6 +477,12 @@ void Game::clear_scene() {
     // Clear background HUDs
     m_hud_manager.clear_background_huds();
 
+    m_static_chunks.clear();
+    m_frozen_frame_valid = false;
+    // The previous level's textures become evictable (kept while in budget)
+    TextureManager::get_instance().unpin_all();
+    // Clip sheets are released once no remaining actor plays their set
+    animation::AnimationClipLibrary::get_instance().clear();
     m_actors.clear();
     m_pending_actors.clear();
     m_updating_actors = false;
@@ -420,6 +543,7 @@ void Game::apply_current_scene(SceneApplyMode mode) {
 
     // Gameplay scenes: world + UI
     if (resolved == SceneApplyMode::Gameplay) {
+        preload_scene_assets_();
         initialize_gameplay();
         return;
     }
@@ -437,6 +561,81 @@ void Game::apply_current_scene(SceneApplyMode mode) {
     create_huds_from_scene();
 }
 
+/**
+ * Loads every texture the current scene will use and pins it until the next
+ * clear_scene(), so nothing is loaded on first use during play. Decoding
+ * runs on the TextureManager worker; a progress bar is presented while the
+ * uploads land.
+ */
+void Game::preload_scene_assets_() {
+    // Uploads need the GL context (the first scene loads before InitWindow)
+    if (!m_current_scene || !IsWindowReady()) {
+        return;
+    }
+
+    const double start = GetTime();
+    scene::SceneAssetManifest manifest;
+    if (!manifest.load_cache_for(m_current_scene_filename)) {
+        manifest = scene::SceneAssetManifest::collect(*m_current_scene);
+    }
+
+    auto &texture_manager = TextureManager::get_instance();
+    std::vector<TextureHandle> handles;
+    handles.reserve(manifest.get_textures().size());
+    for (const auto &path : manifest.get_textures()) {
+        // Packed sheets preload the atlas page that holds them
+        const TextureHandle handle = texture_manager.get_region(path).handle;
+        texture_manager.pin(handle);
+        texture_manager.request(handle);
+        handles.push_back(handle);
+    }
+
+    size_t ready = 0;
+    while (true) {
+        const size_t uploaded =
+            texture_manager.pump_uploads(kPreloadUploadBudget);
+        ready = static_cast<size_t>(
+            std::count_if(handles.begin(),
+                          handles.end(),
+                          [&texture_manager](TextureHandle handle) {
+                              return texture_manager.is_ready(handle);
+                          }));
+        // Closing the window mid-load must not spin until every upload lands
+        if (ready == handles.size() || WindowShouldClose()) {
+            break;
+        }
+        draw_preload_progress_(ready, handles.size());
+        if (uploaded == 0) {
+            WaitTime(0.001);  // Worker still decoding
+        }
+    }
+
+    udj::core::Logger::info("Preloaded % scene textures in % ms",
+                            handles.size(),
+                            static_cast<int>((GetTime() - start) * 1000.0));
+}
+
+void Game::draw_preload_progress_(size_t done, size_t total) const {
+    const float width = static_cast<float>(GetScreenWidth());
+    const float height = static_cast<float>(GetScreenHeight());
+    const float fraction =
+        total > 0 ? static_cast<float>(done) / static_cast<float>(total)
+                  : 1.0f;
+    const Rectangle bar{width * 0.2f, height * 0.5f, width * 0.6f, 12.0f};
+
+    BeginDrawing();
+    ClearBackground(BLACK);
+    draw::text("Loading...",
+               static_cast<int>(bar.x),
+               static_cast<int>(bar.y) - 24,
+               16,
+               RAYWHITE);
+    draw::rectangle_lines_ex(bar, 1.0f, RAYWHITE);
+    draw::rectangle_rec(
+        Rectangle{bar.x, bar.y, bar.width * fraction, bar.height}, RAYWHITE);
+    EndDrawing();
+}
+
 /**
  * Loads a scene from the specified filename and applies it immediately.
  * Returns true if the scene was loaded and applied successfully, false
@@ -479,20 +678,20 @@ void Game::draw_finish_line_() const {
             line_thickness};
 
         // Draw the main pink line
-        DrawRectangleRec(finish_line, MAGENTA);
+        draw::rectangle_rec(finish_line, MAGENTA);
 
         // Add some visual flair with a slight glow effect
-        DrawRectangleLinesEx(finish_line, 1.0f, PINK);
+        draw::rectangle_lines_ex(finish_line, 1.0f, PINK);
 
         // Add text label if line is visible in a reasonable area
         if (line_y >= 50 && line_y <= game_rect.height - 50) {
             const char *finish_text = "FINISH LINE";
-            int text_width = MeasureText(finish_text, 16);
-            DrawText(finish_text,
-                     static_cast<int>(game_rect.width - text_width - 10),
-                     static_cast<int>(line_y - 25),
-                     16,
-                     MAGENTA);
+            int text_width = draw::measure_text(finish_text, 16);
+            draw::text(finish_text,
+                       static_cast<int>(game_rect.width - text_width - 10),
+                       static_cast<int>(line_y - 25),
+                       16,
+                       MAGENTA);
         }
     }
 }
@@ -532,33 +731,38 @@ void Game::draw_backgrounds_() const {
     m_background_manager.draw(m_rect.y,
                               use_ui_scroll,
                               static_cast<float>(kBaseWidth),
-                              static_cast<float>(kBaseHeight));
+                              static_cast<float>(kBaseHeight),
+                              &m_sprite_batch);
 }
 
-void Game::draw_huds_() const {
+void Game::prepare_huds_() const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Hud);
+    // Scene HUDs cache their rendering at window resolution
+    float scale = static_cast<float>(m_offscreen_scale);
+    if (m_offscreen_scale == 0) {
+        scale = std::min(GetScreenWidth() / static_cast<float>(kBaseWidth),
+                         GetScreenHeight() / static_cast<float>(kBaseHeight));
+    }
     for (const auto &hud : m_scene_huds) {
         if (hud) {
-            hud->draw();
+            hud->prepare(scale);
         }
     }
 }
 
-void Game::draw() const {
-    BeginDrawing();
-    ClearBackground(SKYBLUE);  // Clear the background with a blue sky color
-
-    // Calculate viewport transform
-    float scale_x = GetScreenWidth() / static_cast<float>(kBaseWidth);
-    float scale_y = GetScreenHeight() / static_cast<float>(kBaseHeight);
-    float scale = std::min(scale_x, scale_y);  // Uniform scaling
-
-    float offset_x = (GetScreenWidth() - kBaseWidth * scale) * 0.5F;
-    float offset_y = (GetScreenHeight() - kBaseHeight * scale) * 0.5F;
-
-    rlPushMatrix();
-    rlTranslatef(offset_x, offset_y, 0);
-    rlScalef(scale, scale, 1.0F);
+void Game::draw_huds_() const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Hud);
+    // One batch pass per HUD, so its text lands on top of its own panel
+    for (const auto &hud : m_scene_huds) {
+        if (hud) {
+            m_sprite_batch.begin();
+            hud->draw(&m_sprite_batch);
+            m_sprite_batch.flush();
+        }
+    }
+}
 
+void Game::draw_logical_frame_() const {
     // Delegate rendering to current state renderer
     auto it = m_state_renderers.find(m_state);
     if (it != m_state_renderers.end()) {
@@ -566,7 +770,7 @@ void Game::draw() const {
     }
 
     // Always draw HUD manager on top
-    m_hud_manager.draw();
+    m_hud_manager.draw(&m_sprite_batch);
 
     // Draw FUDs (Fixed UI Displays) from current scene
     // Skip for states that handle their own FUD/widget drawing
@@ -574,41 +778,244 @@ void Game::draw() const {
         m_state != GameState::GAMEOVER && m_state != GameState::WIN) {
         draw_huds_();
     }
+}
+
+void Game::set_offscreen_scale_(int scale) {
+    if (m_offscreen_target.id != 0) {
+        UnloadRenderTexture(m_offscreen_target);
+        m_offscreen_target = RenderTexture2D{};
+    }
+    m_offscreen_scale = scale;
+    udj::core::Logger::info("Offscreen rendering: %",
+                            scale == 0 ? std::string("off")
+                                       : std::to_string(scale) + "x");
+}
 
+void Game::present_offscreen_() const {
+    const Texture2D &frame = m_offscreen_target.texture;
+
+    // Largest integer multiple of the logical size that fits; windows
+    // smaller than 640x480 fall back to a fractional (nearest) downscale
+    const float fit =
+        std::min(GetScreenWidth() / static_cast<float>(kBaseWidth),
+                 GetScreenHeight() / static_cast<float>(kBaseHeight));
+    const float scale = fit >= 1.0F ? std::floor(fit) : fit;
+
+    const float width = kBaseWidth * scale;
+    const float height = kBaseHeight * scale;
+    const Rectangle dest = {std::floor((GetScreenWidth() - width) * 0.5F),
+                            std::floor((GetScreenHeight() - height) * 0.5F),
+                            width,
+                            height};
+
+    // Render textures are stored bottom-up, hence the flipped source
+    const Rectangle source = {0.0F,
+                              0.0F,
+                              static_cast<float>(frame.width),
+                              -static_cast<float>(frame.height)};
+    draw::texture_pro(frame, source, dest, Vector2{0.0F, 0.0F}, 0.0F, WHITE);
+}
+
+void Game::capture_frozen_frame_() const {
+    const int scale = std::max(1, m_offscreen_scale);
+    const int width = kBaseWidth * scale;
+    const int height = kBaseHeight * scale;
+    if (m_frozen_frame.id != 0 && m_frozen_frame.texture.width != width) {
+        UnloadRenderTexture(m_frozen_frame);
+        m_frozen_frame = RenderTexture2D{};
+    }
+    if (m_frozen_frame.id == 0) {
+        m_frozen_frame = LoadRenderTexture(width, height);
+        if (m_frozen_frame.id == 0) {
+            return;  // Pause renderer falls back to drawing the scene live
+        }
+        SetTextureFilter(m_frozen_frame.texture, TEXTURE_FILTER_POINT);
+    }
+
+    BeginTextureMode(m_frozen_frame);
+    ClearBackground(SKYBLUE);
+    rlPushMatrix();
+    rlScalef(static_cast<float>(scale), static_cast<float>(scale), 1.0F);
+    PlayStateRenderer{}.render(*this);
     rlPopMatrix();
+    EndTextureMode();
+
+    m_frozen_frame_valid = true;
+}
 
-    // Draw left and right borders
-    // Left border (from screen left to game area left)
-    if (offset_x > 0) {
-        DrawRectangle(
-            0, 0, static_cast<int>(offset_x), GetScreenHeight(), BLACK);
+void Game::draw() const {
+    // Background strips, chunk baking and the frozen frame use render
+    // texture mode, which cannot nest in the viewport transform below
+    m_background_manager.prepare();
+    if (m_state == GameState::PLAY || m_state == GameState::PAUSE) {
+        m_static_chunks.prepare(m_actors, m_rect);
     }
-    // Right border (from game area right to screen right)
-    if (offset_x > 0) {
-        DrawRectangle(static_cast<int>(offset_x + kBaseWidth * scale),
-                      0,
-                      static_cast<int>(offset_x + 1),
-                      GetScreenHeight(),
-                      BLACK);
+    if (m_current_scene && m_state != GameState::TITLE &&
+        m_state != GameState::GAMEOVER && m_state != GameState::WIN) {
+        prepare_huds_();
+    }
+#ifndef PLATFORM_DREAMCAST
+    // Paused and menu states draw their overlays over the last gameplay
+    // frame instead of re-rendering the world every frame
+    if (m_state != GameState::PAUSE) {
+        m_frozen_frame_valid = false;
+    } else if (!m_frozen_frame_valid) {
+        capture_frozen_frame_();
+    }
+#endif
+
+    if (m_offscreen_scale > 0 && m_offscreen_target.id == 0) {
+        m_offscreen_target = LoadRenderTexture(kBaseWidth * m_offscreen_scale,
+                                               kBaseHeight * m_offscreen_scale);
+        SetTextureFilter(m_offscreen_target.texture, TEXTURE_FILTER_POINT);
+    }
+    const bool offscreen =
+        m_offscreen_scale > 0 && m_offscreen_target.id != 0;
+
+    if (offscreen) {
+        // Fill cost is fixed by the target size, whatever the window size
+        BeginTextureMode(m_offscreen_target);
+        ClearBackground(SKYBLUE);
+        rlPushMatrix();
+        rlScalef(static_cast<float>(m_offscreen_scale),
+                 static_cast<float>(m_offscreen_scale),
+                 1.0F);
+        draw_logical_frame_();
+        rlPopMatrix();
+        EndTextureMode();
+
+        BeginDrawing();
+        ClearBackground(BLACK);  // Letterbox
+        present_offscreen_();
+    } else {
+        BeginDrawing();
+        ClearBackground(SKYBLUE);  // Clear the background with a blue sky color
+
+        // Calculate viewport transform
+        float scale_x = GetScreenWidth() / static_cast<float>(kBaseWidth);
+        float scale_y = GetScreenHeight() / static_cast<float>(kBaseHeight);
+        float scale = std::min(scale_x, scale_y);  // Uniform scaling
+
+        float offset_x = (GetScreenWidth() - kBaseWidth * scale) * 0.5F;
+        float offset_y = (GetScreenHeight() - kBaseHeight * scale) * 0.5F;
+
+        rlPushMatrix();
+        rlTranslatef(offset_x, offset_y, 0);
+        rlScalef(scale, scale, 1.0F);
+
+        draw_logical_frame_();
+
+        rlPopMatrix();
+
+        // Draw left and right borders
+        // Left border (from screen left to game area left)
+        if (offset_x > 0) {
+            draw::rectangle(
+                0, 0, static_cast<int>(offset_x), GetScreenHeight(), BLACK);
+        }
+        // Right border (from game area right to screen right)
+        if (offset_x > 0) {
+            draw::rectangle(static_cast<int>(offset_x + kBaseWidth * scale),
+                            0,
+                            static_cast<int>(offset_x + 1),
+                            GetScreenHeight(),
+                            BLACK);
+        }
     }
 
     DrawText(kResolutions[current_resolution_idx].label, 10, 10, 20, YELLOW);
 
+    m_sprite_batch.end_frame();
+    DrawStats::end_frame();
+    if (m_show_render_stats) {
+        const auto &stats = m_sprite_batch.get_frame_stats();
+        DrawText(TextFormat("sprites %d  draws %d  binds %d",
+                            static_cast<int>(stats.sprites),
+                            static_cast<int>(stats.draw_calls),
+                            static_cast<int>(stats.texture_binds)),
+                 10,
+                 34,
+                 20,
+                 YELLOW);
+
+        // Instrumented draw calls: frame total, then one line per subsystem
+        const auto total = DrawStats::get_frame_total();
+        DrawText(TextFormat("calls %d  verts %d  tex %d",
+                            static_cast<int>(total.calls),
+                            static_cast<int>(total.vertices),
+                            static_cast<int>(total.texture_changes)),
+                 10,
+                 56,
+                 20,
+                 YELLOW);
+        // Input poll to frame present, over the last presses
+        DrawText(TextFormat("input p50 %.1f  p95 %.1f  last %.1f ms",
+                            m_input_latency.get_percentile_ms(50.0f),
+                            m_input_latency.get_percentile_ms(95.0f),
+                            m_input_latency.get_last_ms()),
+                 10,
+                 78,
+                 20,
+                 YELLOW);
+        const auto &textures = TextureManager::get_instance();
+        DrawText(TextFormat("textures %d  %d / %d KB",
+                            static_cast<int>(textures.get_resident_count()),
+                            static_cast<int>(textures.get_resident_bytes() /
+                                             1024u),
+                            static_cast<int>(textures.get_budget_bytes() /
+                                             1024u)),
+                 10,
+                 100,
+                 20,
+                 YELLOW);
+        int line_y = 122;
+        for (size_t i = 0; i < static_cast<size_t>(DrawSubsystem::Count);
+             ++i) {
+            const auto subsystem = static_cast<DrawSubsystem>(i);
+            const auto &counters = DrawStats::get_frame(subsystem);
+            if (counters.calls == 0) {
+                continue;
+            }
+            DrawText(TextFormat("%-11s %4d %6d %4d",
+                                DrawStats::get_name(subsystem),
+                                static_cast<int>(counters.calls),
+                                static_cast<int>(counters.vertices),
+                                static_cast<int>(counters.texture_changes)),
+                     10,
+                     line_y,
+                     10,
+                     YELLOW);
+            line_y += 12;
+        }
+    }
+
+    // EndDrawing swaps, waits for the target frame rate and then polls the
+    // events the next update() sees, so one timestamp after it returns is
+    // both this frame's present and the next frame's input poll
     EndDrawing();
+    m_last_input_poll_time = GetTime();
+    m_input_latency.mark_present(m_last_input_poll_time);
 }
 
 void Game::update() {
     static double last_update_time = 0.0;
+    // Idle UI frames do not call EndDrawing, so the first frame after them
+    // reports the whole idle gap
+    const float frame_time = std::min(GetFrameTime(), kMaxFrameTime);
+
+    if (any_input_pressed()) {
+        m_input_latency.mark_input(m_last_input_poll_time);
+    }
 
     // Update background scroll for UI screens
     if (m_current_scene &&
         m_current_scene->get_type() == udjourney::scene::SceneType::UiScreen) {
-        m_background_manager.update_ui_scroll(GetFrameTime(),
+        m_background_manager.update_ui_scroll(frame_time,
                                               static_cast<float>(kBaseHeight));
     }
 
     // Update particle system
-    m_particle_manager.update(GetFrameTime());
+    m_particle_manager.update(frame_time);
 
     // Widget input handling for TITLE, WIN, and GAMEOVER states
     if (m_state == GameState::TITLE || m_state == GameState::WIN ||
@@ -623,7 +1030,7 @@ void Game::update() {
             std::vector<IWidget *> widgets;
             for (const auto &actor : m_actors) {
                 if (!actor) continue;
-                if (actor->get_group_id() == 4) {
+                if (actor->get_group_id() == WIDGET_TYPE_ID) {
                     IWidget *widget = static_cast<IWidget *>(actor.get());
                     if (widget && widget->is_selectable()) {
                         widgets.push_back(widget);
@@ -660,7 +1067,7 @@ void Game::update() {
                 std::vector<IWidget *> widgets;
                 for (const auto &actor : m_actors) {
                     if (!actor) continue;
-                    if (actor->get_group_id() == 4) {
+                    if (actor->get_group_id() == WIDGET_TYPE_ID) {
                         IWidget *widget = static_cast<IWidget *>(actor.get());
                         if (widget && widget->is_selectable()) {
                             widgets.push_back(widget);
@@ -695,7 +1102,7 @@ void Game::update() {
                     bool list_input_handled = false;
                     for (auto &actor : m_actors) {
                         if (!actor) continue;
-                        if (actor->get_group_id() == 4) {
+                        if (actor->get_group_id() == WIDGET_TYPE_ID) {
                             if (auto *list =
                                     dynamic_cast<ScrollableListWidget *>(
                                         actor.get())) {
@@ -770,6 +1177,10 @@ void Game::update() {
         }  // End frame skip check
     }
 
+    // Sample gameplay input right before the simulation passes, so a press
+    // moves the player (and its animation state) in the frame it is seen
+    process_input();
+
     // Update actors
     if (m_state == GameState::PLAY) {
         m_updating_actors = true;
@@ -793,10 +1204,9 @@ void Game::update() {
                m_state == GameState::GAMEOVER) {
         // Update widgets for animations (e.g., ScrollableListWidget scroll
         // animation)
-        float delta = GetFrameTime();
         for (auto &actor : m_actors) {
-            if (actor && actor->get_group_id() == 4) {  // Widget group ID
-                actor->update(delta);
+            if (actor && actor->get_group_id() == WIDGET_TYPE_ID) {
+                actor->update(frame_time);
             }
         }
     }  // GameState::PLAY
@@ -807,7 +1217,7 @@ void Game::update() {
         if (actor->get_state() == ActorState::CONSUMED) {
             switch (actor->get_group_id()) {
                 {
-                    case static_cast<uint8_t>(ActorType::PLATFORM): {
+                    case PLATFORM_TYPE_ID: {
                         // Let the platform handle its own reuse strategy
                         // Scene-based platforms have no reuse strategy
                         // (nullptr) Random platforms have
@@ -823,10 +1233,10 @@ void Game::update() {
                             to_remove.push_back(actor.get());
                         }
                     } break;
-                    case static_cast<uint8_t>(ActorType::BONUS): {
+                    case BONUS_TYPE_ID: {
                         to_remove.push_back(actor.get());
                     } break;
-                    case 3: {  // Monster group ID
+                    case MONSTER_TYPE_ID: {
                         to_remove.push_back(actor.get());
                     } break;
                     default:
@@ -844,8 +1254,6 @@ void Game::update() {
         }
     }
 
-    process_input();
-
     // Only update game time when not paused
     double cur_update_time = GetTime();
     auto delta = static_cast<float>(cur_update_time - last_update_time);
@@ -872,7 +1280,8 @@ void Game::update() {
                 // Check projectile-monster collisions
                 for (auto &proj_actor : m_actors) {
                     // Not a projectile
-                    if (!proj_actor || proj_actor->get_group_id() != 5)
+                    if (!proj_actor ||
+                        proj_actor->get_group_id() != PROJECTILE_TYPE_ID)
                         continue;
 
                     auto *projectile =
@@ -884,7 +1293,7 @@ void Game::update() {
                     for (auto &monster_actor : m_actors) {
                         // Not a monster
                         if (!monster_actor ||
-                            monster_actor->get_group_id() != 3)
+                            monster_actor->get_group_id() != MONSTER_TYPE_ID)
                             continue;
 
                         auto *monster =
@@ -953,13 +1362,13 @@ void Game::update() {
                         m_actors.begin(),
                         m_actors.end(),
                         [](const std::unique_ptr<IActor> &actor) {
-                            if (actor->get_group_id() == 5) {  // Projectile
+                            if (actor->get_group_id() == PROJECTILE_TYPE_ID) {
                                 auto *proj =
                                     dynamic_cast<udjourney::Projectile *>(
                                         actor.get());
                                 return proj && !proj->is_alive();
                             }
-                            if (actor->get_group_id() == 3) {  // Monster
+                            if (actor->get_group_id() == MONSTER_TYPE_ID) {
                                 // Only remove after death animation completes
                                 return actor->get_state() ==
                                        ActorState::CONSUMED;
@@ -1023,7 +1432,7 @@ void Game::update() {
             // Handle collision for all monsters (only during gameplay)
             if (m_state == GameState::PLAY) {
                 for (auto &actor : m_actors) {
-                    if (actor->get_group_id() == 3) {  // Monster group ID
+                    if (actor->get_group_id() == MONSTER_TYPE_ID) {
                         Monster *monster = dynamic_cast<Monster *>(actor.get());
                         if (monster) {
                             monster->handle_collision(m_actors);
@@ -1048,7 +1457,66 @@ void Game::update() {
         last_update_time = cur_update_time;
     }
 
+    // Textures decoded in the background become usable here; baked chunks
+    // drew flat colors in their place and need a rebake
+    if (TextureManager::get_instance().pump_uploads(kTextureUploadBudget) >
+        0) {
+        m_static_chunks.mark_all_dirty();
+    }
+
+    if (ui_screen_is_idle_()) {
+        // Nothing on screen changed: keep presenting the last frame and only
+        // poll input, which EndDrawing would otherwise do
+        WaitTime(kUiIdlePollInterval);
+        PollInputEvents();
+        m_last_input_poll_time = GetTime();
+        return;
+    }
     draw();
+    // Evict over-budget textures once this frame's draws are submitted
+    TextureManager::get_instance().end_frame();
+}
+
+bool Game::ui_screen_is_idle_() {
+#ifdef PLATFORM_DREAMCAST
+    return false;
+#else
+    if (m_state != GameState::TITLE && m_state != GameState::WIN &&
+        m_state != GameState::GAMEOVER) {
+        return false;
+    }
+
+    const UiFrameKey key{m_state,
+                         m_current_scene.get(),
+                         m_selected_widget_index,
+                         GetScreenWidth(),
+                         GetScreenHeight(),
+                         m_offscreen_scale,
+                         m_show_render_stats};
+    bool dirty = key != m_last_ui_frame;
+    m_last_ui_frame = key;
+
+    // Consume every widget's redraw flag, not just the first one found
+    for (const auto &actor : m_actors) {
+        if (actor && actor->get_group_id() == WIDGET_TYPE_ID) {
+            auto *widget = static_cast<IWidget *>(actor.get());
+            dirty = widget->take_redraw_request() || dirty;
+            dirty = dirty || widget->is_animating();
+        }
+    }
+
+    dirty = dirty || m_frames_since_scene_load < 3 ||
+            m_background_manager.is_ui_scrolling() ||
+            m_particle_manager.get_emitter_count() > 0 ||
+            m_particle_manager.get_baked_burst_count() > 0;
+
+    const double now = GetTime();
+    if (dirty || now - m_last_ui_draw_time >= kUiIdleRedrawInterval) {
+        m_last_ui_draw_time = now;
+        return false;
+    }
+    return true;
+#endif
 }
 
 // Function definition for extract_number_
@@ -1228,8 +1696,14 @@ const DashHud &Game::get_dash_hud() const { return dash_hud; }
 void Game::init_state_renderers_() {
     m_state_renderers[GameState::TITLE] = std::make_unique<UiScreenRenderer>();
     m_state_renderers[GameState::PLAY] = std::make_unique<PlayStateRenderer>();
+    // UDJ_PAUSE_DIM=0..1 sets the veil over the paused frame (0 = none)
+    float pause_dim = PauseStateRenderer::kDefaultDim;
+    if (const char *dim_env = std::getenv("UDJ_PAUSE_DIM")) {
+        pause_dim = std::clamp(
+            static_cast<float>(std::atof(dim_env)), 0.0f, 1.0f);
+    }
     m_state_renderers[GameState::PAUSE] =
-        std::make_unique<PauseStateRenderer>();
+        std::make_unique<PauseStateRenderer>(pause_dim);
     m_state_renderers[GameState::GAMEOVER] =
         std::make_unique<UiScreenRenderer>();
     m_state_renderers[GameState::WIN] = std::make_unique<UiScreenRenderer>();
@@ -1245,6 +1719,7 @@ bool Game::load_scene(const std::string &filename) {
     if (!m_current_scene->load_from_file(filename)) {
         m_current_scene.reset();
         m_background_manager.clear();
+        m_static_tile_grid.clear();
         return false;
     }
 
@@ -1278,6 +1753,9 @@ bool Game::load_scene(const std::string &filename) {
 
     // Update world bounds with calculated max values
     m_world_bounds.set_bounds(0.0f, max_x, 0.0f, max_y);
+
+    // Static platforms never move: rasterize them once for cheap queries
+    m_static_tile_grid.build(*m_current_scene);
     return true;
 }
 
@@ -1300,7 +1778,7 @@ void Game::create_huds_from_scene() {
                                   m_actors.end(),
                                   [](const std::unique_ptr<IActor> &actor) {
                                       return actor && actor->get_group_id() ==
-                                                          4;  // Widget group
+                                                          WIDGET_TYPE_ID;
                                   }),
                    m_actors.end());
 
@@ -1318,6 +1796,7 @@ void Game::create_platforms_from_scene() {
     if (!m_current_scene) {
         // Fallback to original random generation if no scene loaded
         m_actors = init_platforms(*this);
+        m_static_chunks.build(m_actors);
         return;
     }
     m_actors.clear();
@@ -1346,6 +1825,8 @@ void Game::create_platforms_from_scene() {
             PlatformFactory::create(*this, world_rect, platform_data);
         m_actors.emplace_back(std::move(platform));
     }
+
+    m_static_chunks.build(m_actors);
 }
 
 void Game::create_monsters_from_scene() {
@@ -1384,6 +1865,8 @@ void Game::create_monsters_from_scene() {
 }
 
 void Game::restart_level() {
+    invalidate_frozen_frame();
+
     // Reload the current scene from file to ensure we have fresh data
     if (!m_current_scene_filename.empty() && m_current_scene) {
         if (!m_current_scene->load_from_file(m_current_scene_filename)) {
@@ -1484,7 +1967,7 @@ void Game::attack_nearby_monsters() {
 
     // Check all actors for monsters
     for (auto &actor : m_actors) {
-        if (actor->get_group_id() == 3) {  // Monster group ID
+        if (actor->get_group_id() == MONSTER_TYPE_ID) {
             Monster *monster = dynamic_cast<Monster *>(actor.get());
             if (monster) {
                 Rectangle monster_rect = monster->get_rectangle();
@@ -1574,7 +2057,7 @@ void Game::register_menu_actions() {
                 std::vector<IWidget *> selectable_widgets;
                 int list_index = -1;
                 for (const auto &actor : captured_game.m_actors) {
-                    if (actor && actor->get_group_id() == 4) {
+                    if (actor && actor->get_group_id() == WIDGET_TYPE_ID) {
                         IWidget *widget = static_cast<IWidget *>(actor.get());
                         if (widget && widget->is_selectable()) {
                             if (dynamic_cast<ScrollableListWidget *>(widget)) {
@@ -0,0 +1,54 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/InputLatency.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace udjourney {
+
+void InputLatency::mark_input(double now) noexcept {
+    if (!m_pending) {
+        m_pending = true;
+        m_pending_since = now;
+    }
+}
+
+void InputLatency::mark_present(double now) noexcept {
+    if (!m_pending) {
+        return;
+    }
+    m_pending = false;
+
+    m_last_ms = static_cast<float>(std::max(0.0, now - m_pending_since) *
+                                   1000.0);
+    m_samples_ms[m_next] = m_last_ms;
+    m_next = (m_next + 1) % kSampleCount;
+    m_count = std::min(m_count + 1, kSampleCount);
+}
+
+float InputLatency::get_percentile_ms(float percentile) const {
+    if (m_count == 0) {
+        return 0.0f;
+    }
+
+    // Until the ring wraps, the samples are the first m_count entries
+    std::array<float, kSampleCount> sorted = m_samples_ms;
+    auto end = sorted.begin() + static_cast<std::ptrdiff_t>(m_count);
+    std::sort(sorted.begin(), end);
+
+    // Nearest rank
+    const float clamped = std::clamp(percentile, 0.0f, 100.0f);
+    auto rank = static_cast<size_t>(
+        std::ceil(clamped / 100.0f * static_cast<float>(m_count)));
+    rank = std::clamp<size_t>(rank, 1, m_count);
+    return sorted[rank - 1];
+}
+
+void InputLatency::reset() noexcept {
+    m_next = 0;
+    m_count = 0;
+    m_last_ms = 0.0f;
+    m_pending = false;
+}
+
+}  // namespace udjourney
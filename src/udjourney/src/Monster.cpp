@@ -13,8 +13,10 @@
 #include "udjourney/managers/TextureManager.hpp"
 #include "udjourney/core/events/ScoreEvent.hpp"
 #include "udjourney/core/events/EventDispatcher.hpp"
-#include "udjourney/loaders/MonsterPresetLoader.hpp"
+#include "udjourney/loaders/MonsterPresetRegistry.hpp"
 #include "udjourney/Player.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
 #include "udjourney/states/MonsterStates.hpp"
 #include "udjourney/WorldBounds.hpp"
 
@@ -87,6 +89,7 @@ Rectangle Monster::get_rectangle() const {
 }
 
 void Monster::draw() const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Monsters);
     auto rect = rect_;
     const auto& game_rect = game_.get_rectangle();
 
@@ -95,15 +98,22 @@ void Monster::draw() const {
     rect.y -= game_rect.y;
 
     // Draw current animation through the controller
-    anim_controller_.draw(rect, !facing_right_);
+    SpriteBatch* batch = game_.get_sprite_batch();
+    anim_controller_.draw(rect, !facing_right_, batch);
 
     // Debug: Draw health bar
     if (health_ > 0.0f && health_ < max_health_) {
         Rectangle health_bar_bg = {rect.x, rect.y - 10, rect.width, 4};
         Rectangle health_bar = {
             rect.x, rect.y - 10, rect.width * (health_ / max_health_), 4};
-        DrawRectangleRec(health_bar_bg, BLACK);
-        DrawRectangleRec(health_bar, RED);
+        if (batch) {
+            const uint8_t overlay = SpriteBatch::layer(RenderLayer::Overlay);
+            batch->draw_rect(overlay, health_bar_bg, BLACK);
+            batch->draw_rect(overlay, health_bar, RED);
+        } else {
+            draw::rectangle_rec(health_bar_bg, BLACK);
+            draw::rectangle_rec(health_bar, RED);
+        }
     }
 }
 
@@ -293,9 +303,6 @@ void Monster::handle_collision(
         return;
     }
 
-    const uint8_t PLATFORM_TYPE_ID = 1;
-    const uint8_t MONSTER_TYPE_ID = 3;
-
     grounded_ = false;
 
     for (const auto& actor : actors) {
@@ -394,43 +401,36 @@ bool Monster::is_animation_finished() const {
 }
 
 void Monster::load_preset(const std::string& preset_name) {
-    try {
-        Logger::info("Loading monster preset: " + preset_name);
-
-        // Load preset from JSON file (MonsterPresetLoader handles the path
-        // construction)
-        std::string preset_filename = preset_name + ".json";
-        preset_ = udjourney::MonsterPresetLoader::load_preset(preset_filename);
-        preset_name_ = preset_name;
-
-        Logger::info("Monster preset loaded successfully: " + preset_name);
-
-        // Apply preset stats
-        max_health_ = preset_->stats.max_health;
-        health_ = max_health_;  // Reset to full health
-        speed_ = preset_->stats.movement_speed;
-        damage_ = preset_->stats.damage;
-
-        // Apply behavior settings
-        chase_range_ = preset_->behavior.chase_range;
-        attack_range_ = preset_->behavior.attack_range;
-
-        // Change to preset's initial state if different from current
-        std::string target_state = preset_->state_config.initial_state;
-        if (target_state != "idle") {  // Only change if not already idle
-            change_state(target_state);
-        }
-
-        Logger::info("Monster configured with preset '" + preset_->name +
-                         "' (HP: %, Speed: %, State: %",
-                     max_health_,
-                     speed_,
-                     target_state);
-    } catch (const std::exception& e) {
-        Logger::error("Failed to load monster preset '" + preset_name +
-                      "': " + e.what());
+    // Shared with every monster of this kind, parsed on first use only
+    auto preset = MonsterPresetRegistry::get_instance().get(preset_name);
+    if (!preset) {
         Logger::error("Monster will continue with default settings.");
+        return;
     }
+    preset_ = std::move(preset);
+    preset_name_ = preset_name;
+
+    // Apply preset stats
+    max_health_ = preset_->stats.max_health;
+    health_ = max_health_;  // Reset to full health
+    speed_ = preset_->stats.movement_speed;
+    damage_ = preset_->stats.damage;
+
+    // Apply behavior settings
+    chase_range_ = preset_->behavior.chase_range;
+    attack_range_ = preset_->behavior.attack_range;
+
+    // Change to preset's initial state if different from current
+    std::string target_state = preset_->state_config.initial_state;
+    if (target_state != "idle") {  // Only change if not already idle
+        change_state(target_state);
+    }
+
+    Logger::info("Monster configured with preset '" + preset_->name +
+                     "' (HP: %, Speed: %, State: %",
+                 max_health_,
+                 speed_,
+                 target_state);
 }
 
 void Monster::award_kill_points() const {
@@ -11,12 +11,20 @@
 #include <udj-core/CoreUtils.hpp>
 #include <udj-core/Logger.hpp>
 
+#include "udjourney/loaders/PresetBundle.hpp"
+
 using json = nlohmann::json;
 
 namespace udjourney {
 
 std::unique_ptr<MonsterPreset> MonsterPresetLoader::load_preset(
     const std::string& preset_file) {
+    if (const MonsterPreset* cooked =
+            loaders::PresetBundle::get_instance().find_monster(
+                "monsters/" + preset_file)) {
+        return std::make_unique<MonsterPreset>(*cooked);
+    }
+
     std::string full_path =
         udjourney::coreutils::get_assets_path("monsters/" + preset_file);
 
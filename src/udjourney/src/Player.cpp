@@ -22,8 +22,9 @@
 #include "udjourney/managers/ParticleManager.hpp"
 #include "udjourney/components/HealthComponent.hpp"
 #include "udjourney/core/events/ScoreEvent.hpp"
-#include "udjourney/managers/TextureManager.hpp"
 #include "udjourney/platform/Platform.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
 
 #include "udjourney/core/events/WeaponSelectedEvent.hpp"
 namespace udjourney {
@@ -115,16 +116,12 @@ Player::Player(const IGame &iGame, Rectangle iRect,
     anim_controller_(std::move(anim_controller)),
     m_dispatcher(ioDispatcher),
     m_physics_config(physics_config) {
-    if (m_texture.id == 0) {
-        auto &texture_manager = TextureManager::get_instance();
-        m_texture = texture_manager.get_texture("placeholder.png");
-    }
-
     // Add health component - 3 hearts = 6 half-hearts
     add_component(std::make_unique<HealthComponent>(6, 6, &m_dispatcher));
 }
 
 void Player::draw() const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Player);
     auto rect = r;
     const auto &game = get_game();
     // Convert to screen coordinates
@@ -132,11 +129,20 @@ void Player::draw() const {
     rect.y -= game.get_rectangle().y;
 
     // Draw current animation through the controller
-    anim_controller_.draw(rect, !m_facing_right);
+    SpriteBatch *batch = game.get_sprite_batch();
+    anim_controller_.draw(rect,
+                          !m_facing_right,
+                          batch,
+                          SpriteBatch::layer(RenderLayer::Player));
 
     if (is_invincible()) {
         // Draw a yellow border around the player when invincible
-        DrawRectangleLinesEx(rect, 3.0F, YELLOW);
+        if (batch) {
+            batch->draw_rect_lines(
+                SpriteBatch::layer(RenderLayer::Overlay), rect, 3.0F, YELLOW);
+        } else {
+            draw::rectangle_lines_ex(rect, 3.0F, YELLOW);
+        }
     }
 }
 
@@ -338,10 +344,6 @@ void Player::handle_collision(
         return;
     }
 
-    const uint8_t PLATFORM_TYPE_ID = 1;
-    const uint8_t BONUS_TYPE_ID = 2;
-    const uint8_t MONSTER_TYPE_ID = 3;
-
     bool tmp_colliding = false;
     bool tmp_grounded = false;
     Platform *tmp_grounded_src = nullptr;
@@ -8,6 +8,9 @@
 #include <udj-core/CoreUtils.hpp>
 
 #include "udjourney/interfaces/IGame.hpp"
+#include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
 
 namespace udjourney {
 
@@ -25,11 +28,13 @@ Projectile::Projectile(const IGame& game, const ProjectilePreset& preset,
     // Initialize velocity based on trajectory type
     velocity_ = {direction_.x * preset_.speed, direction_.y * preset_.speed};
 
-    // Load texture
+    // Texture is shared by every projectile of the preset (one upload)
     std::string texture_path =
         udj::core::filesystem::get_assets_path(preset_.texture_file);
     if (udj::core::filesystem::file_exists(texture_path)) {
-        texture_ = LoadTexture(texture_path.c_str());
+        auto& texture_manager = TextureManager::get_instance();
+        texture_handle_ = texture_manager.get_handle(preset_.texture_file);
+        texture_ = texture_manager.acquire(texture_handle_);
         texture_loaded_ = true;
     } else {
         std::cerr << "Warning: Projectile texture not found: " << texture_path
@@ -39,7 +44,7 @@ Projectile::Projectile(const IGame& game, const ProjectilePreset& preset,
 
 Projectile::~Projectile() {
     if (texture_loaded_) {
-        UnloadTexture(texture_);
+        TextureManager::get_instance().release(texture_handle_);
     }
 }
 
@@ -95,6 +100,7 @@ void Projectile::update(float delta) {
 }
 
 void Projectile::draw() const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Projectiles);
     if (!alive_) return;
 
     // Convert to screen coordinates
@@ -110,21 +116,31 @@ void Projectile::draw() const {
         texture_loaded_ ? (preset_.tile_width * preset_.x_span / 2.0f) : 0.0f;
 
     if (texture_loaded_) {
+        Rectangle source{0.0f,
+                         0.0f,
+                         static_cast<float>(texture_.width),
+                         static_cast<float>(texture_.height)};
         if (preset_.use_atlas && preset_.source_rect.width > 0.0f &&
             preset_.source_rect.height > 0.0f) {
-            DrawTextureRec(texture_, preset_.source_rect, screen_pos, WHITE);
+            source = preset_.source_rect;
+        }
+        Rectangle dest{screen_pos.x, screen_pos.y, source.width, source.height};
+
+        if (SpriteBatch* batch = game.get_sprite_batch()) {
+            batch->draw_texture(SpriteBatch::layer(RenderLayer::Actors),
+                                texture_,
+                                source,
+                                dest);
         } else {
-            DrawTexture(texture_,
-                        static_cast<int>(screen_pos.x),
-                        static_cast<int>(screen_pos.y),
-                        WHITE);
+            draw::texture_pro(
+                texture_, source, dest, {0.0f, 0.0f}, 0.0f, WHITE);
         }
     } else {
         // Draw a red circle if no texture
-        DrawCircle(static_cast<int>(screen_pos.x),
-                   static_cast<int>(screen_pos.y),
-                   6.0f,
-                   RED);
+        draw::circle(static_cast<int>(screen_pos.x),
+                     static_cast<int>(screen_pos.y),
+                     6.0f,
+                     RED);
     }
 }
 
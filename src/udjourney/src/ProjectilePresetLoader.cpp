@@ -10,13 +10,33 @@
 #include <udj-core/CoreUtils.hpp>
 #include <udj-core/Logger.hpp>
 
+#include "udjourney/loaders/PresetBundle.hpp"
+#include "udjourney/managers/TextureManager.hpp"
+
 using json = nlohmann::json;
 
 namespace udjourney {
 
 bool ProjectilePresetLoader::load_from_file(const std::string& filepath) {
-    std::string full_path = udj::core::filesystem::get_assets_path(filepath);
+    if (const auto* cooked =
+            loaders::PresetBundle::get_instance().find_projectiles(filepath)) {
+        for (const auto& preset : *cooked) {
+            presets_[preset.name] = preset;
+        }
+    } else if (!load_from_path(
+                   udj::core::filesystem::get_assets_path(filepath))) {
+        return false;
+    }
+
+    // Packed sheets draw from their atlas page
+    for (auto& [_, preset] : presets_) {
+        TextureManager::get_instance().remap_to_atlas(
+            preset.texture_file, preset.source_rect, preset.use_atlas);
+    }
+    return true;
+}
 
+bool ProjectilePresetLoader::load_from_path(const std::string& full_path) {
     if (!udj::core::filesystem::file_exists(full_path)) {
         udj::core::Logger::error("Projectile preset file not found: %",
                                  full_path);
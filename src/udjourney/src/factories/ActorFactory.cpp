@@ -7,11 +7,14 @@
 
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/AnimSpriteController.hpp"
+#include "udjourney/AnimationClipLibrary.hpp"
 #include "udjourney/interfaces/IActor.hpp"
 #include "udjourney/interfaces/IComponent.hpp"
 #include "udjourney/Monster.hpp"
 #include "udjourney/Player.hpp"
 #include "udjourney/loaders/AnimationConfigLoader.hpp"
+#include "udjourney/loaders/MonsterPresetRegistry.hpp"
+#include "udjourney/loaders/PresetBundle.hpp"
 #include <udj-core/CoreUtils.hpp>
 #include "udjourney/core/events/EventDispatcher.hpp"
 #include "udjourney/scene/Scene.hpp"
@@ -64,23 +67,35 @@ std::unique_ptr<IActor> MonsterFactory::create_actor_from_monster_data(
         64.0f   // Monster height
     };
 
-    // First load the monster preset to get animation configuration
-    std::unique_ptr<udjourney::MonsterPreset> preset;
+    // First look the monster preset up to get animation configuration (the
+    // registry parses each preset once, Monster::load_preset reuses it)
+    std::shared_ptr<const udjourney::MonsterPreset> preset;
     if (!monster_data.preset_name.empty()) {
-        preset = udjourney::MonsterPresetLoader::load_preset(
-            monster_data.preset_name + ".json");
+        preset = MonsterPresetRegistry::get_instance().get(
+            monster_data.preset_name);
     }
 
+    // A cooked bundle already resolved the monster's animation preset
+    const animation::AnimationPresetConfig* cooked_animation =
+        monster_data.preset_name.empty()
+            ? nullptr
+            : loaders::PresetBundle::get_instance().find_monster_animation(
+                  "monsters/" + monster_data.preset_name + ".json");
+
     // Get animation preset file from the monster preset
     std::string animation_file = "monster_animations.json";  // Default fallback
     if (preset && !preset->animation_preset_file.empty()) {
         animation_file = preset->animation_preset_file;
     }
 
-    // Load monster animation configuration from the preset
+    // Load monster animation configuration from the preset. Clips are
+    // shared per preset, so only the first monster of a kind reads it.
     std::string anim_preset_path =
         std::string(ASSETS_BASE_PATH) + "animations/" + animation_file;
-    if (!udjourney::coreutils::file_exists(anim_preset_path)) {
+    if (!cooked_animation &&
+        !animation::AnimationClipLibrary::get_instance().find(
+            anim_preset_path) &&
+        !udjourney::coreutils::file_exists(anim_preset_path)) {
         throw std::runtime_error("Monster animation config file not found: " +
                                  anim_preset_path);
     }
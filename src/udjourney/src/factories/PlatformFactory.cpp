@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "udjourney/managers/TextureManager.hpp"
 #include "udjourney/platform/behavior_strategies/CameraFollowVerticalBehaviorStrategy.hpp"
 #include "udjourney/platform/behavior_strategies/EightTurnHorizontalBehaviorStrategy.hpp"
 #include "udjourney/platform/behavior_strategies/HorizontalBehaviorStrategy.hpp"
@@ -61,11 +62,25 @@ std::unique_ptr<Platform> PlatformFactory::create(
                                                false);  // not Y-repeated
 
     if (!platform_data.texture_file.empty()) {
-        platform->set_texture_file(platform_data.texture_file);
+        auto& texture_manager = TextureManager::get_instance();
+        std::string texture_file = platform_data.texture_file;
+        Rectangle source_rect = platform_data.source_rect;
+        bool use_atlas = platform_data.use_atlas;
+        // Legacy tiling repeat-wraps the whole texture: it keeps its own file
+        if (use_atlas || !platform_data.texture_tiled) {
+            texture_manager.remap_to_atlas(
+                texture_file, source_rect, use_atlas);
+        }
+
+        platform->set_texture_file(texture_file);
+        // Level textures stay resident until the scene changes; decode
+        // them off the main thread while the scene is being built
+        texture_manager.pin(platform->get_texture_handle());
+        texture_manager.request(platform->get_texture_handle());
         platform->set_texture_tiled(platform_data.texture_tiled);
-        platform->set_use_atlas(platform_data.use_atlas);
-        if (platform_data.use_atlas) {
-            platform->set_source_rect(platform_data.source_rect);
+        platform->set_use_atlas(use_atlas);
+        if (use_atlas) {
+            platform->set_source_rect(source_rect);
         }
     }
 
@@ -11,6 +11,10 @@
 #include <utility>
 #include <vector>
 
+#include "udjourney/render/Draw.hpp"
+
+namespace draw = udjourney::draw;
+
 namespace internal {
 
 struct TextOptions {
@@ -28,7 +32,8 @@ void wrap_text(const std::string& iText, TextOptions iTextOptions,
 
     while (stream >> word) {
         std::string test_line = line.empty() ? word : line + " " + word;
-        int line_width = MeasureText(test_line.c_str(), iTextOptions.font_size);
+        int line_width =
+            draw::measure_text(test_line.c_str(), iTextOptions.font_size);
 
         if (line_width > static_cast<int>(iTextOptions.max_width)) {
             oWrappedLines.push_back(line);
@@ -111,12 +116,12 @@ void DialogBoxHUD::update(float deltaTime) {
     // To implement
 }
 
-void DialogBoxHUD::draw() const {
+void DialogBoxHUD::draw(udjourney::SpriteBatch* batch) const {
     // Draw the dialog box
     const int fontSize = 20;
     const int padding = 10;
 
-    DrawRectangleRec(m_rect, DARKGRAY);
+    draw::rectangle_rec(m_rect, DARKGRAY);
 
     float pos_y = m_rect.y + padding;
 
@@ -128,15 +133,16 @@ void DialogBoxHUD::draw() const {
             break;  // Prevent out-of-bounds access
         }
         const std::string& line = m_wrapped_lines[i];
-        DrawText(line.c_str(),
-                 static_cast<int>(m_rect.x + padding),
-                 static_cast<int>(pos_y),
-                 fontSize,
-                 WHITE);
+        draw::text(line.c_str(),
+                   static_cast<int>(m_rect.x + padding),
+                   static_cast<int>(pos_y),
+                   fontSize,
+                   WHITE,
+                   batch);
         pos_y += fontSize + 4;  // Add some spacing between lines
     }
 
-    DrawRectangleRec(m_pimpl->button_rect, LIGHTGRAY);
+    draw::rectangle_rec(m_pimpl->button_rect, LIGHTGRAY);
 }
 
 void DialogBoxHUD::set_on_finished_callback(std::function<void()> callback) {
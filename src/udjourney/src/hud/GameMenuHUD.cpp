@@ -9,6 +9,7 @@
 #include <udj-core/Logger.hpp>
 
 #include "udjourney/ActionDispatcher.hpp"
+#include "udjourney/render/Draw.hpp"
 
 namespace udjourney {
 
@@ -18,25 +19,26 @@ GameMenuHUD::GameMenuHUD(IGame& game, const Rectangle& rect,
     m_is_focusable = true;
 }
 
-void GameMenuHUD::draw() const {
+void GameMenuHUD::draw(SpriteBatch* batch) const {
     // Draw semi-transparent background
-    DrawRectangle(0,
-                  0,
-                  static_cast<int>(m_rect.width + m_rect.x * 2),
-                  static_cast<int>(m_rect.height + m_rect.y * 2),
-                  ColorAlpha(BLACK, 0.7f));
+    draw::rectangle(0,
+                    0,
+                    static_cast<int>(m_rect.width + m_rect.x * 2),
+                    static_cast<int>(m_rect.height + m_rect.y * 2),
+                    ColorAlpha(BLACK, 0.7f));
 
     // Draw menu background
-    DrawRectangleRec(m_rect, ColorAlpha(DARKGRAY, 0.9f));
-    DrawRectangleLinesEx(m_rect, 2, YELLOW);
+    draw::rectangle_rec(m_rect, ColorAlpha(DARKGRAY, 0.9f));
+    draw::rectangle_lines_ex(m_rect, 2, YELLOW);
 
     // Draw menu title
-    int title_width = MeasureText(m_title.c_str(), 30);
-    DrawText(m_title.c_str(),
-             static_cast<int>(m_rect.x + m_rect.width / 2 - title_width / 2),
-             static_cast<int>(m_rect.y + 20),
-             30,
-             YELLOW);
+    int title_width = draw::measure_text(m_title.c_str(), 30);
+    draw::text(m_title.c_str(),
+               static_cast<int>(m_rect.x + m_rect.width / 2 - title_width / 2),
+               static_cast<int>(m_rect.y + 20),
+               30,
+               YELLOW,
+               batch);
 
     // Draw menu items
     float item_y = m_rect.y + 80;
@@ -51,31 +53,33 @@ void GameMenuHUD::draw() const {
 
         // Draw selection background
         if (static_cast<int>(i) == m_selected_index) {
-            DrawRectangle(static_cast<int>(m_rect.x + 20),
-                          static_cast<int>(item_y - 5),
-                          static_cast<int>(m_rect.width - 40),
-                          static_cast<int>(item_height),
-                          bg_color);
+            draw::rectangle(static_cast<int>(m_rect.x + 20),
+                            static_cast<int>(item_y - 5),
+                            static_cast<int>(m_rect.width - 40),
+                            static_cast<int>(item_height),
+                            bg_color);
         }
 
         // Draw item text
-        DrawText(m_items[i].label.c_str(),
-                 static_cast<int>(m_rect.x + 40),
-                 static_cast<int>(item_y),
-                 20,
-                 text_color);
+        draw::text(m_items[i].label.c_str(),
+                   static_cast<int>(m_rect.x + 40),
+                   static_cast<int>(item_y),
+                   20,
+                   text_color,
+                   batch);
 
         item_y += item_height + 10;
     }
 
     // Draw controls hint
     const char* hint = "UP/DOWN: Navigate  |  ENTER: Select  |  ESC: Close";
-    int hint_width = MeasureText(hint, 15);
-    DrawText(hint,
-             static_cast<int>(m_rect.x + m_rect.width / 2 - hint_width / 2),
-             static_cast<int>(m_rect.y + m_rect.height - 30),
-             15,
-             LIGHTGRAY);
+    int hint_width = draw::measure_text(hint, 15);
+    draw::text(hint,
+               static_cast<int>(m_rect.x + m_rect.width / 2 - hint_width / 2),
+               static_cast<int>(m_rect.y + m_rect.height - 30),
+               15,
+               LIGHTGRAY,
+               batch);
 }
 
 void GameMenuHUD::update(float delta) {
@@ -7,6 +7,9 @@
 #include <utility>
 
 #include "raylib/raylib.h"
+#include "udjourney/render/Draw.hpp"
+
+namespace draw = udjourney::draw;
 
 #ifndef PLATFORM_DREAMCAST
 #include <filesystem>
@@ -61,36 +64,40 @@ void LevelSelectHUD::update(float deltaTime) {
     (void)deltaTime;  // Suppress unused parameter warning
 }
 
-void LevelSelectHUD::draw() const { draw_menu(); }
+void LevelSelectHUD::draw(udjourney::SpriteBatch* batch) const {
+    draw_menu(batch);
+}
 
-void LevelSelectHUD::draw_menu() const {
+void LevelSelectHUD::draw_menu(udjourney::SpriteBatch* batch) const {
     // Draw semi-transparent background
-    DrawRectangle(static_cast<int>(m_rect.x),
-                  static_cast<int>(m_rect.y),
-                  static_cast<int>(m_rect.width),
-                  static_cast<int>(m_rect.height),
-                  Fade(BLACK, 0.8f));
+    draw::rectangle(static_cast<int>(m_rect.x),
+                    static_cast<int>(m_rect.y),
+                    static_cast<int>(m_rect.width),
+                    static_cast<int>(m_rect.height),
+                    Fade(BLACK, 0.8f));
 
     // Draw border
-    DrawRectangleLinesEx(m_rect, 2.0f, WHITE);
+    draw::rectangle_lines_ex(m_rect, 2.0f, WHITE);
 
     // Title
     const char* title = "SELECT LEVEL";
-    int title_width = MeasureText(title, 24);
-    DrawText(title,
-             static_cast<int>(m_rect.x + (m_rect.width - title_width) / 2),
-             static_cast<int>(m_rect.y + 20),
-             24,
-             WHITE);
+    int title_width = draw::measure_text(title, 24);
+    draw::text(title,
+               static_cast<int>(m_rect.x + (m_rect.width - title_width) / 2),
+               static_cast<int>(m_rect.y + 20),
+               24,
+               WHITE,
+               batch);
 
     // Instructions
     const char* instructions = "UP/DOWN: Navigate  ENTER: Select  ESC: Cancel";
-    int instr_width = MeasureText(instructions, 16);
-    DrawText(instructions,
-             static_cast<int>(m_rect.x + (m_rect.width - instr_width) / 2),
-             static_cast<int>(m_rect.y + m_rect.height - 40),
-             16,
-             GRAY);
+    int instr_width = draw::measure_text(instructions, 16);
+    draw::text(instructions,
+               static_cast<int>(m_rect.x + (m_rect.width - instr_width) / 2),
+               static_cast<int>(m_rect.y + m_rect.height - 40),
+               16,
+               GRAY,
+               batch);
 
     // Level list
     const int start_y = static_cast<int>(m_rect.y + 70);
@@ -118,11 +125,11 @@ void LevelSelectHUD::draw_menu() const {
 
         // Draw selection background
         if (i == m_selected_index) {
-            DrawRectangle(static_cast<int>(m_rect.x + 10),
-                          draw_y - 5,
-                          static_cast<int>(m_rect.width - 20),
-                          line_height,
-                          bg_color);
+            draw::rectangle(static_cast<int>(m_rect.x + 10),
+                            draw_y - 5,
+                            static_cast<int>(m_rect.width - 20),
+                            line_height,
+                            bg_color);
         }
 
         // Draw level name (remove .json extension for display)
@@ -136,28 +143,31 @@ void LevelSelectHUD::draw_menu() const {
         std::string text =
             (i == m_selected_index) ? "> " + display_name : "  " + display_name;
 
-        DrawText(text.c_str(),
-                 static_cast<int>(m_rect.x + 20),
-                 draw_y,
-                 20,
-                 text_color);
+        draw::text(text.c_str(),
+                   static_cast<int>(m_rect.x + 20),
+                   draw_y,
+                   20,
+                   text_color,
+                   batch);
     }
 
     // Show scroll indicators if needed
     if (m_level_files.size() > static_cast<size_t>(max_visible_items)) {
         if (start_index > 0) {
-            DrawText("↑",
-                     static_cast<int>(m_rect.x + m_rect.width - 30),
-                     start_y - 20,
-                     20,
-                     WHITE);
+            draw::text("↑",
+                       static_cast<int>(m_rect.x + m_rect.width - 30),
+                       start_y - 20,
+                       20,
+                       WHITE,
+                       batch);
         }
         if (end_index < static_cast<int>(m_level_files.size())) {
-            DrawText("↓",
-                     static_cast<int>(m_rect.x + m_rect.width - 30),
-                     start_y + (max_visible_items - 1) * line_height + 20,
-                     20,
-                     WHITE);
+            draw::text("↓",
+                       static_cast<int>(m_rect.x + m_rect.width - 30),
+                       start_y + (max_visible_items - 1) * line_height + 20,
+                       20,
+                       WHITE,
+                       batch);
         }
     }
 }
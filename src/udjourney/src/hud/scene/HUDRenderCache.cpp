@@ -0,0 +1,127 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/hud/scene/HUDRenderCache.hpp"
+
+#include <raylib/rlgl.h>
+
+#include <cmath>
+
+#include "udjourney/render/Draw.hpp"
+
+namespace udjourney {
+namespace hud {
+namespace scene {
+
+namespace {
+bool same_rect(Rectangle a, Rectangle b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width &&
+           a.height == b.height;
+}
+}  // namespace
+
+HUDRenderCache::~HUDRenderCache() {
+    if (m_target.id != 0) {
+        UnloadRenderTexture(m_target);
+    }
+}
+
+bool HUDRenderCache::is_current(Rectangle bounds, float scale,
+                                uint64_t contents) const {
+    return m_valid && contents == m_contents && scale == m_scale &&
+           same_rect(bounds, m_bounds);
+}
+
+Vector2 HUDRenderCache::texture_size(Rectangle bounds, float scale) {
+    if (bounds.width <= 0.0f || bounds.height <= 0.0f || scale <= 0.0f) {
+        return Vector2{0.0f, 0.0f};
+    }
+    return Vector2{std::ceil(bounds.width * scale),
+                   std::ceil(bounds.height * scale)};
+}
+
+bool HUDRenderCache::update(Rectangle bounds, float scale, uint64_t contents,
+                            const std::function<void()>& draw_contents) {
+    m_valid = false;
+    const Vector2 size = texture_size(bounds, scale);
+    if (size.x <= 0.0f || !render_(size, bounds, scale, draw_contents)) {
+        return false;
+    }
+
+    m_bounds = bounds;
+    m_size = size;
+    m_scale = scale;
+    m_contents = contents;
+    m_valid = true;
+    return true;
+}
+
+bool HUDRenderCache::draw(uint64_t contents) const {
+    if (!m_valid || contents != m_contents) {
+        return false;
+    }
+    blit_(Rectangle{m_bounds.x,
+                    m_bounds.y,
+                    m_size.x / m_scale,
+                    m_size.y / m_scale});
+    return true;
+}
+
+bool HUDRenderCache::render_(Vector2 size, Rectangle bounds, float scale,
+                             const std::function<void()>& draw_contents) {
+#ifdef PLATFORM_DREAMCAST
+    (void)size;
+    (void)bounds;
+    (void)scale;
+    (void)draw_contents;
+    return false;
+#else
+    const int width = static_cast<int>(size.x);
+    const int height = static_cast<int>(size.y);
+    if (m_target.id != 0 && (m_target.texture.width != width ||
+                             m_target.texture.height != height)) {
+        UnloadRenderTexture(m_target);
+        m_target = RenderTexture2D{};
+    }
+    if (m_target.id == 0) {
+        m_target = LoadRenderTexture(width, height);
+        if (m_target.id == 0) {
+            return false;
+        }
+    }
+
+    // Cache holds premultiplied color so translucent panels blend as before
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA,
+                              RL_ONE_MINUS_SRC_ALPHA,
+                              RL_ONE,
+                              RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD,
+                              RL_FUNC_ADD);
+
+    BeginTextureMode(m_target);
+    ClearBackground(BLANK);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    rlPushMatrix();
+    rlScalef(scale, scale, 1.0f);
+    rlTranslatef(-bounds.x, -bounds.y, 0.0f);
+    draw_contents();
+    rlPopMatrix();
+    EndBlendMode();
+    EndTextureMode();
+    return true;
+#endif
+}
+
+void HUDRenderCache::blit_(Rectangle dest) const {
+    const Texture2D& texture = m_target.texture;
+    // Render textures are stored bottom-up, hence the flipped source
+    const Rectangle source = {0.0f,
+                              0.0f,
+                              static_cast<float>(texture.width),
+                              -static_cast<float>(texture.height)};
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    draw::texture_pro(texture, source, dest, Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+}  // namespace scene
+}  // namespace hud
+}  // namespace udjourney
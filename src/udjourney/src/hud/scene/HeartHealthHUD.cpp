@@ -3,23 +3,23 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <fstream>
 #include <optional>
 #include <string>
-#include <unordered_map>
 
 #include <nlohmann/json.hpp>
 
 #include "udj-core/Logger.hpp"
 #include "udj-core/CoreUtils.hpp"
 #include "udjourney/core/events/HealthChangedEvent.hpp"
+#include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
 
 namespace udjourney {
 namespace hud {
 namespace scene {
 
-std::unordered_map<std::string, Texture2D> HeartHealthHUD::s_texture_cache;
-
 namespace {
 
 struct HeartSpriteConfig {
@@ -188,6 +188,77 @@ const HeartSpriteConfig& heart_health_defaults() {
     return cached ? *cached : kFallback;
 }
 
+// Fallback circles reach 28 px from the slot origin whatever the spacing
+constexpr float kFallbackHeartExtent = 28.0f;
+
+void draw_heart(const HeartSpriteConfig& cfg, const TextureRegion& region,
+                Texture2D tex, Vector2 pos, int heart_index,
+                int current_half_hearts) {
+    // Determine which sprite to draw
+    int half_hearts_for_this_position = current_half_hearts - (heart_index * 2);
+    int sprite_col, sprite_row;
+
+    if (half_hearts_for_this_position >= 2) {
+        sprite_col = cfg.full_col;
+        sprite_row = cfg.full_row;
+    } else if (half_hearts_for_this_position == 1) {
+        sprite_col = cfg.half_col;
+        sprite_row = cfg.half_row;
+    } else {
+        if (!cfg.show_empty) return;
+        sprite_col = cfg.empty_col;
+        sprite_row = cfg.empty_row;
+    }
+
+    // Draw heart sprite
+    if (tex.id > 0) {
+        Rectangle source = region.map(
+            Rectangle{static_cast<float>(sprite_col * cfg.tile_size),
+                      static_cast<float>(sprite_row * cfg.tile_size),
+                      static_cast<float>(cfg.tile_size),
+                      static_cast<float>(cfg.tile_size)});
+
+        float heart_x = pos.x + (heart_index * cfg.spacing);
+        Rectangle dest = {heart_x,
+                          pos.y,
+                          static_cast<float>(cfg.spacing),
+                          static_cast<float>(cfg.spacing)};
+
+        draw::texture_pro(tex, source, dest, {0, 0}, 0.0f, WHITE);
+    } else {
+        // Fallback: draw circle
+        float heart_x = pos.x + (heart_index * cfg.spacing);
+        bool is_full = (half_hearts_for_this_position >= 2);
+        bool is_half = (half_hearts_for_this_position == 1);
+
+        if (is_full) {
+            draw::circle(static_cast<int>(heart_x + 16),
+                         static_cast<int>(pos.y + 16),
+                         12,
+                         RED);
+        } else if (is_half) {
+            draw::circle_sector(
+                Vector2{heart_x + 16, pos.y + 16}, 12, 90, 270, 16, RED);
+        } else if (cfg.show_empty) {
+            draw::circle(static_cast<int>(heart_x + 16),
+                         static_cast<int>(pos.y + 16),
+                         12,
+                         ColorAlpha(RED, 0.3f));
+            draw::circle_lines(static_cast<int>(heart_x + 16),
+                               static_cast<int>(pos.y + 16),
+                               12,
+                               RED);
+        }
+    }
+}
+
+// Both counts identify what the cache holds
+uint64_t health_key(int half_hearts, int max_half_hearts) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(max_half_hearts))
+            << 32) |
+           static_cast<uint32_t>(half_hearts);
+}
+
 }  // namespace
 
 HeartHealthHUD::HeartHealthHUD(
@@ -275,87 +346,61 @@ Vector2 HeartHealthHUD::calculate_position() const {
                    anchor_y + m_hud_data.offset_y};
 }
 
-Texture2D HeartHealthHUD::get_texture(const std::string& path) const {
-    if (s_texture_cache.find(path) == s_texture_cache.end()) {
-        std::string full_path = udj::core::filesystem::get_assets_path(path);
-        Texture2D tex = LoadTexture(full_path.c_str());
-        if (tex.id > 0) {
-            s_texture_cache[path] = tex;
-            udj::core::Logger::info("Loaded heart sprite sheet: %", full_path);
-        } else {
-            udj::core::Logger::error("Failed to load heart sprite sheet: %",
-                                     full_path);
-        }
+int HeartHealthHUD::get_max_hearts() const {
+    // Base runtime values come from events (HealthComponent units).
+    int max_hearts = (m_max_half_hearts + 1) / 2;
+
+    // Level can still override number of heart slots shown.
+    if (auto it = m_hud_data.properties.find("max_hearts");
+        it != m_hud_data.properties.end()) {
+        if (auto v = parse_int(it->second)) max_hearts = *v;
     }
-    return s_texture_cache[path];
+    return max_hearts;
+}
+
+Rectangle HeartHealthHUD::calculate_bounds() const {
+    const float spacing = static_cast<float>(
+        apply_level_overrides(m_hud_data, heart_health_defaults()).spacing);
+    const float slot = std::max(spacing, kFallbackHeartExtent);
+    const int max_hearts = std::max(1, get_max_hearts());
+    const Vector2 pos = calculate_position();
+    const float width = spacing * static_cast<float>(max_hearts - 1) + slot;
+    return Rectangle{pos.x, pos.y, width, slot};
 }
 
-void HeartHealthHUD::draw_heart(Vector2 pos, int heart_index,
-                                int current_half_hearts) const {
+void HeartHealthHUD::draw_contents() const {
     // Config comes from the HUD preset defaults, overridden by the level's HUD
     // properties (if provided).
     const HeartSpriteConfig cfg =
         apply_level_overrides(m_hud_data, heart_health_defaults());
+    auto& texture_manager = TextureManager::get_instance();
+    const TextureRegion region = texture_manager.get_region(cfg.sheet);
+    const Texture2D tex = texture_manager.get(region.handle);
+    const int max_hearts = get_max_hearts();
+    const Vector2 pos = calculate_position();
 
-    // Determine which sprite to draw
-    int half_hearts_for_this_position = current_half_hearts - (heart_index * 2);
-    int sprite_col, sprite_row;
-
-    if (half_hearts_for_this_position >= 2) {
-        sprite_col = cfg.full_col;
-        sprite_row = cfg.full_row;
-    } else if (half_hearts_for_this_position == 1) {
-        sprite_col = cfg.half_col;
-        sprite_row = cfg.half_row;
-    } else {
-        if (!cfg.show_empty) return;
-        sprite_col = cfg.empty_col;
-        sprite_row = cfg.empty_row;
+    // Draw all hearts
+    for (int i = 0; i < max_hearts; ++i) {
+        draw_heart(cfg, region, tex, pos, i, m_current_half_hearts);
     }
+}
 
-    // Load and draw heart sprite
-    Texture2D tex = get_texture(cfg.sheet);
-    if (tex.id > 0) {
-        Rectangle source = {static_cast<float>(sprite_col * cfg.tile_size),
-                            static_cast<float>(sprite_row * cfg.tile_size),
-                            static_cast<float>(cfg.tile_size),
-                            static_cast<float>(cfg.tile_size)};
-
-        float heart_x = pos.x + (heart_index * cfg.spacing);
-        Rectangle dest = {heart_x,
-                          pos.y,
-                          static_cast<float>(cfg.spacing),
-                          static_cast<float>(cfg.spacing)};
-
-        DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-    } else {
-        // Fallback: draw circle
-        float heart_x = pos.x + (heart_index * cfg.spacing);
-        bool is_full = (half_hearts_for_this_position >= 2);
-        bool is_half = (half_hearts_for_this_position == 1);
+void HeartHealthHUD::prepare(float scale) const {
+    if (!m_visible || m_max_half_hearts < 0 || m_current_half_hearts < 0) {
+        return;
+    }
 
-        if (is_full) {
-            DrawCircle(static_cast<int>(heart_x + 16),
-                       static_cast<int>(pos.y + 16),
-                       12,
-                       RED);
-        } else if (is_half) {
-            DrawCircleSector(
-                Vector2{heart_x + 16, pos.y + 16}, 12, 90, 270, 16, RED);
-        } else if (cfg.show_empty) {
-            DrawCircle(static_cast<int>(heart_x + 16),
-                       static_cast<int>(pos.y + 16),
-                       12,
-                       ColorAlpha(RED, 0.3f));
-            DrawCircleLines(static_cast<int>(heart_x + 16),
-                            static_cast<int>(pos.y + 16),
-                            12,
-                            RED);
-        }
+    const uint64_t contents = health_key(m_current_half_hearts,
+                                         m_max_half_hearts);
+    if (m_cache.is_current(m_cached_bounds, scale, contents)) {
+        return;
     }
+    m_cached_bounds = calculate_bounds();
+    m_cache.update(
+        m_cached_bounds, scale, contents, [this] { draw_contents(); });
 }
 
-void HeartHealthHUD::draw() const {
+void HeartHealthHUD::draw(SpriteBatch* /*batch*/) const {
     if (!m_visible) {
         return;
     }
@@ -364,21 +409,9 @@ void HeartHealthHUD::draw() const {
         return;
     }
 
-    // Base runtime values come from events (HealthComponent units).
-    int current_half_hearts = m_current_half_hearts;
-    int max_hearts = (m_max_half_hearts + 1) / 2;
-
-    // Level can still override number of heart slots shown.
-    if (auto it = m_hud_data.properties.find("max_hearts");
-        it != m_hud_data.properties.end()) {
-        if (auto v = parse_int(it->second)) max_hearts = *v;
-    }
-
-    Vector2 pos = calculate_position();
-
-    // Draw all hearts
-    for (int i = 0; i < max_hearts; ++i) {
-        draw_heart(pos, i, current_half_hearts);
+    // Fall back to direct drawing if the cache is missing or stale
+    if (!m_cache.draw(health_key(m_current_half_hearts, m_max_half_hearts))) {
+        draw_contents();
     }
 }
 
@@ -1,14 +1,28 @@
 // Copyright 2025 Quentin Cartier
 #include "udjourney/hud/scene/ScoreDisplayHUD.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 
 #include "udjourney/Game.hpp"
+#include "udjourney/render/Draw.hpp"
 
 namespace udjourney {
 namespace hud {
 namespace scene {
 
+namespace {
+constexpr int kScoreFontSize = 20;
+constexpr int kScoreTextPadding = 10;
+
+void format_score(char* out, size_t size, int score) {
+    snprintf(out, size, "Score: %d", score);
+}
+
+uint64_t score_key(int score) { return static_cast<uint32_t>(score); }
+}  // namespace
+
 ScoreDisplayHUD::ScoreDisplayHUD(const udjourney::scene::HUDData& hud_data,
                                  udjourney::Game* game) :
     m_hud_data(hud_data), m_game(game), m_visible(hud_data.visible) {}
@@ -63,28 +77,69 @@ Vector2 ScoreDisplayHUD::calculate_position() const {
                    anchor_y + m_hud_data.offset_y};
 }
 
-void ScoreDisplayHUD::draw() const {
+Rectangle ScoreDisplayHUD::calculate_bounds(const char* score_text) const {
+    const Vector2 pos = calculate_position();
+    // Panel, grown to fit the text if the HUD size is smaller than it
+    const int text_width = draw::measure_text(score_text, kScoreFontSize);
+    return Rectangle{
+        pos.x,
+        pos.y,
+        std::max(m_hud_data.size_x,
+                 static_cast<float>(kScoreTextPadding + text_width)),
+        std::max(m_hud_data.size_y,
+                 static_cast<float>(kScoreTextPadding + kScoreFontSize))};
+}
+
+void ScoreDisplayHUD::prepare(float scale) const {
     if (!m_visible || !m_game) {
         return;
     }
 
+    const int score = m_game->get_score();
+    if (m_cache.is_current(m_cached_bounds, scale, score_key(score))) {
+        return;
+    }
+
+    char score_text[64];
+    format_score(score_text, sizeof(score_text), score);
+    m_cached_bounds = calculate_bounds(score_text);
+    m_cache.update(m_cached_bounds,
+                   scale,
+                   score_key(score),
+                   [this, score] { draw_contents(score, nullptr); });
+}
+
+void ScoreDisplayHUD::draw(SpriteBatch* batch) const {
+    if (!m_visible || !m_game) {
+        return;
+    }
+
+    // Fall back to direct drawing if the cache is missing or stale
+    const int score = m_game->get_score();
+    if (!m_cache.draw(score_key(score))) {
+        draw_contents(score, batch);
+    }
+}
+
+void ScoreDisplayHUD::draw_contents(int score, SpriteBatch* batch) const {
     Vector2 pos = calculate_position();
 
     // Draw background
-    DrawRectangle(static_cast<int>(pos.x),
-                  static_cast<int>(pos.y),
-                  static_cast<int>(m_hud_data.size_x),
-                  static_cast<int>(m_hud_data.size_y),
-                  ColorAlpha(BLACK, 0.5f));
+    draw::rectangle(static_cast<int>(pos.x),
+                    static_cast<int>(pos.y),
+                    static_cast<int>(m_hud_data.size_x),
+                    static_cast<int>(m_hud_data.size_y),
+                    ColorAlpha(BLACK, 0.5f));
 
     // Draw score text
     char score_text[64];
-    snprintf(score_text, sizeof(score_text), "Score: %d", m_game->get_score());
-    DrawText(score_text,
-             static_cast<int>(pos.x + 10),
-             static_cast<int>(pos.y + 10),
-             20,
-             WHITE);
+    format_score(score_text, sizeof(score_text), score);
+    draw::text(score_text,
+               static_cast<int>(pos.x + kScoreTextPadding),
+               static_cast<int>(pos.y + kScoreTextPadding),
+               kScoreFontSize,
+               WHITE,
+               batch);
 }
 
 }  // namespace scene
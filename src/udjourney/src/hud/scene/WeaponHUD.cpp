@@ -6,18 +6,26 @@
 #include <memory>
 #include <string>
 
-#include <udj-core/CoreUtils.hpp>
 #include <udj-core/Logger.hpp>
 
 #include "udjourney/core/events/IEvent.hpp"
 #include "udjourney/core/events/WeaponSelectedEvent.hpp"
 #include "udjourney/Projectile.hpp"
 #include "udjourney/ProjectilePresetLoader.hpp"
+#include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
 
 namespace udjourney {
 namespace hud {
 namespace scene {
 
+namespace {
+constexpr int kWeaponFontSize = 20;
+constexpr float kPreviewSize = 32.0f;
+constexpr float kPreviewRaise = 6.0f;  // Icon is centered on the text
+constexpr float kPreviewSpacing = 8.0f;
+}  // namespace
+
 WeaponHUD::WeaponHUD(
     const udjourney::scene::HUDData& hud_data,
     udjourney::core::events::EventDispatcher& event_dispatcher) :
@@ -35,15 +43,7 @@ WeaponHUD::WeaponHUD(
     m_projectile_loader = std::make_unique<udjourney::ProjectilePresetLoader>();
 }
 
-WeaponHUD::~WeaponHUD() {
-    // Unload cached textures
-    for (auto& [path, texture] : m_texture_cache) {
-        if (texture.id > 0) {
-            UnloadTexture(texture);
-        }
-    }
-    m_texture_cache.clear();
-}
+WeaponHUD::~WeaponHUD() = default;
 
 void WeaponHUD::load_projectile_presets(const std::string& config_file) {
     if (m_projectile_loader) {
@@ -52,33 +52,10 @@ void WeaponHUD::load_projectile_presets(const std::string& config_file) {
 }
 
 void WeaponHUD::set_weapon_name(const std::string& weapon_name) {
-    m_weapon_name = weapon_name;
-}
-
-Texture2D WeaponHUD::load_texture_cached(const std::string& texture_path) {
-    // Check cache first
-    auto it = m_texture_cache.find(texture_path);
-    if (it != m_texture_cache.end()) {
-        return it->second;
+    if (weapon_name != m_weapon_name) {
+        m_weapon_name = weapon_name;
+        ++m_weapon_version;
     }
-
-    // Load texture
-    std::string full_path =
-        udj::core::filesystem::get_assets_path(texture_path);
-    Texture2D texture = {0};
-
-    if (udj::core::filesystem::file_exists(full_path)) {
-        texture = LoadTexture(full_path.c_str());
-        if (texture.id > 0) {
-            m_texture_cache[texture_path] = texture;
-            udj::core::Logger::info("Loaded weapon texture: %", full_path);
-        } else {
-            udj::core::Logger::error("Failed to load weapon texture: %",
-                                     full_path);
-        }
-    }
-
-    return texture;
 }
 
 Vector2 WeaponHUD::calculate_position() const {
@@ -131,11 +108,46 @@ Vector2 WeaponHUD::calculate_position() const {
                    anchor_y + m_hud_data.offset_y};
 }
 
-void WeaponHUD::draw() const {
+Rectangle WeaponHUD::calculate_bounds() const {
+    const Vector2 pos = calculate_position();
+    const char* weapon_cstr =
+        m_weapon_name.empty() ? "(none)" : m_weapon_name.c_str();
+    // Preview icon (32 px, raised by 6 px) + spacing + name text
+    const float text_width =
+        static_cast<float>(draw::measure_text(weapon_cstr, kWeaponFontSize));
+    return Rectangle{pos.x,
+                     pos.y - kPreviewRaise,
+                     kPreviewSize + kPreviewSpacing + text_width,
+                     kPreviewSize};
+}
+
+void WeaponHUD::prepare(float scale) const {
+    if (!m_visible) {
+        return;
+    }
+
+    if (m_render_cache.is_current(m_cached_bounds, scale, m_weapon_version)) {
+        return;
+    }
+    m_cached_bounds = calculate_bounds();
+    m_render_cache.update(m_cached_bounds,
+                          scale,
+                          m_weapon_version,
+                          [this] { draw_contents(nullptr); });
+}
+
+void WeaponHUD::draw(SpriteBatch* batch) const {
     if (!m_visible) {
         return;
     }
 
+    // Fall back to direct drawing if the cache is missing or stale
+    if (!m_render_cache.draw(m_weapon_version)) {
+        draw_contents(batch);
+    }
+}
+
+void WeaponHUD::draw_contents(SpriteBatch* batch) const {
     Vector2 pos = calculate_position();
 
     const char* weapon_cstr =
@@ -153,48 +165,47 @@ void WeaponHUD::draw() const {
         const auto* preset = m_projectile_loader->get_preset(m_weapon_name);
 
         if (preset && !preset->texture_file.empty()) {
-            Texture2D texture =
-                const_cast<WeaponHUD*>(this)->load_texture_cached(
-                    preset->texture_file);
+            Texture2D texture = TextureManager::get_instance().get_texture(
+                preset->texture_file);
 
             if (texture.id > 0) {
                 // Define preview size (small icon next to text)
-                const int preview_size = 32;
+                const int preview_size = static_cast<int>(kPreviewSize);
 
                 if (preset->use_atlas) {
                     // Draw from atlas using source rectangle
                     Rectangle dest = {
                         static_cast<float>(preview_x),
-                        static_cast<float>(text_y -
-                                           6),  // Center vertically with text
+                        static_cast<float>(text_y) - kPreviewRaise,
                         static_cast<float>(preview_size),
                         static_cast<float>(preview_size)};
 
-                    DrawTexturePro(texture,
-                                   preset->source_rect,
-                                   dest,
-                                   Vector2{0, 0},
-                                   0.0f,
-                                   WHITE);
+                    draw::texture_pro(texture,
+                                      preset->source_rect,
+                                      dest,
+                                      Vector2{0, 0},
+                                      0.0f,
+                                      WHITE);
                 } else {
                     // Draw full texture scaled down
-                    DrawTextureEx(
+                    draw::texture_ex(
                         texture,
                         Vector2{static_cast<float>(preview_x),
-                                static_cast<float>(text_y - 6)},
+                                static_cast<float>(text_y) - kPreviewRaise},
                         0.0f,
                         static_cast<float>(preview_size) / texture.width,
                         WHITE);
                 }
 
                 // Update position for weapon name text
-                preview_x += preview_size + 8;  // Add spacing
+                preview_x += preview_size +
+                             static_cast<int>(kPreviewSpacing);  // Add spacing
             }
         }
     }
 
     // Draw weapon name after preview
-    DrawText(weapon_cstr, preview_x, text_y, 20, YELLOW);
+    draw::text(weapon_cstr, preview_x, text_y, kWeaponFontSize, YELLOW, batch);
 }
 
 }  // namespace scene
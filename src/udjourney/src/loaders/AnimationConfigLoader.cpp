@@ -14,8 +14,8 @@
 #include <nlohmann/json.hpp>
 
 #include <udj-core/Logger.hpp>
-#include "udjourney/managers/TextureManager.hpp"
-#include "udjourney/SpriteAnim.hpp"
+#include "udjourney/AnimationClipLibrary.hpp"
+#include "udjourney/loaders/PresetBundle.hpp"
 
 using json = nlohmann::json;
 
@@ -24,6 +24,11 @@ namespace loaders {
 
 animation::AnimationPresetConfig AnimationConfigLoader::load_preset(
     const std::string& filename) {
+    if (const auto* cooked =
+            PresetBundle::get_instance().find_animation(filename)) {
+        return *cooked;
+    }
+
     udjourney::Logger::info("Loading animation preset from: %", filename);
 
     std::ifstream file(filename);
@@ -137,79 +142,19 @@ animation::AnimationPresetConfig AnimationConfigLoader::load_preset(
 
 AnimSpriteController AnimationConfigLoader::create_controller(
     const animation::AnimationPresetConfig& config) {
-    AnimSpriteController controller;
-    auto& texture_manager = TextureManager::get_instance();
-
-    for (const auto& anim_config : config.animations) {
-        const auto& sprite_cfg = anim_config.sprite_config;
-
-        // Load texture
-        Texture2D texture = texture_manager.get_texture(sprite_cfg.filename);
-
-        // Frame count is simply the number of frames specified
-        int frame_count = sprite_cfg.frames.size();
-
-        // Get starting position from first frame (for now, assume linear
-        // sequence)
-        int start_row = 0;
-        int start_col = 0;
-        if (!sprite_cfg.frames.empty()) {
-            start_row = sprite_cfg.frames[0].row;
-            start_col = sprite_cfg.frames[0].col;
-        }
-
-        // Create SpriteAnim with starting position
-        SpriteAnim sprite_anim(texture,
-                               sprite_cfg.sprite_width,
-                               sprite_cfg.sprite_height,
-                               sprite_cfg.frame_duration,
-                               frame_count,
-                               sprite_cfg.loop,
-                               start_row,
-                               start_col);
-
-        // Add animation to controller
-        // If state_id is in PlayerState range (0-4), add as PlayerState enum
-        // Otherwise, add as integer state (for MonsterState, etc.)
-        if (anim_config.state_id >= 0 && anim_config.state_id <= 4) {
-            // PlayerState range: IDLE=0, RUNNING=1, JUMPING=2, DASHING=3,
-            // FALLING=4
-            controller.add_animation(
-                static_cast<PlayerState>(anim_config.state_id),
-                anim_config.name,
-                sprite_anim);
-            udjourney::Logger::info(
-                "Added PlayerState animation '%' (state %) with % frames from "
-                "row %, col %",
-                anim_config.name,
-                anim_config.state_id,
-                frame_count,
-                start_row,
-                start_col);
-        } else {
-            // Monster or other entity states
-            controller.add_animation(anim_config.state_id,
-                                     anim_config.name,
-                                     sprite_anim,
-                                     anim_config.collision_bounds);
-            udjourney::Logger::info(
-                "Added animation '%' (state %) with % frames from row %, col %",
-                anim_config.name,
-                anim_config.state_id,
-                frame_count,
-                start_row,
-                start_col);
-        }
-    }
-
-    return controller;
+    return AnimSpriteController(animation::AnimationClipLibrary::build(config));
 }
 
 AnimSpriteController AnimationConfigLoader::load_and_create(
     const std::string& filename) {
-    Logger::info("Loading and creating animation controller from: %", filename);
-    auto config = load_preset(filename);
-    return create_controller(config);
+    // Clips are built once per preset and shared by every actor using it
+    auto& library = animation::AnimationClipLibrary::get_instance();
+    auto clips = library.find(filename);
+    if (!clips) {
+        Logger::info("Building animation clips from: %", filename);
+        clips = library.add(filename, load_preset(filename));
+    }
+    return AnimSpriteController(std::move(clips));
 }
 
 }  // namespace loaders
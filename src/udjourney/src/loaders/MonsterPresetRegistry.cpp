@@ -0,0 +1,43 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/loaders/MonsterPresetRegistry.hpp"
+
+#include <exception>
+#include <memory>
+#include <string>
+
+#include <udj-core/Logger.hpp>
+
+#include "udjourney/loaders/MonsterPresetLoader.hpp"
+
+namespace udjourney {
+
+MonsterPresetRegistry& MonsterPresetRegistry::get_instance() {
+    static MonsterPresetRegistry instance;
+    return instance;
+}
+
+std::shared_ptr<const MonsterPreset> MonsterPresetRegistry::get(
+    const std::string& preset_name) {
+    auto iter = presets_.find(preset_name);
+    if (iter != presets_.end()) {
+        return iter->second;
+    }
+
+    std::shared_ptr<const MonsterPreset> preset;
+    try {
+        preset = MonsterPresetLoader::load_preset(preset_name + ".json");
+    } catch (const std::exception& e) {
+        udj::core::Logger::error(
+            "Failed to load monster preset '%': %", preset_name, e.what());
+    }
+    presets_.emplace(preset_name, preset);
+    return preset;
+}
+
+void MonsterPresetRegistry::invalidate(const std::string& preset_name) {
+    presets_.erase(preset_name);
+}
+
+void MonsterPresetRegistry::clear() { presets_.clear(); }
+
+}  // namespace udjourney
@@ -10,6 +10,8 @@
 #include <udj-core/CoreUtils.hpp>
 #include <udj-core/Logger.hpp>
 
+#include "udjourney/loaders/PresetBundle.hpp"
+
 using json = nlohmann::json;
 
 namespace udjourney {
@@ -37,8 +39,17 @@ Vector2 parse_vector2(const json& j, const Vector2& default_vec) {
 }  // namespace
 
 bool ParticlePresetLoader::load_from_file(const std::string& filepath) {
-    std::string full_path = udj::core::filesystem::get_assets_path(filepath);
+    if (const auto* cooked =
+            loaders::PresetBundle::get_instance().find_particles(filepath)) {
+        for (const auto& preset : *cooked) {
+            presets_[preset.name] = preset;
+        }
+        return true;
+    }
+    return load_from_path(udj::core::filesystem::get_assets_path(filepath));
+}
 
+bool ParticlePresetLoader::load_from_path(const std::string& full_path) {
     if (!udj::core::filesystem::file_exists(full_path)) {
         std::cerr << "Particle preset file not found: " << full_path
                   << std::endl;
@@ -114,6 +125,22 @@ bool ParticlePresetLoader::load_from_file(const std::string& filepath) {
             preset.emitter_lifetime =
                 particle_json.value("emitter_lifetime", 0.0f);
 
+            // World collision
+            preset.collide_with_world =
+                particle_json.value("collide_with_world", false);
+            preset.world_bounce = particle_json.value("world_bounce", 0.4f);
+
+            // Baked flipbook
+            preset.bake = particle_json.value("bake", false);
+            preset.bake_sheet = particle_json.value(
+                "bake_sheet", "particles/baked/" + preset.name + ".png");
+            preset.bake_frame_count =
+                particle_json.value("bake_frame_count", 16);
+            preset.bake_columns = particle_json.value("bake_columns", 4);
+            preset.bake_frame_size = particle_json.value("bake_frame_size", 64);
+            preset.bake_fps = particle_json.value("bake_fps", 20.0f);
+            preset.bake_seed = particle_json.value("bake_seed", 1u);
+
             presets_[preset.name] = preset;
             udj::core::Logger::info("Loaded particle preset: %", preset.name);
         }
@@ -148,4 +175,11 @@ std::vector<std::string> ParticlePresetLoader::get_preset_names() const {
     return names;
 }
 
+void ParticlePresetLoader::for_each_preset(
+    const std::function<void(ParticlePreset&)>& visitor) {
+    for (auto& [_, preset] : presets_) {
+        visitor(preset);
+    }
+}
+
 }  // namespace udjourney
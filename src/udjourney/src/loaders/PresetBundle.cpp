@@ -0,0 +1,812 @@
+// Copyright 2025 Quentin Cartier
+//
+// Cooked preset bundle (.udp), written by udj-preset-bundler.
+//
+// Same layout as the compiled levels: a fixed Header, one array of
+// fixed-size records per section and an interned string table. Monsters
+// point at their animation preset by index; children (states,
+// transitions, clips, frames) are (first, count) ranges. The header holds
+// an FNV-1a checksum of everything after it, so a truncated or corrupted
+// bundle is rejected as a whole and the loaders fall back to the JSON.
+//
+// Bump kVersion whenever a record changes.
+
+#include "udjourney/loaders/PresetBundle.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <udj-core/BinaryTable.hpp>
+#include <udj-core/CoreUtils.hpp>
+#include <udj-core/Logger.hpp>
+#include <udj-core/MappedFile.hpp>
+
+namespace udjourney {
+namespace loaders {
+
+namespace {
+
+constexpr char kMagic[4] = {'U', 'D', 'P', '1'};
+constexpr uint32_t kVersion = 1;
+
+using udj::core::binary::Section;
+using udj::core::binary::StrRef;
+
+enum SectionId : uint32_t {
+    kMonsters,
+    kStateNames,
+    kTransitions,
+    kDurations,
+    kAnimations,
+    kClips,
+    kFrames,
+    kParticles,
+    kProjectiles,
+    kSources,
+    kStrings,
+    kSectionCount
+};
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t file_size;
+    uint32_t checksum;  // Of the bytes after the header
+    StrRef particle_file;
+    StrRef projectile_file;
+    Section sections[kSectionCount];
+};
+
+struct MonsterRecord {
+    StrRef asset_path;
+    StrRef name;
+    StrRef display_name;
+    StrRef animation_preset_file;
+    StrRef sprite_sheet;
+    StrRef attack_sound;
+    StrRef hurt_sound;
+    StrRef death_sound;
+    StrRef initial_state;
+    float stats[6];
+    float behavior[8];
+    float width;
+    float height;
+    uint32_t animation;
+    uint32_t first_state;
+    uint32_t state_count;
+    uint32_t first_transition;
+    uint32_t transition_count;
+    uint32_t first_duration;
+    uint32_t duration_count;
+    uint8_t can_jump;
+    uint8_t can_fly;
+    uint8_t can_climb;
+    uint8_t reserved;
+};
+
+struct TransitionRecord {
+    StrRef from_state;
+    StrRef to_state;
+    StrRef condition;
+    float condition_value;
+};
+
+struct DurationRecord {
+    StrRef state;
+    float seconds;
+};
+
+struct AnimationRecord {
+    StrRef asset_path;
+    StrRef preset_name;
+    uint32_t first_clip;
+    uint32_t clip_count;
+};
+
+struct ClipRecord {
+    StrRef name;
+    StrRef filename;
+    int32_t state_id;
+    float bounds[4];
+    int32_t sprite_width;
+    int32_t sprite_height;
+    float frame_duration;
+    uint32_t first_frame;
+    uint32_t frame_count;
+    uint32_t loop;
+};
+
+struct FrameRecord {
+    int32_t row;
+    int32_t col;
+};
+
+struct ParticleRecord {
+    StrRef name;
+    StrRef texture_file;
+    StrRef bake_sheet;
+    float source_rect[4];
+    float emission_rate;
+    int32_t burst_count;
+    float particle_lifetime;
+    float lifetime_variance;
+    float velocity_min[2];
+    float velocity_max[2];
+    float acceleration[2];
+    uint8_t start_color[4];
+    uint8_t end_color[4];
+    float start_size;
+    float end_size;
+    float rotation_speed;
+    float emitter_lifetime;
+    float world_bounce;
+    int32_t bake_frame_count;
+    int32_t bake_columns;
+    int32_t bake_frame_size;
+    float bake_fps;
+    uint32_t bake_seed;
+    uint8_t use_atlas;
+    uint8_t collide_with_world;
+    uint8_t bake;
+    uint8_t reserved;
+};
+
+struct ProjectileRecord {
+    StrRef name;
+    StrRef texture_file;
+    int32_t tile[6];  // width, height, x_index, y_index, x_span, y_span
+    float source_rect[4];
+    uint32_t trajectory;
+    float speed;
+    float gravity;
+    float amplitude;
+    float frequency;
+    float lifetime;
+    float collision_bounds[4];
+    int32_t damage;
+    uint32_t use_atlas;
+};
+
+constexpr std::array<size_t, kSectionCount> kRecordSizes = {
+    sizeof(MonsterRecord),
+    sizeof(StrRef),
+    sizeof(TransitionRecord),
+    sizeof(DurationRecord),
+    sizeof(AnimationRecord),
+    sizeof(ClipRecord),
+    sizeof(FrameRecord),
+    sizeof(ParticleRecord),
+    sizeof(ProjectileRecord),
+    sizeof(StrRef),
+    1,
+};
+
+// Sections stay 4-byte aligned and records copy as plain bytes
+static_assert(sizeof(Header) % 4 == 0);
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(sizeof(MonsterRecord) % 4 == 0 &&
+              sizeof(ClipRecord) % 4 == 0 &&
+              sizeof(ParticleRecord) % 4 == 0 &&
+              sizeof(ProjectileRecord) % 4 == 0);
+
+using Writer = udj::core::binary::TableWriter<kSectionCount>;
+using Reader = udj::core::binary::TableReader<kSectionCount>;
+
+// Callers pass either asset-relative paths or paths under the assets dir
+std::string asset_key(const std::string& path) {
+    const std::string base = udj::core::filesystem::get_assets_base_path();
+    if (path.compare(0, base.size(), base) == 0) {
+        return path.substr(base.size());
+    }
+    return path;
+}
+
+void write_monster(Writer* writer, const std::string& asset_path,
+                   const MonsterPreset& preset, uint32_t animation) {
+    const MonsterStats& stats = preset.stats;
+    const MonsterBehavior& behavior = preset.behavior;
+    const MonsterStateConfig& states = preset.state_config;
+
+    MonsterRecord record{};
+    record.asset_path = writer->intern(asset_path);
+    record.name = writer->intern(preset.name);
+    record.display_name = writer->intern(preset.display_name);
+    record.animation_preset_file =
+        writer->intern(preset.animation_preset_file);
+    record.sprite_sheet = writer->intern(preset.sprite_sheet);
+    record.attack_sound = writer->intern(preset.attack_sound);
+    record.hurt_sound = writer->intern(preset.hurt_sound);
+    record.death_sound = writer->intern(preset.death_sound);
+    record.initial_state = writer->intern(states.initial_state);
+    const float stat_values[6] = {stats.max_health,
+                                  stats.movement_speed,
+                                  stats.damage,
+                                  stats.knockback_force,
+                                  stats.attack_cooldown,
+                                  stats.jump_force};
+    std::memcpy(record.stats, stat_values, sizeof(record.stats));
+    const float behavior_values[8] = {behavior.patrol_range,
+                                      behavior.chase_range,
+                                      behavior.attack_range,
+                                      behavior.patrol_speed_multiplier,
+                                      behavior.chase_speed_multiplier,
+                                      behavior.idle_duration,
+                                      behavior.jump_cooldown,
+                                      behavior.patrol_pause_duration};
+    std::memcpy(record.behavior, behavior_values, sizeof(record.behavior));
+    record.width = preset.width;
+    record.height = preset.height;
+    record.animation = animation;
+    record.first_state = writer->count(kStateNames);
+    record.state_count = static_cast<uint32_t>(states.available_states.size());
+    record.first_transition = writer->count(kTransitions);
+    record.transition_count = static_cast<uint32_t>(states.transitions.size());
+    record.first_duration = writer->count(kDurations);
+    record.duration_count =
+        static_cast<uint32_t>(states.state_durations.size());
+    record.can_jump = behavior.can_jump ? 1 : 0;
+    record.can_fly = behavior.can_fly ? 1 : 0;
+    record.can_climb = behavior.can_climb ? 1 : 0;
+    writer->add(kMonsters, record);
+
+    for (const auto& state : states.available_states) {
+        writer->add(kStateNames, writer->intern(state));
+    }
+    for (const auto& transition : states.transitions) {
+        writer->add(kTransitions,
+                    TransitionRecord{writer->intern(transition.from_state),
+                                     writer->intern(transition.to_state),
+                                     writer->intern(transition.condition),
+                                     transition.condition_value});
+    }
+    for (const auto& [state, seconds] : states.state_durations) {
+        writer->add(kDurations,
+                    DurationRecord{writer->intern(state), seconds});
+    }
+}
+
+bool read_monster(const Reader& reader, const MonsterRecord& record,
+                  MonsterPreset* preset) {
+    if (!reader.has_range(kStateNames, record.first_state,
+                          record.state_count) ||
+        !reader.has_range(kTransitions, record.first_transition,
+                          record.transition_count) ||
+        !reader.has_range(kDurations, record.first_duration,
+                          record.duration_count)) {
+        return false;
+    }
+
+    preset->name = reader.str(record.name);
+    preset->display_name = reader.str(record.display_name);
+    preset->animation_preset_file = reader.str(record.animation_preset_file);
+    preset->sprite_sheet = reader.str(record.sprite_sheet);
+    preset->attack_sound = reader.str(record.attack_sound);
+    preset->hurt_sound = reader.str(record.hurt_sound);
+    preset->death_sound = reader.str(record.death_sound);
+    preset->width = record.width;
+    preset->height = record.height;
+
+    MonsterStats& stats = preset->stats;
+    stats.max_health = record.stats[0];
+    stats.movement_speed = record.stats[1];
+    stats.damage = record.stats[2];
+    stats.knockback_force = record.stats[3];
+    stats.attack_cooldown = record.stats[4];
+    stats.jump_force = record.stats[5];
+
+    MonsterBehavior& behavior = preset->behavior;
+    behavior.patrol_range = record.behavior[0];
+    behavior.chase_range = record.behavior[1];
+    behavior.attack_range = record.behavior[2];
+    behavior.patrol_speed_multiplier = record.behavior[3];
+    behavior.chase_speed_multiplier = record.behavior[4];
+    behavior.idle_duration = record.behavior[5];
+    behavior.jump_cooldown = record.behavior[6];
+    behavior.patrol_pause_duration = record.behavior[7];
+    behavior.can_jump = record.can_jump != 0;
+    behavior.can_fly = record.can_fly != 0;
+    behavior.can_climb = record.can_climb != 0;
+
+    MonsterStateConfig& states = preset->state_config;
+    states.initial_state = reader.str(record.initial_state);
+    states.available_states.reserve(record.state_count);
+    for (uint32_t i = 0; i < record.state_count; ++i) {
+        states.available_states.push_back(reader.str(
+            reader.at<StrRef>(kStateNames, record.first_state + i)));
+    }
+    states.transitions.reserve(record.transition_count);
+    for (uint32_t i = 0; i < record.transition_count; ++i) {
+        const auto transition = reader.at<TransitionRecord>(
+            kTransitions, record.first_transition + i);
+        states.transitions.push_back(
+            StateTransition{reader.str(transition.from_state),
+                            reader.str(transition.to_state),
+                            reader.str(transition.condition),
+                            transition.condition_value});
+    }
+    for (uint32_t i = 0; i < record.duration_count; ++i) {
+        const auto duration = reader.at<DurationRecord>(
+            kDurations, record.first_duration + i);
+        states.state_durations[reader.str(duration.state)] = duration.seconds;
+    }
+    return true;
+}
+
+void write_animation(Writer* writer, const std::string& asset_path,
+                     const animation::AnimationPresetConfig& config) {
+    writer->add(kAnimations,
+                AnimationRecord{writer->intern(asset_path),
+                                writer->intern(config.preset_name),
+                                writer->count(kClips),
+                                static_cast<uint32_t>(
+                                    config.animations.size())});
+    for (const auto& state : config.animations) {
+        const auto& sprite = state.sprite_config;
+        ClipRecord clip{};
+        clip.name = writer->intern(state.name);
+        clip.filename = writer->intern(sprite.filename);
+        clip.state_id = state.state_id;
+        clip.bounds[0] = state.collision_bounds.offset_x;
+        clip.bounds[1] = state.collision_bounds.offset_y;
+        clip.bounds[2] = state.collision_bounds.width;
+        clip.bounds[3] = state.collision_bounds.height;
+        clip.sprite_width = sprite.sprite_width;
+        clip.sprite_height = sprite.sprite_height;
+        clip.frame_duration = sprite.frame_duration;
+        clip.first_frame = writer->count(kFrames);
+        clip.frame_count = static_cast<uint32_t>(sprite.frames.size());
+        clip.loop = sprite.loop ? 1 : 0;
+        writer->add(kClips, clip);
+        for (const auto& frame : sprite.frames) {
+            writer->add(kFrames, FrameRecord{frame.row, frame.col});
+        }
+    }
+}
+
+bool read_animation(const Reader& reader, const AnimationRecord& record,
+                    animation::AnimationPresetConfig* config) {
+    if (!reader.has_range(kClips, record.first_clip, record.clip_count)) {
+        return false;
+    }
+    config->preset_name = reader.str(record.preset_name);
+    config->animations.reserve(record.clip_count);
+    for (uint32_t c = 0; c < record.clip_count; ++c) {
+        const auto clip = reader.at<ClipRecord>(kClips, record.first_clip + c);
+        if (!reader.has_range(kFrames, clip.first_frame, clip.frame_count)) {
+            return false;
+        }
+        animation::AnimationStateConfig& state =
+            config->animations.emplace_back();
+        state.name = reader.str(clip.name);
+        state.state_id = clip.state_id;
+        state.collision_bounds = animation::CollisionBounds{
+            clip.bounds[0], clip.bounds[1], clip.bounds[2], clip.bounds[3]};
+        auto& sprite = state.sprite_config;
+        sprite.filename = reader.str(clip.filename);
+        sprite.sprite_width = clip.sprite_width;
+        sprite.sprite_height = clip.sprite_height;
+        sprite.frame_duration = clip.frame_duration;
+        sprite.loop = clip.loop != 0;
+        sprite.frames.reserve(clip.frame_count);
+        for (uint32_t f = 0; f < clip.frame_count; ++f) {
+            const auto frame =
+                reader.at<FrameRecord>(kFrames, clip.first_frame + f);
+            sprite.frames.push_back(animation::FrameSpec{frame.row, frame.col});
+        }
+    }
+    return true;
+}
+
+ParticleRecord make_particle(Writer* writer, const ParticlePreset& preset) {
+    ParticleRecord record{};
+    record.name = writer->intern(preset.name);
+    record.texture_file = writer->intern(preset.texture_file);
+    record.bake_sheet = writer->intern(preset.bake_sheet);
+    record.source_rect[0] = preset.source_rect.x;
+    record.source_rect[1] = preset.source_rect.y;
+    record.source_rect[2] = preset.source_rect.width;
+    record.source_rect[3] = preset.source_rect.height;
+    record.emission_rate = preset.emission_rate;
+    record.burst_count = preset.burst_count;
+    record.particle_lifetime = preset.particle_lifetime;
+    record.lifetime_variance = preset.lifetime_variance;
+    record.velocity_min[0] = preset.velocity_min.x;
+    record.velocity_min[1] = preset.velocity_min.y;
+    record.velocity_max[0] = preset.velocity_max.x;
+    record.velocity_max[1] = preset.velocity_max.y;
+    record.acceleration[0] = preset.acceleration.x;
+    record.acceleration[1] = preset.acceleration.y;
+    const Color colors[2] = {preset.start_color, preset.end_color};
+    uint8_t* const targets[2] = {record.start_color, record.end_color};
+    for (int i = 0; i < 2; ++i) {
+        targets[i][0] = colors[i].r;
+        targets[i][1] = colors[i].g;
+        targets[i][2] = colors[i].b;
+        targets[i][3] = colors[i].a;
+    }
+    record.start_size = preset.start_size;
+    record.end_size = preset.end_size;
+    record.rotation_speed = preset.rotation_speed;
+    record.emitter_lifetime = preset.emitter_lifetime;
+    record.world_bounce = preset.world_bounce;
+    record.bake_frame_count = preset.bake_frame_count;
+    record.bake_columns = preset.bake_columns;
+    record.bake_frame_size = preset.bake_frame_size;
+    record.bake_fps = preset.bake_fps;
+    record.bake_seed = preset.bake_seed;
+    record.use_atlas = preset.use_atlas ? 1 : 0;
+    record.collide_with_world = preset.collide_with_world ? 1 : 0;
+    record.bake = preset.bake ? 1 : 0;
+    return record;
+}
+
+ParticlePreset read_particle(const Reader& reader,
+                             const ParticleRecord& record) {
+    ParticlePreset preset;
+    preset.name = reader.str(record.name);
+    preset.texture_file = reader.str(record.texture_file);
+    preset.bake_sheet = reader.str(record.bake_sheet);
+    preset.source_rect = Rectangle{record.source_rect[0],
+                                   record.source_rect[1],
+                                   record.source_rect[2],
+                                   record.source_rect[3]};
+    preset.emission_rate = record.emission_rate;
+    preset.burst_count = record.burst_count;
+    preset.particle_lifetime = record.particle_lifetime;
+    preset.lifetime_variance = record.lifetime_variance;
+    preset.velocity_min = Vector2{record.velocity_min[0],
+                                  record.velocity_min[1]};
+    preset.velocity_max = Vector2{record.velocity_max[0],
+                                  record.velocity_max[1]};
+    preset.acceleration = Vector2{record.acceleration[0],
+                                  record.acceleration[1]};
+    preset.start_color = Color{record.start_color[0],
+                               record.start_color[1],
+                               record.start_color[2],
+                               record.start_color[3]};
+    preset.end_color = Color{record.end_color[0],
+                             record.end_color[1],
+                             record.end_color[2],
+                             record.end_color[3]};
+    preset.start_size = record.start_size;
+    preset.end_size = record.end_size;
+    preset.rotation_speed = record.rotation_speed;
+    preset.emitter_lifetime = record.emitter_lifetime;
+    preset.world_bounce = record.world_bounce;
+    preset.bake_frame_count = record.bake_frame_count;
+    preset.bake_columns = record.bake_columns;
+    preset.bake_frame_size = record.bake_frame_size;
+    preset.bake_fps = record.bake_fps;
+    preset.bake_seed = record.bake_seed;
+    preset.use_atlas = record.use_atlas != 0;
+    preset.collide_with_world = record.collide_with_world != 0;
+    preset.bake = record.bake != 0;
+    return preset;
+}
+
+ProjectileRecord make_projectile(Writer* writer,
+                                 const ProjectilePreset& preset) {
+    ProjectileRecord record{};
+    record.name = writer->intern(preset.name);
+    record.texture_file = writer->intern(preset.texture_file);
+    const int32_t tile[6] = {preset.tile_width,
+                             preset.tile_height,
+                             preset.x_index,
+                             preset.y_index,
+                             preset.x_span,
+                             preset.y_span};
+    std::memcpy(record.tile, tile, sizeof(record.tile));
+    record.source_rect[0] = preset.source_rect.x;
+    record.source_rect[1] = preset.source_rect.y;
+    record.source_rect[2] = preset.source_rect.width;
+    record.source_rect[3] = preset.source_rect.height;
+    record.trajectory = static_cast<uint32_t>(preset.trajectory);
+    record.speed = preset.speed;
+    record.gravity = preset.gravity;
+    record.amplitude = preset.amplitude;
+    record.frequency = preset.frequency;
+    record.lifetime = preset.lifetime;
+    record.collision_bounds[0] = preset.collision_bounds.x;
+    record.collision_bounds[1] = preset.collision_bounds.y;
+    record.collision_bounds[2] = preset.collision_bounds.width;
+    record.collision_bounds[3] = preset.collision_bounds.height;
+    record.damage = preset.damage;
+    record.use_atlas = preset.use_atlas ? 1 : 0;
+    return record;
+}
+
+ProjectilePreset read_projectile(const Reader& reader,
+                                 const ProjectileRecord& record) {
+    ProjectilePreset preset;
+    preset.name = reader.str(record.name);
+    preset.texture_file = reader.str(record.texture_file);
+    preset.tile_width = record.tile[0];
+    preset.tile_height = record.tile[1];
+    preset.x_index = record.tile[2];
+    preset.y_index = record.tile[3];
+    preset.x_span = record.tile[4];
+    preset.y_span = record.tile[5];
+    preset.source_rect = Rectangle{record.source_rect[0],
+                                   record.source_rect[1],
+                                   record.source_rect[2],
+                                   record.source_rect[3]};
+    preset.trajectory = static_cast<TrajectoryType>(record.trajectory);
+    preset.speed = record.speed;
+    preset.gravity = record.gravity;
+    preset.amplitude = record.amplitude;
+    preset.frequency = record.frequency;
+    preset.lifetime = record.lifetime;
+    preset.collision_bounds = Rectangle{record.collision_bounds[0],
+                                        record.collision_bounds[1],
+                                        record.collision_bounds[2],
+                                        record.collision_bounds[3]};
+    preset.damage = record.damage;
+    preset.use_atlas = record.use_atlas != 0;
+    return preset;
+}
+
+}  // namespace
+
+PresetBundle& PresetBundle::get_instance() {
+    static PresetBundle instance;
+    return instance;
+}
+
+void PresetBundle::clear() {
+    monsters_.clear();
+    animations_.clear();
+    monster_index_.clear();
+    animation_index_.clear();
+    particle_file_.clear();
+    particles_.clear();
+    projectile_file_.clear();
+    projectiles_.clear();
+}
+
+void PresetBundle::add_monster(const std::string& asset_path,
+                               const MonsterPreset& preset) {
+    auto iter = monster_index_.find(asset_path);
+    if (iter != monster_index_.end()) {
+        monsters_[iter->second].preset = preset;
+        return;
+    }
+    monster_index_.emplace(asset_path, monsters_.size());
+    monsters_.push_back(MonsterEntry{asset_path, preset, kNoAnimation});
+}
+
+void PresetBundle::add_animation(
+    const std::string& asset_path,
+    const animation::AnimationPresetConfig& config) {
+    auto iter = animation_index_.find(asset_path);
+    if (iter != animation_index_.end()) {
+        animations_[iter->second].config = config;
+        return;
+    }
+    animation_index_.emplace(asset_path, animations_.size());
+    animations_.push_back(AnimationEntry{asset_path, config});
+}
+
+void PresetBundle::set_particles(const std::string& asset_path,
+                                 std::vector<ParticlePreset> presets) {
+    particle_file_ = asset_path;
+    particles_ = std::move(presets);
+}
+
+void PresetBundle::set_projectiles(const std::string& asset_path,
+                                   std::vector<ProjectilePreset> presets) {
+    projectile_file_ = asset_path;
+    projectiles_ = std::move(presets);
+}
+
+uint32_t PresetBundle::resolve_animation_(const MonsterPreset& preset) const {
+    auto iter =
+        animation_index_.find("animations/" + preset.animation_preset_file);
+    return iter == animation_index_.end()
+               ? kNoAnimation
+               : static_cast<uint32_t>(iter->second);
+}
+
+std::vector<std::string> PresetBundle::sources_() const {
+    std::vector<std::string> sources;
+    for (const auto& entry : monsters_) {
+        sources.push_back(entry.asset_path);
+    }
+    for (const auto& entry : animations_) {
+        sources.push_back(entry.asset_path);
+    }
+    if (!particle_file_.empty()) {
+        sources.push_back(particle_file_);
+    }
+    if (!projectile_file_.empty()) {
+        sources.push_back(projectile_file_);
+    }
+    return sources;
+}
+
+const MonsterPreset* PresetBundle::find_monster(
+    const std::string& asset_path) const {
+    auto iter = monster_index_.find(asset_key(asset_path));
+    return iter == monster_index_.end() ? nullptr
+                                        : &monsters_[iter->second].preset;
+}
+
+const animation::AnimationPresetConfig* PresetBundle::find_animation(
+    const std::string& asset_path) const {
+    auto iter = animation_index_.find(asset_key(asset_path));
+    return iter == animation_index_.end()
+               ? nullptr
+               : &animations_[iter->second].config;
+}
+
+const animation::AnimationPresetConfig* PresetBundle::find_monster_animation(
+    const std::string& monster_asset_path) const {
+    auto iter = monster_index_.find(asset_key(monster_asset_path));
+    if (iter == monster_index_.end()) {
+        return nullptr;
+    }
+    const uint32_t animation = monsters_[iter->second].animation;
+    return animation == kNoAnimation ? nullptr
+                                     : &animations_[animation].config;
+}
+
+const std::vector<ParticlePreset>* PresetBundle::find_particles(
+    const std::string& asset_path) const {
+    return !particle_file_.empty() && particle_file_ == asset_key(asset_path)
+               ? &particles_
+               : nullptr;
+}
+
+const std::vector<ProjectilePreset>* PresetBundle::find_projectiles(
+    const std::string& asset_path) const {
+    return !projectile_file_.empty() &&
+                   projectile_file_ == asset_key(asset_path)
+               ? &projectiles_
+               : nullptr;
+}
+
+bool PresetBundle::save_to_path(const std::string& full_path) const {
+    Writer writer;
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.particle_file = writer.intern(particle_file_);
+    header.projectile_file = writer.intern(projectile_file_);
+
+    for (const auto& entry : monsters_) {
+        write_monster(&writer,
+                      entry.asset_path,
+                      entry.preset,
+                      resolve_animation_(entry.preset));
+    }
+    for (const auto& entry : animations_) {
+        write_animation(&writer, entry.asset_path, entry.config);
+    }
+    for (const auto& preset : particles_) {
+        writer.add(kParticles, make_particle(&writer, preset));
+    }
+    for (const auto& preset : projectiles_) {
+        writer.add(kProjectiles, make_projectile(&writer, preset));
+    }
+    for (const auto& source : sources_()) {
+        writer.add(kSources, writer.intern(source));
+    }
+
+    std::vector<uint8_t> data = writer.finish(sizeof(Header), header.sections);
+    header.file_size = static_cast<uint32_t>(data.size());
+    header.checksum = udj::core::binary::checksum(
+        data.data() + sizeof(Header), data.size() - sizeof(Header));
+    std::memcpy(data.data(), &header, sizeof(header));
+
+    std::ofstream file(full_path, std::ios::binary);
+    if (!file.is_open() ||
+        !file.write(reinterpret_cast<const char*>(data.data()),
+                    static_cast<std::streamsize>(data.size()))) {
+        udj::core::Logger::error("Failed to write preset bundle: %",
+                                 full_path);
+        return false;
+    }
+    return true;
+}
+
+bool PresetBundle::load_from_path(const std::string& full_path) {
+    clear();
+
+    udj::core::filesystem::MappedFile file(full_path);
+    if (!file.is_open()) {
+        udj::core::Logger::info("No preset bundle at %", full_path);
+        return false;
+    }
+
+    Header header;
+    if (file.size() < sizeof(Header)) {
+        udj::core::Logger::error("Preset bundle % is truncated", full_path);
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion) {
+        udj::core::Logger::warning(
+            "Preset bundle % has an unknown format or version", full_path);
+        return false;
+    }
+    const Reader reader(
+        file.data(), file.size(), header.sections, kRecordSizes);
+    if (header.file_size != file.size() || !reader.fits(sizeof(Header)) ||
+        header.checksum !=
+            udj::core::binary::checksum(file.data() + sizeof(Header),
+                                        file.size() - sizeof(Header))) {
+        udj::core::Logger::error("Preset bundle % is corrupted", full_path);
+        return false;
+    }
+
+    // A preset JSON edited since the bundle was cooked wins
+    std::vector<std::string> sources;
+    sources.reserve(reader.count(kSources));
+    for (uint32_t i = 0; i < reader.count(kSources); ++i) {
+        sources.push_back(udj::core::filesystem::get_assets_base_path() +
+                          reader.str(reader.at<StrRef>(kSources, i)));
+    }
+    if (!udj::core::filesystem::is_up_to_date(full_path, sources)) {
+        return false;
+    }
+
+    // Animations first, so monster indices can be checked against them
+    for (uint32_t i = 0; i < reader.count(kAnimations); ++i) {
+        const auto record = reader.at<AnimationRecord>(kAnimations, i);
+        animation::AnimationPresetConfig config;
+        if (!read_animation(reader, record, &config)) {
+            udj::core::Logger::error("Preset bundle % is corrupted",
+                                     full_path);
+            clear();
+            return false;
+        }
+        add_animation(reader.str(record.asset_path), config);
+    }
+    for (uint32_t i = 0; i < reader.count(kMonsters); ++i) {
+        const auto record = reader.at<MonsterRecord>(kMonsters, i);
+        MonsterPreset preset;
+        if (!read_monster(reader, record, &preset) ||
+            (record.animation != kNoAnimation &&
+             record.animation >= animations_.size())) {
+            udj::core::Logger::error("Preset bundle % is corrupted",
+                                     full_path);
+            clear();
+            return false;
+        }
+        const std::string asset_path = reader.str(record.asset_path);
+        add_monster(asset_path, preset);
+        monsters_[monster_index_[asset_path]].animation = record.animation;
+    }
+
+    particle_file_ = reader.str(header.particle_file);
+    particles_.reserve(reader.count(kParticles));
+    for (uint32_t i = 0; i < reader.count(kParticles); ++i) {
+        particles_.push_back(
+            read_particle(reader, reader.at<ParticleRecord>(kParticles, i)));
+    }
+    projectile_file_ = reader.str(header.projectile_file);
+    projectiles_.reserve(reader.count(kProjectiles));
+    for (uint32_t i = 0; i < reader.count(kProjectiles); ++i) {
+        projectiles_.push_back(read_projectile(
+            reader, reader.at<ProjectileRecord>(kProjectiles, i)));
+    }
+
+    udj::core::Logger::info(
+        "Loaded preset bundle %: % monster(s), % animation(s), % particle "
+        "and % projectile preset(s)",
+        full_path,
+        monsters_.size(),
+        animations_.size(),
+        particles_.size(),
+        projectiles_.size());
+    return true;
+}
+
+}  // namespace loaders
+}  // namespace udjourney
@@ -0,0 +1,86 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/managers/AtlasMap.hpp"
+
+#include <fstream>
+#include <string>
+
+// Include Dreamcast compatibility functions before nlohmann/json
+#ifdef PLATFORM_DREAMCAST
+#include "udjourney/dreamcast_json_compat.h"
+#endif
+
+#include <nlohmann/json.hpp>
+
+#include <udj-core/Logger.hpp>
+
+using json = nlohmann::json;
+
+bool AtlasMap::load_from_file(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    try {
+        json j;
+        file >> j;
+        const auto sheets = j.find("sheets");
+        if (sheets == j.end() || !sheets->is_object()) {
+            udj::core::Logger::warning("AtlasMap: no 'sheets' object in %",
+                                       filename);
+            return false;
+        }
+
+        entries.clear();
+        for (const auto& item : sheets->items()) {
+            const json& value = item.value();
+            AtlasEntry entry;
+            entry.atlas = value.at("atlas").get<std::string>();
+            entry.rect = Rectangle{value.at("x").get<float>(),
+                                   value.at("y").get<float>(),
+                                   value.at("width").get<float>(),
+                                   value.at("height").get<float>()};
+            entries.emplace(item.key(), entry);
+        }
+    } catch (const json::exception& e) {
+        udj::core::Logger::warning(
+            "AtlasMap: cannot parse %: %", filename, e.what());
+        entries.clear();
+        return false;
+    }
+
+    udj::core::Logger::info(
+        "AtlasMap: % sheet(s) remapped from %", entries.size(), filename);
+    return true;
+}
+
+bool AtlasMap::save_to_file(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        udj::core::Logger::error("AtlasMap: cannot write %", filename);
+        return false;
+    }
+
+    // json objects keep their keys sorted, so the cooked file stays diffable
+    json sheets = json::object();
+    for (const auto& [sheet, entry] : entries) {
+        sheets[sheet] = {{"atlas", entry.atlas},
+                         {"x", entry.rect.x},
+                         {"y", entry.rect.y},
+                         {"width", entry.rect.width},
+                         {"height", entry.rect.height}};
+    }
+    json j;
+    j["sheets"] = sheets;
+    file << j.dump(2);
+    return true;
+}
+
+void AtlasMap::add(const std::string& sheet, const AtlasEntry& entry) {
+    entries[sheet] = entry;
+}
+
+const AtlasEntry* AtlasMap::find(const std::string& sheet) const {
+    const auto it = entries.find(sheet);
+    return it != entries.end() ? &it->second : nullptr;
+}
@@ -1,6 +1,8 @@
 // Copyright 2025 Quentin Cartier
 #include "udjourney/managers/BackgroundManager.hpp"
 
+#include <raylib/rlgl.h>
+
 #include <algorithm>
 #include <cmath>
 #include <limits>
@@ -9,14 +11,21 @@
 
 #include <udj-core/Logger.hpp>
 
+#include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
 #include "udjourney/scene/Scene.hpp"
 
 namespace udjourney {
 
-BackgroundManager::~BackgroundManager() { unload_textures_(); }
+BackgroundManager::~BackgroundManager() {
+    release_composites_();
+    unload_textures_();
+}
 
 void BackgroundManager::clear() {
     m_scene = nullptr;
+    release_composites_();
     m_sorted_layers.clear();
     unload_textures_();
     m_ui_scroll_y = 0.0f;
@@ -32,6 +41,7 @@ void BackgroundManager::set_scene(const udjourney::scene::Scene& scene) {
 }
 
 void BackgroundManager::rebuild_sorted_layers_() {
+    release_composites_();
     m_sorted_layers.clear();
     if (!m_scene) {
         return;
@@ -42,14 +52,107 @@ void BackgroundManager::rebuild_sorted_layers_() {
         return;
     }
 
+    // A rotated tile turns around its top-left corner and can reach up to
+    // its diagonal in any direction.
+    constexpr float kDiagonal = 1.4143f;
+
     m_sorted_layers.reserve(layers.size());
     for (const auto& layer : layers) {
-        m_sorted_layers.push_back(&layer);
+        LayerEntry entry;
+        entry.data = &layer;
+        entry.objects.reserve(layer.objects.size());
+
+        float min_y = std::numeric_limits<float>::infinity();
+        float max_y = -std::numeric_limits<float>::infinity();
+        for (const auto& obj : layer.objects) {
+            ObjectEntry object;
+            object.data = &obj;
+            object.source = {static_cast<float>(obj.tile_col * obj.tile_size),
+                             static_cast<float>(obj.tile_row * obj.tile_size),
+                             static_cast<float>(obj.tile_size),
+                             static_cast<float>(obj.tile_size)};
+            object.size = obj.tile_size * obj.scale;
+            object.extent_up =
+                obj.rotation != 0.0f ? object.size * kDiagonal : 0.0f;
+            object.extent_down =
+                obj.rotation != 0.0f ? object.size * kDiagonal : object.size;
+
+            entry.max_extent_up = std::max(entry.max_extent_up,
+                                           object.extent_up);
+            entry.max_extent_down =
+                std::max(entry.max_extent_down, object.extent_down);
+            min_y = std::min(min_y, obj.y);
+            max_y = std::max(max_y, obj.y + object.size);
+
+            entry.objects.push_back(object);
+        }
+
+        // Wrap height of repeating layers comes from the layer contents.
+        // This avoids a "wait until the whole background ends" gap caused by
+        // using an arbitrary wrap height.
+        entry.has_bounds =
+            std::isfinite(min_y) && std::isfinite(max_y) && (max_y > min_y);
+        entry.min_y = entry.has_bounds ? min_y : 0.0f;
+        entry.max_y = entry.has_bounds ? max_y : 0.0f;
+
+        std::vector<float> object_y;
+        object_y.reserve(layer.objects.size());
+        for (const auto& obj : layer.objects) {
+            object_y.push_back(obj.y);
+        }
+        entry.index.build(object_y);
+
+        m_sorted_layers.push_back(std::move(entry));
     }
 
-    std::sort(m_sorted_layers.begin(),
-              m_sorted_layers.end(),
-              [](const auto* a, const auto* b) { return a->depth < b->depth; });
+    std::stable_sort(m_sorted_layers.begin(),
+                     m_sorted_layers.end(),
+                     [](const LayerEntry& a, const LayerEntry& b) {
+                         return a.data->depth < b.data->depth;
+                     });
+
+    // Pointers into m_textures are resolved again once textures are loaded
+    if (m_textures_loaded) {
+        resolve_textures_();
+    }
+}
+
+void BackgroundManager::resolve_textures_() const {
+    for (const auto& layer : m_sorted_layers) {
+        for (const auto& object : layer.objects) {
+            object.texture = nullptr;
+            if (object.data->sprite_sheet.empty()) {
+                continue;
+            }
+            const auto it = m_textures.find(object.data->sprite_sheet);
+            if (it != m_textures.end() && it->second.id > 0) {
+                object.texture = &it->second;
+            }
+        }
+    }
+}
+
+void BackgroundManager::YIndex::build(const std::vector<float>& object_y) {
+    order.resize(object_y.size());
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return object_y[a] < object_y[b];
+    });
+    ys.clear();
+    ys.reserve(order.size());
+    for (uint32_t index : order) {
+        ys.push_back(object_y[index]);
+    }
+}
+
+void BackgroundManager::YIndex::query(float top, float bottom,
+                                      std::vector<uint32_t>& out) const {
+    auto it = std::lower_bound(ys.begin(), ys.end(), top);
+    for (; it != ys.end() && *it <= bottom; ++it) {
+        out.push_back(order[it - ys.begin()]);
+    }
 }
 
 void BackgroundManager::ensure_textures_loaded_() const {
@@ -77,38 +180,195 @@ void BackgroundManager::ensure_textures_loaded_() const {
         }
     }
 
+    // Sheets come from TextureManager (shared with every other user of the
+    // same file) and are kept resident while this scene holds them
+    auto& texture_manager = TextureManager::get_instance();
     for (const auto& sheet : needed_sheets) {
         if (m_textures.find(sheet) != m_textures.end()) {
             continue;
         }
 
-        const std::string texture_path = std::string(ASSETS_BASE_PATH) + sheet;
-        Texture2D tex = LoadTexture(texture_path.c_str());
+        const TextureHandle handle = texture_manager.get_handle(sheet);
+        Texture2D tex = texture_manager.acquire(handle);
+        m_acquired.push_back(handle);
+        // A failed load is kept as an invalid texture (not retried)
+        m_textures.emplace(sheet, tex);
         if (tex.id > 0) {
-            m_textures.emplace(sheet, tex);
             udj::core::Logger::info("Loaded background sprite sheet: %",
-                                    texture_path);
+                                    sheet);
         } else {
-            // Cache failure as an invalid texture to avoid repeated attempts
-            m_textures.emplace(sheet, tex);
             udj::core::Logger::error(
-                "Failed to load background sprite sheet: %", texture_path);
+                "Failed to load background sprite sheet: %", sheet);
         }
     }
 
     m_textures_loaded = true;
+    resolve_textures_();
+    composite_layers_();
 }
 
-void BackgroundManager::unload_textures_() {
-    for (auto& [_, tex] : m_textures) {
-        if (tex.id > 0) {
-            UnloadTexture(tex);
+void BackgroundManager::composite_layers_() const {
+    if (m_composite_budget == 0) {
+        return;
+    }
+
+    for (const auto& layer : m_sorted_layers) {
+        // Backgrounds objects never animate: a layer can be flattened as long
+        // as it only moves as a whole (vertical scroll/parallax).
+        if (!layer.has_bounds || layer.data->scroll_speed_x != 0.0f) {
+            continue;
+        }
+        composite_layer_(layer);
+    }
+
+    if (m_composite_bytes > 0) {
+        udj::core::Logger::debug("Background strips: % KiB",
+                                 m_composite_bytes / 1024);
+    }
+}
+
+void BackgroundManager::composite_layer_(const LayerEntry& layer) const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Background);
+    float top = std::numeric_limits<float>::infinity();
+    float bottom = -std::numeric_limits<float>::infinity();
+    for (const auto& object : layer.objects) {
+        if (object.texture) {
+            top = std::min(top, object.data->y - object.extent_up);
+            bottom = std::max(bottom, object.data->y + object.extent_down);
+        }
+    }
+    if (!(bottom > top)) {
+        return;
+    }
+
+    const float height = bottom - top;
+    const size_t strip_count = static_cast<size_t>(
+        std::ceil(height / static_cast<float>(kStripHeight)));
+    const size_t bytes =
+        strip_count * kCompositeWidth * kStripHeight * 4u;  // RGBA8
+    if (m_composite_bytes + bytes > m_composite_budget) {
+        udj::core::Logger::debug(
+            "Background layer '%' over strip budget, drawing per object",
+            layer.data->name);
+        return;
+    }
+
+    // Strips hold premultiplied color so they blend like the original tiles
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA,
+                              RL_ONE_MINUS_SRC_ALPHA,
+                              RL_ONE,
+                              RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD,
+                              RL_FUNC_ADD);
+
+    constexpr float kCenterOffset = kCompositeWidth / 2.0f;
+    std::vector<uint32_t> candidates;
+    for (size_t i = 0; i < strip_count; ++i) {
+        RenderTexture2D strip =
+            LoadRenderTexture(kCompositeWidth, kStripHeight);
+        if (strip.id == 0) {
+            for (const auto& loaded : layer.strips) {
+                UnloadRenderTexture(loaded);
+            }
+            layer.strips.clear();
+            return;
+        }
+
+        const float strip_top = top + static_cast<float>(i * kStripHeight);
+        candidates.clear();
+        layer.index.query(strip_top - layer.max_extent_down,
+                          strip_top + kStripHeight + layer.max_extent_up,
+                          candidates);
+        std::sort(candidates.begin(), candidates.end());
+
+        BeginTextureMode(strip);
+        ClearBackground(BLANK);
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+        for (uint32_t index : candidates) {
+            const ObjectEntry& object = layer.objects[index];
+            if (!object.texture) {
+                continue;
+            }
+            const Rectangle dest = {object.data->x - kCenterOffset,
+                                    object.data->y - strip_top,
+                                    object.size,
+                                    object.size};
+            draw::texture_pro(*object.texture,
+                              object.source,
+                              dest,
+                              {0, 0},
+                              object.data->rotation,
+                              WHITE);
+        }
+        EndBlendMode();
+        EndTextureMode();
+
+        layer.strips.push_back(strip);
+    }
+
+    layer.composite_top = top;
+    layer.composite_height = height;
+    m_composite_bytes += bytes;
+}
+
+void BackgroundManager::release_composites_() const {
+    for (const auto& layer : m_sorted_layers) {
+        for (const auto& strip : layer.strips) {
+            UnloadRenderTexture(strip);
+        }
+        layer.strips.clear();
+    }
+    m_composite_bytes = 0;
+}
+
+void BackgroundManager::draw_composite_(const LayerEntry& layer,
+                                        float screen_x, float screen_top,
+                                        float period,
+                                        float viewport_height) const {
+    const float height = layer.composite_height;
+
+    // Repeating layers tile every period; others draw once (k = 0)
+    int first_copy = 0;
+    int last_copy = 0;
+    if (period > 0.0f) {
+        first_copy =
+            static_cast<int>(std::ceil((-height - screen_top) / period));
+        last_copy = static_cast<int>(
+            std::floor((viewport_height - screen_top) / period));
+    }
+
+    constexpr float kStrip = static_cast<float>(kStripHeight);
+    const Rectangle source = {0.0f, 0.0f, kCompositeWidth, -kStrip};
+
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    for (int copy = first_copy; copy <= last_copy; ++copy) {
+        const float copy_top = screen_top + static_cast<float>(copy) * period;
+        for (size_t i = 0; i < layer.strips.size(); ++i) {
+            const float strip_y = copy_top + static_cast<float>(i) * kStrip;
+            if (strip_y + kStrip < 0.0f || strip_y > viewport_height) {
+                continue;
+            }
+            // Render textures are stored bottom-up, hence the flipped source
+            draw::texture_rec(layer.strips[i].texture,
+                              source,
+                              Vector2{screen_x, strip_y},
+                              WHITE);
         }
     }
+    EndBlendMode();
+}
+
+void BackgroundManager::unload_textures_() {
+    auto& texture_manager = TextureManager::get_instance();
+    for (TextureHandle handle : m_acquired) {
+        texture_manager.release(handle);
+    }
+    m_acquired.clear();
     m_textures.clear();
 }
 
 void BackgroundManager::update_ui_scroll(float dt, float viewport_height) {
+    m_ui_scroll_moving = false;
     if (!m_scene) {
         return;
     }
@@ -162,127 +422,184 @@ void BackgroundManager::update_ui_scroll(float dt, float viewport_height) {
         }
     }
 
+    const float previous_scroll_y = m_ui_scroll_y;
     m_ui_scroll_y += default_scroll_speed * dt;
 
     if (should_clamp && max_scroll_limit > 0.0f) {
         m_ui_scroll_y = std::min(m_ui_scroll_y, max_scroll_limit);
     }
+    m_ui_scroll_moving = m_ui_scroll_y != previous_scroll_y;
 }
 
 void BackgroundManager::draw(float gameplay_camera_y, bool use_ui_scroll,
-                             float /*viewport_width*/,
-                             float /*viewport_height*/) const {
+                             float viewport_width, float viewport_height,
+                             SpriteBatch* batch) const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Background);
     if (!m_scene) {
         return;
     }
 
     ensure_textures_loaded_();
 
-    const auto& layers = m_scene->get_background_layers();
-    if (layers.empty()) {
+    if (m_sorted_layers.empty()) {
         return;
     }
 
     const float scroll_y = use_ui_scroll ? m_ui_scroll_y : gameplay_camera_y;
     const Vector2 camera_pos = {0.0f, scroll_y};
+    const bool ui_screen =
+        m_scene->get_type() == udjourney::scene::SceneType::UiScreen;
 
     // Preserve existing behavior (base coordinate system: 640x480)
     constexpr float BG_CENTER_OFFSET = 320.0f;
 
-    for (const auto* layer : m_sorted_layers) {
-        if (!layer) {
+    int layer_index = 0;
+    for (const auto& layer : m_sorted_layers) {
+        const auto& layer_data = *layer.data;
+
+        const uint8_t batch_layer = SpriteBatch::layer(
+            RenderLayer::Background,
+            std::min(layer_index++,
+                     static_cast<int>(RenderLayer::Platforms) - 1));
+
+        const float parallax_offset_x =
+            camera_pos.x * (1.0f - layer_data.parallax_factor);
+        const float parallax_offset_y =
+            camera_pos.y * (1.0f - layer_data.parallax_factor);
+
+        auto draw_tile = [&](const ObjectEntry& object, float screen_y) {
+            const float screen_x =
+                object.data->x - parallax_offset_x - BG_CENTER_OFFSET;
+            if (screen_x + object.extent_down < 0.0f ||
+                screen_x - object.extent_up > viewport_width ||
+                screen_y + object.extent_down < 0.0f ||
+                screen_y - object.extent_up > viewport_height) {
+                return;
+            }
+
+            const Rectangle dest = {
+                screen_x, screen_y, object.size, object.size};
+            if (batch) {
+                batch->draw_texture(batch_layer,
+                                    *object.texture,
+                                    object.source,
+                                    dest,
+                                    {0, 0},
+                                    object.data->rotation);
+            } else {
+                draw::texture_pro(*object.texture,
+                                  object.source,
+                                  dest,
+                                  {0, 0},
+                                  object.data->rotation,
+                                  WHITE);
+            }
+        };
+
+        // Screen y = object y - offset for every mode but the wrapped one
+        float offset_y = parallax_offset_y;
+        const bool auto_scroll = ui_screen && layer_data.auto_scroll_enabled;
+        if (auto_scroll) {
+            offset_y = m_ui_scroll_y;
+        } else if (ui_screen) {
+            offset_y = 0.0f;
+        }
+
+        const bool wrapped = auto_scroll && layer_data.repeat;
+
+        if (!layer.strips.empty()) {
+            // Immediate draw: flush what earlier layers batched so the
+            // layer order is kept
+            if (batch && batch->is_recording()) {
+                batch->flush();
+                batch->begin();
+            }
+
+            float screen_top = layer.composite_top - offset_y;
+            float period = 0.0f;
+            if (wrapped) {
+                // Same phase as the per-object wrap below, tiled seamlessly
+                period = layer.max_y - layer.min_y;
+                float phase = std::fmod(m_ui_scroll_y, period);
+                if (phase < 0.0f) {
+                    phase += period;
+                }
+                screen_top = layer.composite_top - phase;
+            }
+            draw_composite_(layer,
+                            -parallax_offset_x,
+                            screen_top,
+                            period,
+                            viewport_height);
             continue;
         }
 
-        // When repeating, derive the wrap height from the layer contents.
-        // This avoids a "wait until the whole background ends" gap caused by
-        // using an arbitrary wrap height.
-        float layer_min_y = std::numeric_limits<float>::infinity();
-        float layer_max_y = -std::numeric_limits<float>::infinity();
-        if (layer->repeat && !layer->objects.empty()) {
-            for (const auto& obj : layer->objects) {
-                const float scaled_size = obj.tile_size * obj.scale;
-                layer_min_y = std::min(layer_min_y, obj.y);
-                layer_max_y = std::max(layer_max_y, obj.y + scaled_size);
+        // Collect the candidates through the y index, then draw them in
+        // scene order so overlapping tiles stack as authored.
+        m_visible.clear();
+        const float view_top = offset_y - layer.max_extent_down;
+        const float view_bottom =
+            offset_y + viewport_height + layer.max_extent_up;
+        if (!wrapped) {
+            layer.index.query(view_top, view_bottom, m_visible);
+        } else if (layer.has_bounds) {
+            // Copies repeat every wrap height: look one period either side
+            const float wrap_height = layer.max_y - layer.min_y;
+            float phase = std::fmod(m_ui_scroll_y, wrap_height);
+            if (phase < 0.0f) {
+                phase += wrap_height;
+            }
+            const float base = phase - m_ui_scroll_y;
+            for (int period = -1; period <= 1; ++period) {
+                const float shift =
+                    base + static_cast<float>(period) * wrap_height;
+                layer.index.query(
+                    view_top + shift, view_bottom + shift, m_visible);
+            }
+        } else {
+            for (uint32_t i = 0; i < layer.objects.size(); ++i) {
+                m_visible.push_back(i);
             }
         }
-        const bool has_layer_bounds = std::isfinite(layer_min_y) &&
-                                      std::isfinite(layer_max_y) &&
-                                      (layer_max_y > layer_min_y);
-        const float layer_wrap_height =
-            has_layer_bounds ? (layer_max_y - layer_min_y) : 0.0f;
-
-        float parallax_offset_x =
-            camera_pos.x * (1.0f - layer->parallax_factor);
-        float parallax_offset_y =
-            camera_pos.y * (1.0f - layer->parallax_factor);
-
-        for (const auto& obj : layer->objects) {
-            if (obj.sprite_sheet.empty()) {
+        std::sort(m_visible.begin(), m_visible.end());
+        m_visible.erase(std::unique(m_visible.begin(), m_visible.end()),
+                        m_visible.end());
+
+        for (uint32_t index : m_visible) {
+            const ObjectEntry& object = layer.objects[index];
+            if (!object.texture) {
                 continue;
             }
+            const auto& obj = *object.data;
 
-            const auto it = m_textures.find(obj.sprite_sheet);
-            if (it == m_textures.end() || it->second.id <= 0) {
+            if (!wrapped) {
+                draw_tile(object, obj.y - offset_y);
                 continue;
             }
-            const Texture2D& tex = it->second;
-
-            Rectangle source = {
-                static_cast<float>(obj.tile_col * obj.tile_size),
-                static_cast<float>(obj.tile_row * obj.tile_size),
-                static_cast<float>(obj.tile_size),
-                static_cast<float>(obj.tile_size)};
-
-            float screen_x = obj.x - parallax_offset_x - BG_CENTER_OFFSET;
-
-            float screen_y;
-            if (m_scene->get_type() == udjourney::scene::SceneType::UiScreen &&
-                layer->auto_scroll_enabled) {
-                float base_y = obj.y - m_ui_scroll_y;
-                if (layer->repeat) {
-                    const float wrap_height = (layer_wrap_height > 0.0f)
-                                                  ? layer_wrap_height
-                                                  : 1280.0f;
-
-                    // Normalize into (-wrap_height, 0] so scrolling upward is
-                    // continuous, then draw a second copy directly below.
-                    // This makes the bottom connect to the top smoothly.
-                    float local_base = base_y;
-                    if (has_layer_bounds && layer_wrap_height > 0.0f) {
-                        local_base = (obj.y - layer_min_y) - m_ui_scroll_y;
-                    }
-
-                    float wrapped = std::fmod(local_base, wrap_height);
-                    if (wrapped > 0.0f) {
-                        wrapped -= wrap_height;
-                    }
-
-                    screen_y = wrapped;
-                    if (has_layer_bounds && layer_wrap_height > 0.0f) {
-                        screen_y += layer_min_y;
-                    }
-
-                    const float scaled_size = obj.tile_size * obj.scale;
-                    Rectangle dest_wrap = {screen_x,
-                                           screen_y + wrap_height,
-                                           scaled_size,
-                                           scaled_size};
-                    DrawTexturePro(
-                        tex, source, dest_wrap, {0, 0}, obj.rotation, WHITE);
-                } else {
-                    screen_y = base_y;
-                }
-            } else if (m_scene->get_type() ==
-                       udjourney::scene::SceneType::UiScreen) {
-                screen_y = obj.y;
-            } else {
-                screen_y = obj.y - parallax_offset_y;
+
+            const float wrap_height =
+                layer.has_bounds ? (layer.max_y - layer.min_y) : 1280.0f;
+
+            // Normalize into (-wrap_height, 0] so scrolling upward is
+            // continuous, then draw a second copy directly below.
+            // This makes the bottom connect to the top smoothly.
+            float local_base = obj.y - m_ui_scroll_y;
+            if (layer.has_bounds) {
+                local_base = (obj.y - layer.min_y) - m_ui_scroll_y;
+            }
+
+            float wrapped_y = std::fmod(local_base, wrap_height);
+            if (wrapped_y > 0.0f) {
+                wrapped_y -= wrap_height;
+            }
+
+            float screen_y = wrapped_y;
+            if (layer.has_bounds) {
+                screen_y += layer.min_y;
             }
 
-            float scaled_size = obj.tile_size * obj.scale;
-            Rectangle dest = {screen_x, screen_y, scaled_size, scaled_size};
-            DrawTexturePro(tex, source, dest, {0, 0}, obj.rotation, WHITE);
+            draw_tile(object, screen_y + wrap_height);
+            draw_tile(object, screen_y);
         }
     }
 }
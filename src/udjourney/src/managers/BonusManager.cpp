@@ -1,10 +1,10 @@
 // Copyright 2025 Quentin Cartier
 #include "udjourney/managers/BonusManager.hpp"
 
-#include <chrono>
 #include <iostream>
 #include <algorithm>
-#include <random>
+
+#include <udj-core/Random.hpp>
 
 #include "udjourney/interfaces/IObserver.hpp"
 
@@ -15,15 +15,13 @@ void BonusManager::update(float delta) {
     timeSinceLastBonus += delta;
     if (timeSinceLastBonus >= kMinBonusInterval) {
         timeSinceLastBonus = 0.0F;
-        static auto seed =
-            std::chrono::steady_clock::now().time_since_epoch().count();
-        static std::mt19937 gen(static_cast<unsigned int>(seed));
-        static std::uniform_int_distribution<> dist(0, 99);
-        if (dist(gen) < 50) {
+        auto &rng = udj::core::RngService::get_instance().stream(
+            udj::core::RngStream::Bonus);
+        if (rng.range_int(0, 99) < 50) {
             // Notify observers to spawn a bonus
 
-            auto pos_x = dist(gen);
-            auto pos_y = dist(gen);
+            auto pos_x = rng.range_int(0, 99);
+            auto pos_y = rng.range_int(0, 99);
 
             for (auto *listener : observers) {
                 listener->on_notify("2;" + std::to_string(pos_x) + "+" +
@@ -0,0 +1,289 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/managers/CookedTexture.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+#include <udj-core/CoreUtils.hpp>
+#include <udj-core/Logger.hpp>
+#include <udj-core/Lz4.hpp>
+
+namespace {
+
+constexpr char kMagic[4] = {'U', 'D', 'T', '1'};
+constexpr size_t kHeaderSize = 24;
+constexpr uint8_t kFlagLz4 = 1u << 0;
+
+bool is_indexed(CookedFormat format) {
+    return format == CookedFormat::Indexed4 || format == CookedFormat::Indexed8;
+}
+
+// Size of one direct pixel or palette entry
+size_t entry_size(CookedFormat format) {
+    return format == CookedFormat::Rgba8888 ? 4u : 2u;
+}
+
+size_t max_palette_size(CookedFormat format) {
+    return format == CookedFormat::Indexed4 ? 16u : 256u;
+}
+
+size_t index_bytes(CookedFormat format, size_t pixel_count) {
+    return format == CookedFormat::Indexed4 ? (pixel_count + 1) / 2
+                                            : pixel_count;
+}
+
+int raylib_format(CookedFormat format) {
+    switch (format) {
+        case CookedFormat::Rgba5551:
+            return PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+        case CookedFormat::Rgb565:
+            return PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+        case CookedFormat::Rgba4444:
+            return PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+        default:
+            return PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    }
+}
+
+void put16(std::vector<uint8_t>* out, uint32_t value) {
+    out->push_back(static_cast<uint8_t>(value & 0xFF));
+    out->push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+}
+
+void put32(std::vector<uint8_t>* out, uint32_t value) {
+    put16(out, value & 0xFFFF);
+    put16(out, value >> 16);
+}
+
+uint32_t get16(const uint8_t* p) { return p[0] | (uint32_t{p[1]} << 8); }
+
+uint32_t get32(const uint8_t* p) { return get16(p) | (get16(p + 2) << 16); }
+
+// Same bit layouts as raylib's ImageFormat
+void append_color(std::vector<uint8_t>* out, CookedFormat format,
+                  const uint8_t* rgba) {
+    const uint32_t r = rgba[0];
+    const uint32_t g = rgba[1];
+    const uint32_t b = rgba[2];
+    const uint32_t a = rgba[3];
+    switch (format) {
+        case CookedFormat::Rgba5551:
+            put16(out,
+                  ((r >> 3) << 11) | ((g >> 3) << 6) | ((b >> 3) << 1) |
+                      (a >= 128 ? 1u : 0u));
+            break;
+        case CookedFormat::Rgb565:
+            put16(out, ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+            break;
+        case CookedFormat::Rgba4444:
+            put16(out,
+                  ((r >> 4) << 12) | ((g >> 4) << 8) | ((b >> 4) << 4) |
+                      (a >> 4));
+            break;
+        default:
+            out->insert(out->end(), rgba, rgba + 4);
+            break;
+    }
+}
+
+}  // namespace
+
+std::string CookedTexture::cooked_path_for(const std::string& source_path) {
+    const size_t slash = source_path.find_last_of('/');
+    const size_t dot = source_path.find_last_of('.');
+    if (dot == std::string::npos ||
+        (slash != std::string::npos && dot < slash)) {
+        return source_path + ".udt";
+    }
+    return source_path.substr(0, dot) + ".udt";
+}
+
+bool CookedTexture::is_current(const std::string& cooked_path,
+                               const std::string& source_path) {
+    return udj::core::filesystem::is_up_to_date(cooked_path, {source_path});
+}
+
+std::vector<uint8_t> CookedTexture::encode(const Image& image,
+                                           CookedFormat format,
+                                           CookedFormat palette_format,
+                                           bool compress) {
+    if (image.data == nullptr ||
+        image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 ||
+        image.width <= 0 || image.height <= 0 || image.width > 0xFFFF ||
+        image.height > 0xFFFF || is_indexed(palette_format)) {
+        return {};
+    }
+
+    const auto* src = static_cast<const uint8_t*>(image.data);
+    const size_t pixel_count =
+        static_cast<size_t>(image.width) * static_cast<size_t>(image.height);
+
+    std::vector<uint8_t> payload;
+    uint32_t palette_count = 0;
+    if (!is_indexed(format)) {
+        payload.reserve(pixel_count * entry_size(format));
+        for (size_t i = 0; i < pixel_count; ++i) {
+            append_color(&payload, format, src + i * 4);
+        }
+    } else {
+        std::unordered_map<uint32_t, uint8_t> lookup;
+        std::vector<uint32_t> palette;
+        std::vector<uint8_t> indices(pixel_count);
+        for (size_t i = 0; i < pixel_count; ++i) {
+            uint32_t key;
+            std::memcpy(&key, src + i * 4, sizeof(key));
+            auto iter = lookup.find(key);
+            if (iter == lookup.end()) {
+                if (palette.size() == max_palette_size(format)) {
+                    return {};
+                }
+                iter = lookup
+                           .emplace(key, static_cast<uint8_t>(palette.size()))
+                           .first;
+                palette.push_back(key);
+            }
+            indices[i] = iter->second;
+        }
+
+        palette_count = static_cast<uint32_t>(palette.size());
+        for (uint32_t key : palette) {
+            uint8_t rgba[4];
+            std::memcpy(rgba, &key, sizeof(rgba));
+            append_color(&payload, palette_format, rgba);
+        }
+        if (format == CookedFormat::Indexed8) {
+            payload.insert(payload.end(), indices.begin(), indices.end());
+        } else {
+            for (size_t i = 0; i < pixel_count; i += 2) {
+                const uint8_t high = i + 1 < pixel_count ? indices[i + 1] : 0;
+                payload.push_back(static_cast<uint8_t>(indices[i] | high << 4));
+            }
+        }
+    }
+
+    const size_t raw_size = payload.size();
+    std::vector<uint8_t> stored;
+    uint8_t flags = 0;
+    if (compress) {
+        stored = udj::core::lz4::compress(payload.data(), payload.size());
+        flags = kFlagLz4;
+    }
+    // Incompressible data is kept raw
+    if (!compress || stored.size() >= raw_size) {
+        stored = std::move(payload);
+        flags = 0;
+    }
+
+    std::vector<uint8_t> out(std::begin(kMagic), std::end(kMagic));
+    out.reserve(kHeaderSize + stored.size());
+    put16(&out, static_cast<uint32_t>(image.width));
+    put16(&out, static_cast<uint32_t>(image.height));
+    out.push_back(static_cast<uint8_t>(format));
+    out.push_back(static_cast<uint8_t>(palette_format));
+    put16(&out, palette_count);
+    out.push_back(flags);
+    out.insert(out.end(), 3, 0);
+    put32(&out, static_cast<uint32_t>(raw_size));
+    put32(&out, static_cast<uint32_t>(stored.size()));
+    out.insert(out.end(), stored.begin(), stored.end());
+    return out;
+}
+
+bool CookedTexture::decode(const uint8_t* data, size_t size, Image* out) {
+    if (size < kHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        return false;
+    }
+
+    const uint32_t width = get16(data + 4);
+    const uint32_t height = get16(data + 6);
+    const auto format = static_cast<CookedFormat>(data[8]);
+    const auto palette_format = static_cast<CookedFormat>(data[9]);
+    const uint32_t palette_count = get16(data + 10);
+    const uint8_t flags = data[12];
+    const uint32_t raw_size = get32(data + 16);
+    const uint32_t stored_size = get32(data + 20);
+
+    if (width == 0 || height == 0 || data[8] > 5 ||
+        stored_size != size - kHeaderSize) {
+        return false;
+    }
+
+    const bool indexed = is_indexed(format);
+    const CookedFormat pixel_format = indexed ? palette_format : format;
+    if (indexed &&
+        (data[9] > 5 || is_indexed(palette_format) || palette_count == 0 ||
+         palette_count > max_palette_size(format))) {
+        return false;
+    }
+
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+    const size_t bpp = entry_size(pixel_format);
+    const size_t expected_raw =
+        indexed ? palette_count * bpp + index_bytes(format, pixel_count)
+                : pixel_count * bpp;
+    if (raw_size != expected_raw) {
+        return false;
+    }
+
+    const uint8_t* payload = data + kHeaderSize;
+    std::vector<uint8_t> inflated;
+    if (flags & kFlagLz4) {
+        inflated.resize(raw_size);
+        if (!udj::core::lz4::decompress(
+                payload, stored_size, inflated.data(), raw_size)) {
+            return false;
+        }
+        payload = inflated.data();
+    } else if (stored_size != raw_size) {
+        return false;
+    }
+
+    // MemAlloc, so the caller's UnloadImage releases it
+    auto* pixels = static_cast<uint8_t*>(
+        MemAlloc(static_cast<unsigned int>(pixel_count * bpp)));
+    if (pixels == nullptr) {
+        return false;
+    }
+
+    if (!indexed) {
+        std::memcpy(pixels, payload, pixel_count * bpp);
+    } else {
+        const uint8_t* palette = payload;
+        const uint8_t* indices = payload + palette_count * bpp;
+        for (size_t i = 0; i < pixel_count; ++i) {
+            const uint32_t index =
+                format == CookedFormat::Indexed8
+                    ? indices[i]
+                    : (indices[i / 2] >> ((i & 1) * 4)) & 0x0F;
+            if (index >= palette_count) {
+                MemFree(pixels);
+                return false;
+            }
+            std::memcpy(pixels + i * bpp, palette + index * bpp, bpp);
+        }
+    }
+
+    *out = Image{pixels,
+                 static_cast<int>(width),
+                 static_cast<int>(height),
+                 1,
+                 raylib_format(pixel_format)};
+    return true;
+}
+
+bool CookedTexture::load_from_file(const std::string& path, Image* out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                    std::istreambuf_iterator<char>());
+    if (!decode(data.data(), data.size(), out)) {
+        udj::core::Logger::warning("CookedTexture: malformed %", path);
+        return false;
+    }
+    return true;
+}
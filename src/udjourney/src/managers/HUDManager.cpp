@@ -5,6 +5,9 @@
 #include <string>
 #include <utility>
 
+#include "udjourney/render/DrawStats.hpp"
+#include "udjourney/render/SpriteBatch.hpp"
+
 void HUDManager::add_background_hud(
     std::unique_ptr<HUDComponent> ioHudComponent) {
     m_background_components.push_back(std::move(ioHudComponent));
@@ -31,13 +34,27 @@ void HUDManager::update(float deltaTime) {
     }
 }
 
-void HUDManager::draw() const {
+namespace {
+void draw_component(const HUDComponent& component,
+                    udjourney::SpriteBatch* batch) {
+    if (batch) {
+        batch->begin();
+    }
+    component.draw(batch);
+    if (batch) {
+        batch->flush();
+    }
+}
+}  // namespace
+
+void HUDManager::draw(udjourney::SpriteBatch* batch) const {
+    udjourney::DrawStats::Scope draw_scope(udjourney::DrawSubsystem::Hud);
     for (const auto& component : m_background_components) {
-        component->draw();
+        draw_component(*component, batch);
     }
 
     for (const auto& component : m_focus_stacks) {
-        component->draw();
+        draw_component(*component, batch);
     }
 }
 
@@ -9,27 +9,36 @@
 #include <udj-core/Logger.hpp>
 
 #include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/DrawStats.hpp"
+#include "udjourney/scene/TileOccupancyGrid.hpp"
 
 namespace udjourney {
 
-ParticleManager::~ParticleManager() { unload_textures_(); }
-
 void ParticleManager::update(float delta) {
+    const bool has_world = world_grid_ && !world_grid_->empty();
+
     // Update all emitters
     for (auto& emitter : emitters_) {
         if (emitter) {
             emitter->update(delta);
+            if (has_world && emitter->get_preset().collide_with_world) {
+                emitter->collide_with_world(*world_grid_, delta);
+            }
         }
     }
 
+    for (auto& burst : baked_bursts_) {
+        burst.update(delta);
+    }
+
     // Remove dead emitters
     cleanup_dead_emitters_();
 }
 
 void ParticleManager::draw() const { draw(Vector2{0.0f, 0.0f}); }
 
-void ParticleManager::draw(Vector2 camera_offset) const {
-    ensure_textures_loaded_();
+void ParticleManager::draw(Vector2 camera_offset, SpriteBatch* batch) const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Particles);
 
     // Draw all particles from all emitters (including inactive burst emitters)
     for (const auto& emitter : emitters_) {
@@ -38,13 +47,16 @@ void ParticleManager::draw(Vector2 camera_offset) const {
 
             // If no texture is set in the preset, draw basic form.
             Texture2D texture{0};
-            if (!preset.texture_file.empty()) {
-                texture = TextureManager::get_instance().get_texture(
-                    preset.texture_file);
+            if (preset.texture.is_valid()) {
+                texture = TextureManager::get_instance().get(preset.texture);
             }
-            emitter->draw(texture, camera_offset);
+            emitter->draw(texture, camera_offset, batch);
         }
     }
+
+    for (const auto& burst : baked_bursts_) {
+        burst.draw(camera_offset, batch);
+    }
 }
 
 ParticleEmitter* ParticleManager::create_emitter(const std::string& preset_name,
@@ -74,6 +86,21 @@ bool ParticleManager::create_burst(const std::string& preset_name,
         return false;
     }
 
+    if (preset->bake && preset->burst_count > 0) {
+        auto& texture_manager = TextureManager::get_instance();
+        const Texture2D sheet = texture_manager.get(preset->bake_texture);
+        // A sheet still decoding is simulated this time
+        if (sheet.id != 0 && texture_manager.is_ready(preset->bake_texture)) {
+            baked_bursts_.emplace_back(
+                *preset, preset->bake_texture, position);
+            return true;
+        }
+        udj::core::Logger::debug(
+            "ParticleManager: Baked sheet '%' missing, simulating '%'",
+            preset->bake_sheet,
+            preset_name);
+    }
+
     auto emitter = std::make_unique<ParticleEmitter>(*preset);
     emitter->set_position(position);
     emitter->emit_burst();
@@ -85,8 +112,7 @@ bool ParticleManager::create_burst(const std::string& preset_name,
 
 void ParticleManager::clear() {
     emitters_.clear();
-    unload_textures_();
-    textures_loaded_ = false;
+    baked_bursts_.clear();
 }
 
 size_t ParticleManager::get_total_particle_count() const {
@@ -107,30 +133,30 @@ void ParticleManager::cleanup_dead_emitters_() {
                            return emitter == nullptr || emitter->is_dead();
                        }),
         emitters_.end());
-}
-
-void ParticleManager::ensure_textures_loaded_() const {
-    if (textures_loaded_) {
-        return;
-    }
 
-    // Textures will be loaded on-demand when presets are used
-    // For now, mark as loaded
-    textures_loaded_ = true;
+    baked_bursts_.erase(
+        std::remove_if(baked_bursts_.begin(),
+                       baked_bursts_.end(),
+                       [](const BakedBurst& burst) { return burst.is_dead(); }),
+        baked_bursts_.end());
 }
 
-void ParticleManager::unload_textures_() {
-    for (auto& [path, texture] : textures_) {
-        if (texture.id != 0) {
-            UnloadTexture(texture);
-        }
+bool ParticleManager::load_presets(const std::string& filename) {
+    if (!preset_loader_.load_from_file(filename)) {
+        return false;
     }
-    textures_.clear();
-    textures_loaded_ = false;
-}
 
-bool ParticleManager::load_presets(const std::string& filename) {
-    return preset_loader_.load_from_file(filename);
+    // Resolve texture paths once; draws and bursts only use the handles
+    auto& texture_manager = TextureManager::get_instance();
+    preset_loader_.for_each_preset([&](ParticlePreset& preset) {
+        texture_manager.remap_to_atlas(
+            preset.texture_file, preset.source_rect, preset.use_atlas);
+        preset.texture = texture_manager.get_handle(preset.texture_file);
+        preset.bake_texture = texture_manager.get_handle(preset.bake_sheet);
+        texture_manager.request(preset.texture);
+        texture_manager.request(preset.bake_texture);
+    });
+    return true;
 }
 
 const ParticlePreset* ParticleManager::get_preset(
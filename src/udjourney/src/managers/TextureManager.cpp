@@ -1,36 +1,360 @@
 // Copyright 2025 Quentin Cartier
 #include "udjourney/managers/TextureManager.hpp"
 
+#include <algorithm>
+#include <cstdlib>
 #include <string>
 
 #include <udj-core/CoreUtils.hpp>
+#include <udj-core/Logger.hpp>
+
+#include "udjourney/managers/CookedTexture.hpp"
+
+namespace {
+#ifdef PLATFORM_DREAMCAST
+// Half of the 8 MB of PVR memory; the rest holds framebuffers and lists
+constexpr size_t kDefaultBudgetBytes = 4u * 1024u * 1024u;
+#else
+constexpr size_t kDefaultBudgetBytes = 256u * 1024u * 1024u;
+#endif
+
+// A cooked .udt next to the source image wins unless the source was edited
+// since: no PNG inflate, and its pixels are already in the upload format
+Image load_image_file(const std::string& full_path) {
+    Image image{};
+    const std::string cooked_path = CookedTexture::cooked_path_for(full_path);
+    if (CookedTexture::is_current(cooked_path, full_path) &&
+        CookedTexture::load_from_file(cooked_path, &image)) {
+        return image;
+    }
+    return LoadImage(full_path.c_str());
+}
+
+Texture2D upload_image(const Image& image) {
+    Texture2D texture = LoadTextureFromImage(image);
+    // Set texture filter to POINT for pixel-perfect rendering (no blur)
+    SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+    return texture;
+}
+}  // namespace
 
 TextureManager& TextureManager::get_instance() {
     static TextureManager instance;
     return instance;
 }
 
-Texture2D TextureManager::get_texture(const std::string& path) {
-    auto iter = textures.find(path);
-    if (iter != textures.end()) {
-        return iter->second;
+TextureManager::Backend TextureManager::default_backend() {
+    return Backend{load_image_file, upload_image, UnloadTexture};
+}
+
+TextureManager::TextureManager()
+    : slots(1),
+      budget_bytes(kDefaultBudgetBytes),
+      backend(default_backend()) {
+    // UDJ_TEXTURE_BUDGET_KB overrides the budget (e.g. to test eviction)
+    if (const char* budget_env = std::getenv("UDJ_TEXTURE_BUDGET_KB")) {
+        const long kilobytes = std::atol(budget_env);
+        if (kilobytes > 0) {
+            budget_bytes = static_cast<size_t>(kilobytes) * 1024u;
+        }
+    }
+}
+
+TextureHandle TextureManager::get_handle(const std::string& path) {
+    if (path.empty()) {
+        return TextureHandle{};
     }
 
-    Texture2D tex =
-        LoadTexture(udjourney::coreutils::get_assets_path(path).c_str());
+    auto iter = handles.find(path);
+    if (iter != handles.end()) {
+        return TextureHandle{iter->second};
+    }
 
-    // Set texture filter to POINT for pixel-perfect rendering (no blur)
-    SetTextureFilter(tex, TEXTURE_FILTER_POINT);
+    const auto index = static_cast<uint32_t>(slots.size());
+    slots.push_back(Slot{path});
+    handles.emplace(path, index);
+    return TextureHandle{index};
+}
+
+TextureRegion TextureManager::get_region(const std::string& path) {
+    if (const AtlasEntry* entry = atlas_map.find(path)) {
+        return TextureRegion{get_handle(entry->atlas), entry->rect};
+    }
+    return TextureRegion{get_handle(path)};
+}
+
+bool TextureManager::remap_to_atlas(std::string& file, Rectangle& rect,
+                                    bool& has_rect) {
+    const AtlasEntry* entry = atlas_map.find(file);
+    if (!entry) {
+        return false;
+    }
+
+    file = entry->atlas;
+    if (has_rect) {
+        rect.x += entry->rect.x;
+        rect.y += entry->rect.y;
+    } else {
+        rect = entry->rect;
+        has_rect = true;
+    }
+    return true;
+}
+
+bool TextureManager::load_atlas_map(const std::string& path) {
+    const std::string full_path = udjourney::coreutils::get_assets_path(path);
+    if (!udjourney::coreutils::file_exists(full_path)) {
+        return false;
+    }
+    return atlas_map.load_from_file(full_path);
+}
+
+Texture2D TextureManager::get(TextureHandle handle) {
+    if (!handle.is_valid() || handle.index >= slots.size()) {
+        return Texture2D{};
+    }
+
+    Slot& slot = slots[handle.index];
+    slot.last_used = frame;
+    if (slot.state == LoadState::Decoding) {
+        return get_placeholder_();
+    }
+    if (slot.state == LoadState::Unloaded) {
+        load_(slot);
+    }
+    return slot.texture;
+}
+
+void TextureManager::request(TextureHandle handle) {
+    if (!handle.is_valid() || handle.index >= slots.size()) {
+        return;
+    }
+    Slot& slot = slots[handle.index];
+    if (slot.state != LoadState::Unloaded) {
+        return;
+    }
+
+    slot.state = LoadState::Decoding;
+    std::string full_path = udjourney::coreutils::get_assets_path(slot.path);
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        decode_queue.emplace_back(handle.index, std::move(full_path));
+    }
+    if (!worker.joinable()) {
+        worker = std::thread(&TextureManager::decode_loop_, this);
+    }
+    queue_cv.notify_one();
+}
+
+bool TextureManager::is_ready(TextureHandle handle) const {
+    return handle.is_valid() && handle.index < slots.size() &&
+           slots[handle.index].state == LoadState::Loaded;
+}
+
+size_t TextureManager::pump_uploads(double budget_seconds) {
+    const double start = GetTime();
+    size_t uploaded = 0;
+    for (;;) {
+        std::pair<uint32_t, Image> job;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (decoded.empty()) {
+                break;
+            }
+            job = decoded.front();
+            decoded.pop_front();
+        }
+
+        // The slot may have been loaded synchronously (acquire) or unloaded
+        // since the request: the image is then stale
+        Slot& slot = slots[job.first];
+        if (slot.state == LoadState::Decoding) {
+            upload_(slot, job.second);
+            ++uploaded;
+        }
+        UnloadImage(job.second);
+
+        if (GetTime() - start >= budget_seconds) {
+            break;
+        }
+    }
+    return uploaded;
+}
 
-    textures[path] = tex;
+void TextureManager::decode_loop_() {
+    for (;;) {
+        std::pair<uint32_t, std::string> job;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock,
+                          [this] { return stopping || !decode_queue.empty(); });
+            if (stopping) {
+                return;
+            }
+            job = std::move(decode_queue.front());
+            decode_queue.pop_front();
+        }
+
+        // File read and decode only; GL calls stay on the main thread
+        Image image = backend.decode(job.second);
+
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        decoded.emplace_back(job.first, image);
+    }
+}
+
+void TextureManager::stop_worker_() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_cv.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    for (auto& [_, image] : decoded) {
+        UnloadImage(image);
+    }
+    decoded.clear();
+    decode_queue.clear();
+}
+
+Texture2D TextureManager::get_placeholder_() {
+    if (placeholder.id == 0) {
+        Image blank = GenImageColor(1, 1, BLANK);
+        placeholder = backend.upload(blank);
+        UnloadImage(blank);
+    }
+    return placeholder;
+}
+
+Texture2D TextureManager::get_repeating(TextureHandle handle) {
+    Texture2D tex = get(handle);
+    if (tex.id != 0 && is_ready(handle) && !slots[handle.index].repeating) {
+        SetTextureWrap(tex, TEXTURE_WRAP_REPEAT);
+        slots[handle.index].repeating = true;
+    }
     return tex;
 }
 
+const std::string& TextureManager::get_path(TextureHandle handle) const {
+    static const std::string kNone;
+    return handle.index < slots.size() ? slots[handle.index].path : kNone;
+}
+
+Texture2D TextureManager::acquire(TextureHandle handle) {
+    if (handle.is_valid() && handle.index < slots.size()) {
+        Slot& slot = slots[handle.index];
+        // The holder keeps this Texture2D: finish a pending load right away
+        if (slot.state == LoadState::Decoding) {
+            load_(slot);
+        }
+        ++slot.ref_count;
+    }
+    return get(handle);
+}
+
+void TextureManager::release(TextureHandle handle) {
+    if (handle.is_valid() && handle.index < slots.size() &&
+        slots[handle.index].ref_count > 0) {
+        --slots[handle.index].ref_count;
+    }
+}
+
+void TextureManager::pin(TextureHandle handle) {
+    if (handle.is_valid() && handle.index < slots.size()) {
+        slots[handle.index].pinned = true;
+    }
+}
+
+void TextureManager::unpin_all() {
+    for (Slot& slot : slots) {
+        slot.pinned = false;
+    }
+}
+
+bool TextureManager::is_evictable_(const Slot& slot) const {
+    return slot.state == LoadState::Loaded && slot.texture.id != 0 &&
+           slot.ref_count == 0 &&
+           !slot.pinned && slot.last_used != frame;
+}
+
+void TextureManager::end_frame() {
+    if (resident_bytes > budget_bytes) {
+        std::vector<Slot*> candidates;
+        for (Slot& slot : slots) {
+            if (is_evictable_(slot)) {
+                candidates.push_back(&slot);
+            }
+        }
+        std::sort(candidates.begin(),
+                  candidates.end(),
+                  [](const Slot* a, const Slot* b) {
+                      return a->last_used < b->last_used;
+                  });
+
+        for (Slot* slot : candidates) {
+            if (resident_bytes <= budget_bytes) {
+                break;
+            }
+            udj::core::Logger::debug("TextureManager: evicting % (% KB)",
+                                     slot->path,
+                                     slot->bytes / 1024u);
+            unload_(*slot);
+        }
+    }
+    ++frame;
+}
+
+void TextureManager::load_(Slot& slot) {
+    Image image =
+        backend.decode(udjourney::coreutils::get_assets_path(slot.path));
+    upload_(slot, image);
+    UnloadImage(image);
+}
+
+void TextureManager::upload_(Slot& slot, const Image& image) {
+    slot.texture =
+        image.data != nullptr ? backend.upload(image) : Texture2D{};
+
+    // A failed load is cached too, so it is not retried every frame
+    slot.state = LoadState::Loaded;
+    slot.repeating = false;
+    if (slot.texture.id != 0) {
+        slot.bytes = static_cast<size_t>(GetPixelDataSize(
+            slot.texture.width, slot.texture.height, slot.texture.format));
+        resident_bytes += slot.bytes;
+        ++resident_count;
+    } else {
+        udj::core::Logger::error("TextureManager: failed to load %",
+                                 slot.path);
+    }
+}
+
+void TextureManager::unload_(Slot& slot) {
+    if (slot.state == LoadState::Loaded && slot.texture.id != 0) {
+        backend.unload(slot.texture);
+        resident_bytes -= std::min(resident_bytes, slot.bytes);
+        --resident_count;
+    }
+    slot.texture = Texture2D{};
+    slot.bytes = 0;
+    slot.state = LoadState::Unloaded;
+    slot.repeating = false;
+}
+
 void TextureManager::unload_all() {
-    for (auto& [_, tex] : textures) {
-        UnloadTexture(tex);
+    for (Slot& slot : slots) {
+        unload_(slot);
+    }
+    if (placeholder.id != 0) {
+        backend.unload(placeholder);
+        placeholder = Texture2D{};
     }
-    textures.clear();
 }
 
-TextureManager::~TextureManager() { unload_all(); }
+TextureManager::~TextureManager() {
+    stop_worker_();
+    unload_all();
+}
@@ -0,0 +1,57 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/particle/BakedBurst.hpp"
+
+#include <algorithm>
+
+#include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
+
+namespace udjourney {
+
+BakedBurst::BakedBurst(const ParticlePreset& preset,
+                       TextureHandle sheet,
+                       Vector2 position) :
+    sheet_(sheet),
+    position_(position),
+    frame_count_(std::max(1, preset.bake_frame_count)),
+    columns_(std::max(1, preset.bake_columns)),
+    frame_size_(static_cast<float>(std::max(1, preset.bake_frame_size))),
+    fps_(preset.bake_fps > 0.0f ? preset.bake_fps : 20.0f),
+    duration_(static_cast<float>(frame_count_) / fps_) {}
+
+int BakedBurst::get_frame() const {
+    return std::min(static_cast<int>(age_ * fps_), frame_count_ - 1);
+}
+
+Rectangle BakedBurst::get_source_rect() const {
+    const int frame = get_frame();
+    return Rectangle{static_cast<float>(frame % columns_) * frame_size_,
+                     static_cast<float>(frame / columns_) * frame_size_,
+                     frame_size_,
+                     frame_size_};
+}
+
+void BakedBurst::draw(Vector2 camera_offset, SpriteBatch* batch) const {
+    const Rectangle source = get_source_rect();
+
+    // Frames are baked with the emitter at their center
+    const Rectangle dest{position_.x - camera_offset.x,
+                         position_.y - camera_offset.y,
+                         frame_size_,
+                         frame_size_};
+    const Vector2 origin{frame_size_ / 2.0f, frame_size_ / 2.0f};
+
+    // Marks the sheet used this frame, so it is never evicted mid-burst
+    const Texture2D sheet = TextureManager::get_instance().get(sheet_);
+    if (batch) {
+        batch->draw_texture(SpriteBatch::layer(RenderLayer::Effects),
+                            sheet,
+                            source,
+                            dest,
+                            origin);
+        return;
+    }
+    draw::texture_pro(sheet, source, dest, origin, 0.0f, WHITE);
+}
+
+}  // namespace udjourney
@@ -2,24 +2,30 @@
 #include "udjourney/particle/ParticleEmitter.hpp"
 #include <algorithm>
 #include <cmath>
-#include <random>
-#include <ctime>
+
+#include <udj-core/Random.hpp>
+
+#include "udjourney/render/Draw.hpp"
+#include "udjourney/scene/TileOccupancyGrid.hpp"
 
 namespace udjourney {
 
 namespace {
-// Thread-local random number generator
-thread_local std::mt19937 rng(static_cast<unsigned int>(time(nullptr)));
-
-// Helper function for random float in range
-float random_float(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(rng);
-}
+// Particles spawned per batch of random draws
+constexpr int kSpawnBatch = 32;
 }  // namespace
 
+// Without an explicit seed, each emitter gets its own sequence derived from
+// the particle stream, so effects stay reproducible for a given game seed.
 ParticleEmitter::ParticleEmitter(const ParticlePreset& preset) :
-    preset_(preset) {
+    ParticleEmitter(preset,
+                    udj::core::RngService::get_instance()
+                        .stream(udj::core::RngStream::Particles)
+                        .next_u32()) {}
+
+ParticleEmitter::ParticleEmitter(const ParticlePreset& preset,
+                                 unsigned int seed) :
+    preset_(preset), rng_(seed) {
     particles_.reserve(100);  // Reserve space for performance
 }
 
@@ -30,9 +36,10 @@ void ParticleEmitter::update(float delta) {
     if (active_ && preset_.burst_count == 0 && preset_.emission_rate > 0.0f) {
         emission_accumulator_ += delta * preset_.emission_rate;
 
-        while (emission_accumulator_ >= 1.0f) {
-            spawn_particle_();
-            emission_accumulator_ -= 1.0f;
+        if (emission_accumulator_ >= 1.0f) {
+            const auto count = static_cast<int>(emission_accumulator_);
+            spawn_particles_(count);
+            emission_accumulator_ -= static_cast<float>(count);
         }
     }
 
@@ -45,7 +52,46 @@ void ParticleEmitter::update(float delta) {
     cleanup_dead_particles_();
 }
 
-void ParticleEmitter::draw(Texture2D texture, Vector2 camera_offset) const {
+void ParticleEmitter::collide_with_world(const scene::TileOccupancyGrid& grid,
+                                         float delta) {
+    const float bounce = preset_.world_bounce;
+
+    for (auto& particle : particles_) {
+        if (!particle.alive) continue;
+        if (!grid.is_solid(particle.position.x, particle.position.y)) continue;
+
+        if (bounce <= 0.0f) {
+            particle.alive = false;
+            continue;
+        }
+
+        // Position before this step (semi-implicit Euler integration)
+        const float prev_x = particle.position.x - particle.velocity.x * delta;
+        const float prev_y = particle.position.y - particle.velocity.y * delta;
+
+        // Spawned inside a platform: nothing sensible to bounce against
+        if (grid.is_solid(prev_x, prev_y)) {
+            particle.alive = false;
+            continue;
+        }
+
+        // Reflect only the axes that crossed into the solid cell
+        const bool hit_y = grid.is_solid(prev_x, particle.position.y);
+        const bool hit_x = grid.is_solid(particle.position.x, prev_y);
+
+        if (hit_y || !hit_x) {
+            particle.position.y = prev_y;
+            particle.velocity.y = -particle.velocity.y * bounce;
+        }
+        if (hit_x || !hit_y) {
+            particle.position.x = prev_x;
+            particle.velocity.x = -particle.velocity.x * bounce;
+        }
+    }
+}
+
+void ParticleEmitter::draw(Texture2D texture, Vector2 camera_offset,
+                           SpriteBatch* batch) const {
     for (const auto& particle : particles_) {
         if (!particle.alive) continue;
 
@@ -74,11 +120,21 @@ void ParticleEmitter::draw(Texture2D texture, Vector2 camera_offset) const {
             Rectangle dest = {screen_pos.x, screen_pos.y, size, size};
             Vector2 origin = {size / 2.0f, size / 2.0f};
 
-            DrawTexturePro(
-                texture, source, dest, origin, particle.rotation, color);
+            if (batch) {
+                batch->draw_texture(SpriteBatch::layer(RenderLayer::Effects),
+                                    texture,
+                                    source,
+                                    dest,
+                                    origin,
+                                    particle.rotation,
+                                    color);
+            } else {
+                draw::texture_pro(
+                    texture, source, dest, origin, particle.rotation, color);
+            }
         } else {
             // No texture configured (or failed to load): draw a basic form.
-            DrawCircleV(screen_pos, size / 2.0f, color);
+            draw::circle_v(screen_pos, size / 2.0f, color);
         }
     }
 }
@@ -92,48 +148,62 @@ bool ParticleEmitter::is_dead() const {
 }
 
 void ParticleEmitter::emit_burst() {
-    int count = preset_.burst_count > 0 ? preset_.burst_count : 10;
-    for (int i = 0; i < count; ++i) {
-        spawn_particle_();
-    }
+    spawn_particles_(preset_.burst_count > 0 ? preset_.burst_count : 10);
 }
 
-void ParticleEmitter::spawn_particle_() {
-    Particle particle;
-
-    // Initialize position at emitter location
-    particle.position = position_;
-
-    // Random velocity within range
-    particle.velocity.x =
-        random_float(preset_.velocity_min.x, preset_.velocity_max.x);
-    particle.velocity.y =
-        random_float(preset_.velocity_min.y, preset_.velocity_max.y);
-
-    // Acceleration
-    particle.acceleration = preset_.acceleration;
-
-    // Lifetime with variance
-    float variance =
-        random_float(-preset_.lifetime_variance, preset_.lifetime_variance);
-    particle.lifetime = preset_.particle_lifetime + variance;
-    particle.age = 0.0f;
-
-    // Visual properties
-    particle.start_color = preset_.start_color;
-    particle.end_color = preset_.end_color;
-    particle.start_size = preset_.start_size;
-    particle.end_size = preset_.end_size;
-
-    // Rotation
-    particle.rotation = random_float(0.0f, 360.0f);
-    particle.rotation_speed = preset_.rotation_speed;
-
-    // Texture
-    particle.texture_rect = preset_.source_rect;
-    particle.alive = true;
+void ParticleEmitter::spawn_particles_(int count) {
+    // Random attributes are generated in batches, one array per attribute
+    float velocity_x[kSpawnBatch];
+    float velocity_y[kSpawnBatch];
+    float lifetime_variance[kSpawnBatch];
+    float rotation[kSpawnBatch];
+
+    while (count > 0) {
+        const int batch = std::min(count, kSpawnBatch);
+        const auto n = static_cast<size_t>(batch);
+
+        rng_.fill_range(
+            velocity_x, n, preset_.velocity_min.x, preset_.velocity_max.x);
+        rng_.fill_range(
+            velocity_y, n, preset_.velocity_min.y, preset_.velocity_max.y);
+        rng_.fill_range(lifetime_variance,
+                        n,
+                        -preset_.lifetime_variance,
+                        preset_.lifetime_variance);
+        rng_.fill_range(rotation, n, 0.0f, 360.0f);
+
+        for (int i = 0; i < batch; ++i) {
+            Particle particle;
+
+            // Initialize position at emitter location
+            particle.position = position_;
+            particle.velocity = Vector2{velocity_x[i], velocity_y[i]};
+            particle.acceleration = preset_.acceleration;
+
+            // Lifetime with variance
+            particle.lifetime =
+                preset_.particle_lifetime + lifetime_variance[i];
+            particle.age = 0.0f;
+
+            // Visual properties
+            particle.start_color = preset_.start_color;
+            particle.end_color = preset_.end_color;
+            particle.start_size = preset_.start_size;
+            particle.end_size = preset_.end_size;
+
+            // Rotation
+            particle.rotation = rotation[i];
+            particle.rotation_speed = preset_.rotation_speed;
+
+            // Texture
+            particle.texture_rect = preset_.source_rect;
+            particle.alive = true;
+
+            particles_.push_back(particle);
+        }
 
-    particles_.push_back(particle);
+        count -= batch;
+    }
 }
 
 void ParticleEmitter::cleanup_dead_particles_() {
@@ -11,9 +11,14 @@
 
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
 namespace udjourney {
 
 namespace {
+bool is_power_of_two(int value) {
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
 void draw_texture_tiled(const Texture2D &texture, Rectangle dest, Color tint) {
     if (texture.id == 0 || dest.width <= 0.0f || dest.height <= 0.0f) {
         return;
@@ -25,6 +30,15 @@ void draw_texture_tiled(const Texture2D &texture, Rectangle dest, Color tint) {
         return;
     }
 
+    // With repeat wrapping, a source rect larger than the texture maps to
+    // UVs past 1.0 and the GPU tiles it: one quad for the whole platform.
+    // Repeat needs power-of-two sizes on GLES2 and the Dreamcast.
+    if (is_power_of_two(texture.width) && is_power_of_two(texture.height)) {
+        Rectangle src = {0.0f, 0.0f, dest.width, dest.height};
+        draw::texture_pro(texture, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
+        return;
+    }
+
     const float right = dest.x + dest.width;
     const float bottom = dest.y + dest.height;
 
@@ -38,7 +52,8 @@ void draw_texture_tiled(const Texture2D &texture, Rectangle dest, Color tint) {
 
             Rectangle src = {0.0f, 0.0f, draw_w, draw_h};
             Rectangle dst = {x, y, draw_w, draw_h};
-            DrawTexturePro(texture, src, dst, Vector2{0.0f, 0.0f}, 0.0f, tint);
+            draw::texture_pro(
+                texture, src, dst, Vector2{0.0f, 0.0f}, 0.0f, tint);
         }
     }
 }
@@ -68,37 +83,46 @@ void draw_texture_tiled_from_atlas(const Texture2D &texture,
 
             Rectangle src = {source_rect.x, source_rect.y, draw_w, draw_h};
             Rectangle dst = {x, y, draw_w, draw_h};
-            DrawTexturePro(texture, src, dst, Vector2{0.0f, 0.0f}, 0.0f, tint);
+            draw::texture_pro(
+                texture, src, dst, Vector2{0.0f, 0.0f}, 0.0f, tint);
         }
     }
 }
 
-void draw_rounded_rect_outline(Rectangle rect, float radius_px, float thickness,
-                               Color color, int segments) {
-    if (rect.width <= 0.0f || rect.height <= 0.0f) {
+void build_rounded_rect_outline(TriangleList &out, Rectangle rect,
+                                float radius_px, float thickness,
+                                int segments) {
+    out.clear();
+    if (rect.width <= 0.0f || rect.height <= 0.0f || thickness <= 0.0f) {
         return;
     }
 
-    const float min_side = std::min(rect.width, rect.height);
+    const float x = rect.x;
+    const float y = rect.y;
+    const float w = rect.width;
+    const float h = rect.height;
+
+    const float min_side = std::min(w, h);
     float radius = std::clamp(radius_px, 0.0f, min_side * 0.5f);
-    if (radius <= 0.0f || thickness <= 0.0f) {
-        DrawRectangleLinesEx(rect, thickness, color);
+    if (radius <= 0.0f) {
+        // Same split as DrawRectangleLinesEx
+        out.add_rect(Rectangle{x, y, w, thickness});
+        out.add_rect(Rectangle{x, y + h - thickness, w, thickness});
+        out.add_rect(
+            Rectangle{x, y + thickness, thickness, h - 2.0f * thickness});
+        out.add_rect(Rectangle{
+            x + w - thickness, y + thickness, thickness, h - 2.0f * thickness});
         return;
     }
 
     segments = std::max(segments, 4);
 
-    const float x = rect.x;
-    const float y = rect.y;
-    const float w = rect.width;
-    const float h = rect.height;
-
     const Vector2 tl = {x + radius, y + radius};
     const Vector2 tr = {x + w - radius, y + radius};
     const Vector2 br = {x + w - radius, y + h - radius};
     const Vector2 bl = {x + radius, y + h - radius};
 
-    auto draw_arc = [&](Vector2 center, float start_deg, float end_deg) {
+    auto add_arc = [&](Vector2 center, float start_deg, float end_deg) {
         constexpr float pi = 3.14159265358979323846f;
         const float start = start_deg * (pi / 180.0f);
         const float end = end_deg * (pi / 180.0f);
@@ -112,29 +136,23 @@ void draw_rounded_rect_outline(Rectangle rect, float radius_px, float thickness,
                                 center.y + std::sin(a0) * radius};
             const Vector2 p1 = {center.x + std::cos(a1) * radius,
                                 center.y + std::sin(a1) * radius};
-            DrawLineEx(p0, p1, thickness, color);
+            out.add_line(p0, p1, thickness);
         }
     };
 
     // Straight edges between arcs
-    DrawLineEx(
-        Vector2{x + radius, y}, Vector2{x + w - radius, y}, thickness, color);
-    DrawLineEx(Vector2{x + w, y + radius},
-               Vector2{x + w, y + h - radius},
-               thickness,
-               color);
-    DrawLineEx(Vector2{x + w - radius, y + h},
-               Vector2{x + radius, y + h},
-               thickness,
-               color);
-    DrawLineEx(
-        Vector2{x, y + h - radius}, Vector2{x, y + radius}, thickness, color);
+    out.add_line(Vector2{x + radius, y}, Vector2{x + w - radius, y}, thickness);
+    out.add_line(
+        Vector2{x + w, y + radius}, Vector2{x + w, y + h - radius}, thickness);
+    out.add_line(
+        Vector2{x + w - radius, y + h}, Vector2{x + radius, y + h}, thickness);
+    out.add_line(Vector2{x, y + h - radius}, Vector2{x, y + radius}, thickness);
 
     // Corner arcs (degrees)
-    draw_arc(tl, 180.0f, 270.0f);
-    draw_arc(tr, 270.0f, 360.0f);
-    draw_arc(br, 0.0f, 90.0f);
-    draw_arc(bl, 90.0f, 180.0f);
+    add_arc(tl, 180.0f, 270.0f);
+    add_arc(tr, 270.0f, 360.0f);
+    add_arc(br, 0.0f, 90.0f);
+    add_arc(bl, 90.0f, 180.0f);
 }
 }  // namespace
 
@@ -158,13 +176,30 @@ Rectangle Platform::get_drawing_rect() const {
 }
 
 void Platform::draw() const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Platforms);
+    if (!m_baked) {
+        draw_static();
+    }
+
+    for (const auto &feature : m_features) {
+        feature->draw_overlay(*this);
+    }
+}
+
+bool Platform::is_bakeable() const noexcept {
+    return !m_reuse_strategy && m_behavior &&
+           m_behavior->get_type() == PlatformBehaviorType::Static;
+}
+
+void Platform::draw_static() const {
     Rectangle rect = get_drawing_rect();
 
     bool drew_texture = false;
-    if (!m_texture_file.empty()) {
-        Texture2D texture =
-            TextureManager::get_instance().get_texture(m_texture_file);
-        if (texture.id != 0) {
+    if (m_texture.is_valid()) {
+        auto& texture_manager = TextureManager::get_instance();
+        Texture2D texture = texture_manager.get(m_texture);
+        // Flat color until a background upload lands
+        if (texture.id != 0 && texture_manager.is_ready(m_texture)) {
             Rectangle src;
             Vector2 origin = {0.0f, 0.0f};
 
@@ -178,12 +213,15 @@ void Platform::draw() const {
                 } else {
                     // Stretch the atlas tile to fit the platform
                     src = m_source_rect;
-                    DrawTexturePro(texture, src, rect, origin, 0.0f, WHITE);
+                    draw::texture_pro(texture, src, rect, origin, 0.0f, WHITE);
                 }
                 drew_texture = true;
             } else if (m_texture_tiled) {
                 // Tiled rendering no atlas (legacy)
-                draw_texture_tiled(texture, rect, WHITE);
+                draw_texture_tiled(
+                    texture_manager.get_repeating(m_texture),
+                    rect,
+                    WHITE);
                 drew_texture = true;
             } else {
                 // Stretch entire texture no atlas (legacy)
@@ -191,31 +229,34 @@ void Platform::draw() const {
                        0.0f,
                        static_cast<float>(texture.width),
                        static_cast<float>(texture.height)};
-                DrawTexturePro(texture, src, rect, origin, 0.0f, WHITE);
+                draw::texture_pro(texture, src, rect, origin, 0.0f, WHITE);
                 drew_texture = true;
             }
         }
     }
 
     if (!drew_texture) {
-        DrawRectangleRec(rect, m_color);
+        draw::rectangle_rec(rect, m_color);
     } else {
         // Visually "round" textured platforms by drawing a rounded
         // outline over the texture (no shaders, no special textures).
-        const float radius_px = 4.0f;
-        const float thickness = 4.0f;
-        const int segments = 12;
-
-        // Adjust rect to account for outline thickness
-        // Radius need ajustment to void visual artifacts
-        auto rect_copy = rect;
-        rect_copy.x -= thickness / 4.0f;
-        rect_copy.y -= thickness / 4.0f;
-        rect_copy.width += thickness / 2.0f;
-        rect_copy.height += thickness / 2.0f;
-
-        draw_rounded_rect_outline(
-            rect_copy, radius_px, thickness, Fade(BLACK, 1.0f), segments);
+        // The geometry only depends on the size, so it is built once and
+        // rebuilt after a resize.
+        if (m_outline.empty()) {
+            const float radius_px = 4.0f;
+            const float thickness = 4.0f;
+            const int segments = 12;
+
+            // Adjust rect to account for outline thickness
+            // Radius need ajustment to void visual artifacts
+            const Rectangle local = {-thickness / 4.0f,
+                                     -thickness / 4.0f,
+                                     m_rect.width + thickness / 2.0f,
+                                     m_rect.height + thickness / 2.0f};
+            build_rounded_rect_outline(
+                m_outline, local, radius_px, thickness, segments);
+        }
+        m_outline.draw(Vector2{rect.x, rect.y}, BLACK);
     }
 
     for (const auto &feature : m_features) {
@@ -236,17 +277,40 @@ void Platform::process_input() {
 }
 
 void Platform::move(float iValX, float iValY) noexcept {
+    mark_baked_dirty_();
     m_rect.x += iValX;
     m_rect.y += iValY;
+    mark_baked_dirty_();
 }
 
 void Platform::resize(float iNewWidth, float iNewHeight) noexcept {
     if (iNewHeight > 0 && iNewWidth > 0) {
+        mark_baked_dirty_();
         m_rect.width = iNewWidth;
         m_rect.height = iNewHeight;
+        mark_baked_dirty_();
+        invalidate_geometry_();
+    }
+}
+
+void Platform::mark_baked_dirty_() const noexcept {
+    if (m_baked) {
+        get_game().mark_static_geometry_dirty(m_rect);
+    }
+}
+
+void Platform::invalidate_geometry_() noexcept {
+    m_outline.clear();
+    for (const auto &feature : m_features) {
+        feature->invalidate_geometry();
     }
 }
 
+void Platform::set_texture_file(const std::string &texture_file) {
+    m_texture = TextureManager::get_instance().get_handle(texture_file);
+    mark_baked_dirty_();
+}
+
 void Platform::add_feature(std::unique_ptr<PlatformFeatureBase> feature) {
     int_fast8_t new_type = feature->get_type();
     auto it =
@@ -257,6 +321,7 @@ void Platform::add_feature(std::unique_ptr<PlatformFeatureBase> feature) {
                      });
     if (it == m_features.end()) {
         m_features.push_back(std::move(feature));
+        mark_baked_dirty_();
     }
 }
 }  // namespace udjourney
@@ -5,6 +5,7 @@
 
 #include "udjourney/platform/Platform.hpp"
 #include "udjourney/interfaces/IActor.hpp"
+#include "udjourney/render/Draw.hpp"
 namespace udjourney {
 
 void CheckpointFeature::draw(const Platform& platform) const {
@@ -17,34 +18,35 @@ void CheckpointFeature::draw(const Platform& platform) const {
     float pole_bottom = rect.y;
 
     // Draw pole
-    DrawLineEx(Vector2{pole_x, pole_top},
-               Vector2{pole_x, pole_bottom},
-               2.0f,
-               DARKGRAY);
+    draw::line_ex(Vector2{pole_x, pole_top},
+                  Vector2{pole_x, pole_bottom},
+                  2.0f,
+                  DARKGRAY);
 
     // Draw flag
     float flag_width = 16.0f;
     float flag_height = 10.0f;
     Rectangle flag_rect = {pole_x, pole_top, flag_width, flag_height};
 
-    DrawRectangleRec(flag_rect, GREEN);
-    DrawRectangleLinesEx(flag_rect, 1.0f, DARKGREEN);
+    draw::rectangle_rec(flag_rect, GREEN);
+    draw::rectangle_lines_ex(flag_rect, 1.0f, DARKGREEN);
 
     // Draw checkpoint text if platform is wide enough
     if (rect.width > 60) {
         const char* text = "CHECKPOINT";
-        int text_width = MeasureText(text, 8);
-        DrawText(text,
-                 static_cast<int>(rect.x + (rect.width - text_width) / 2),
-                 static_cast<int>(rect.y + rect.height + 2),
-                 8,
-                 GREEN);
+        int text_width = draw::measure_text(text, 8);
+        draw::text(text,
+                   static_cast<int>(rect.x + (rect.width - text_width) / 2),
+                   static_cast<int>(rect.y + rect.height + 2),
+                   8,
+                   GREEN,
+                   platform.get_game().get_sprite_batch());
     }
 }
 
 void CheckpointFeature::handle_collision(Platform& platform, IActor& actor) {
-    // Check if this is a player collision (group_id == 0)
-    if (actor.get_group_id() == 0) {
+    // Only the player activates checkpoints
+    if (actor.get_group_id() == PLAYER_TYPE_ID) {
         // Get platform position for checkpoint
         Rectangle platform_rect = platform.get_rectangle();
 
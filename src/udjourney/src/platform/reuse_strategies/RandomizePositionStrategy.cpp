@@ -1,8 +1,7 @@
 // Copyright 2025 Quentin Cartier
 #include "udjourney/platform/reuse_strategies/RandomizePositionStrategy.hpp"
 
-#include <chrono>
-#include <random>
+#include <udj-core/Random.hpp>
 
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/platform/Platform.hpp"
@@ -16,11 +15,9 @@ void RandomizePositionStrategy::reuse(Platform& platform) {
     auto x_pos_range =
         static_cast<int>(game_rect.width - platform.get_rectangle().width);
 
-    static auto seed =
-        std::chrono::steady_clock::now().time_since_epoch().count();
-    static std::mt19937 gen(static_cast<unsigned int>(seed));
-    std::uniform_int_distribution<> distrib(0, x_pos_range);
-    auto random_x = distrib(gen);
+    auto random_x = udj::core::RngService::get_instance()
+                        .stream(udj::core::RngStream::Platforms)
+                        .range_int(0, x_pos_range);
     const auto origin_rect = platform.get_rectangle();
 
     bool is_y_repeated = platform.is_y_repeated();
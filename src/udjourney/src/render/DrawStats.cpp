@@ -0,0 +1,102 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/render/DrawStats.hpp"
+
+namespace udjourney {
+
+namespace {
+struct State {
+    std::array<DrawStats::Counters, static_cast<size_t>(DrawSubsystem::Count)>
+        current{};
+    std::array<DrawStats::Counters, static_cast<size_t>(DrawSubsystem::Count)>
+        last_frame{};
+    DrawSubsystem subsystem = DrawSubsystem::Other;
+    unsigned int last_texture = 0;
+    bool has_texture = false;  // No draw yet this frame
+};
+
+State& state() {
+    static State instance;
+    return instance;
+}
+
+constexpr size_t index_of(DrawSubsystem subsystem) {
+    return static_cast<size_t>(subsystem);
+}
+}  // namespace
+
+DrawStats::Scope::Scope(DrawSubsystem subsystem) :
+    previous_(state().subsystem) {
+    state().subsystem = subsystem;
+}
+
+DrawStats::Scope::~Scope() { state().subsystem = previous_; }
+
+void DrawStats::record(size_t vertices, unsigned int texture_id,
+                       size_t calls) {
+    State& s = state();
+    Counters& counters = s.current[index_of(s.subsystem)];
+    counters.calls += calls;
+    counters.vertices += vertices;
+    if (!s.has_texture || texture_id != s.last_texture) {
+        ++counters.texture_changes;
+        s.last_texture = texture_id;
+        s.has_texture = true;
+    }
+}
+
+void DrawStats::end_frame() {
+    State& s = state();
+    s.last_frame = s.current;
+    s.current = Table{};
+    s.has_texture = false;
+}
+
+void DrawStats::reset() {
+    State& s = state();
+    s.current = Table{};
+    s.last_frame = Table{};
+    s.subsystem = DrawSubsystem::Other;
+    s.has_texture = false;
+}
+
+DrawSubsystem DrawStats::get_current() { return state().subsystem; }
+
+const DrawStats::Counters& DrawStats::get_frame(DrawSubsystem subsystem) {
+    return state().last_frame[index_of(subsystem)];
+}
+
+DrawStats::Counters DrawStats::get_frame_total() {
+    Counters total;
+    for (const Counters& counters : state().last_frame) {
+        total += counters;
+    }
+    return total;
+}
+
+const char* DrawStats::get_name(DrawSubsystem subsystem) {
+    switch (subsystem) {
+        case DrawSubsystem::Other:
+            return "other";
+        case DrawSubsystem::Background:
+            return "background";
+        case DrawSubsystem::Platforms:
+            return "platforms";
+        case DrawSubsystem::Player:
+            return "player";
+        case DrawSubsystem::Monsters:
+            return "monsters";
+        case DrawSubsystem::Projectiles:
+            return "projectiles";
+        case DrawSubsystem::Particles:
+            return "particles";
+        case DrawSubsystem::Hud:
+            return "hud";
+        case DrawSubsystem::SpriteBatch:
+            return "batch";
+        case DrawSubsystem::Count:
+            break;
+    }
+    return "?";
+}
+
+}  // namespace udjourney
@@ -0,0 +1,227 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/render/SpriteBatch.hpp"
+
+#include <raylib/rlgl.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "udjourney/render/Draw.hpp"
+
+namespace udjourney {
+
+void SpriteBatch::begin() {
+    commands_.clear();
+    order_.clear();
+    recording_ = true;
+}
+
+void SpriteBatch::draw_texture(uint8_t layer_id, Texture2D texture,
+                               Rectangle source, Rectangle dest,
+                               Vector2 origin, float rotation, Color tint,
+                               uint16_t depth) {
+    if (texture.id == 0) {
+        return;
+    }
+    if (!recording_) {
+        draw::texture_pro(texture, source, dest, origin, rotation, tint);
+        return;
+    }
+
+    order_.emplace_back(make_sort_key(layer_id, texture.id, depth),
+                        static_cast<uint32_t>(commands_.size()));
+    commands_.push_back(SpriteCommand{texture.id,
+                                      static_cast<float>(texture.width),
+                                      static_cast<float>(texture.height),
+                                      source,
+                                      dest,
+                                      origin,
+                                      rotation,
+                                      tint});
+}
+
+void SpriteBatch::draw_rect(uint8_t layer_id, Rectangle dest, Color color,
+                            Vector2 origin, float rotation, uint16_t depth) {
+    if (!recording_) {
+        draw::rectangle_pro(dest, origin, rotation, color);
+        return;
+    }
+
+    const unsigned int white = rlGetTextureIdDefault();
+    order_.emplace_back(make_sort_key(layer_id, white, depth),
+                        static_cast<uint32_t>(commands_.size()));
+    commands_.push_back(SpriteCommand{white,
+                                      1.0f,
+                                      1.0f,
+                                      Rectangle{0.0f, 0.0f, 1.0f, 1.0f},
+                                      dest,
+                                      origin,
+                                      rotation,
+                                      color});
+}
+
+void SpriteBatch::draw_rect_lines(uint8_t layer_id, Rectangle rect,
+                                  float thickness, Color color,
+                                  uint16_t depth) {
+    // Same split as DrawRectangleLinesEx: full-width top/bottom, inner sides
+    const float inner_height = rect.height - 2.0f * thickness;
+    draw_rect(layer_id,
+              Rectangle{rect.x, rect.y, rect.width, thickness},
+              color,
+              {0.0f, 0.0f},
+              0.0f,
+              depth);
+    draw_rect(layer_id,
+              Rectangle{rect.x,
+                        rect.y + rect.height - thickness,
+                        rect.width,
+                        thickness},
+              color,
+              {0.0f, 0.0f},
+              0.0f,
+              depth);
+    if (inner_height > 0.0f) {
+        draw_rect(layer_id,
+                  Rectangle{rect.x, rect.y + thickness, thickness, inner_height},
+                  color,
+                  {0.0f, 0.0f},
+                  0.0f,
+                  depth);
+        draw_rect(layer_id,
+                  Rectangle{rect.x + rect.width - thickness,
+                            rect.y + thickness,
+                            thickness,
+                            inner_height},
+                  color,
+                  {0.0f, 0.0f},
+                  0.0f,
+                  depth);
+    }
+}
+
+void SpriteBatch::flush() {
+    recording_ = false;
+    if (commands_.empty()) {
+        order_.clear();
+        return;
+    }
+
+    // Index is the tie-breaker, which keeps submission order for equal keys
+    std::sort(order_.begin(), order_.end());
+
+    // Runs count toward the caller's subsystem, if it opened a scope
+    const DrawSubsystem caller = DrawStats::get_current();
+    DrawStats::Scope stats_scope(caller == DrawSubsystem::Other
+                                     ? DrawSubsystem::SpriteBatch
+                                     : caller);
+    unsigned int run_texture = 0;
+    size_t run_quads = 0;
+    bool in_run = false;
+
+    for (const auto& [key, index] : order_) {
+        const SpriteCommand& command = commands_[index];
+
+        if (!in_run || command.texture_id != run_texture) {
+            if (in_run) {
+                rlEnd();
+                DrawStats::record(run_quads * draw::kQuadVertices,
+                                  run_texture);
+            }
+            run_texture = command.texture_id;
+            if (run_texture != bound_texture_) {
+                bound_texture_ = run_texture;
+                ++current_.texture_binds;
+            }
+            rlSetTexture(run_texture);
+            rlBegin(RL_QUADS);
+            in_run = true;
+            run_quads = 0;
+            ++current_.draw_calls;
+        }
+
+        rlCheckRenderBatchLimit(4);
+        emit_quad_(command);
+        ++run_quads;
+        ++current_.sprites;
+    }
+
+    rlEnd();
+    DrawStats::record(run_quads * draw::kQuadVertices, run_texture);
+    rlSetTexture(0);
+
+    commands_.clear();
+    order_.clear();
+}
+
+void SpriteBatch::end_frame() {
+    last_frame_ = current_;
+    current_ = Stats{};
+    bound_texture_ = 0;
+}
+
+void SpriteBatch::emit_quad_(const SpriteCommand& command) const {
+    Rectangle source = command.source;
+    const Rectangle& dest = command.dest;
+
+    bool flip_x = false;
+    if (source.width < 0.0f) {
+        flip_x = true;
+        source.width = -source.width;
+    }
+    if (source.height < 0.0f) {
+        source.y -= source.height;
+    }
+
+    Vector2 top_left;
+    Vector2 top_right;
+    Vector2 bottom_left;
+    Vector2 bottom_right;
+
+    if (command.rotation == 0.0f) {
+        const float x = dest.x - command.origin.x;
+        const float y = dest.y - command.origin.y;
+        top_left = Vector2{x, y};
+        top_right = Vector2{x + dest.width, y};
+        bottom_left = Vector2{x, y + dest.height};
+        bottom_right = Vector2{x + dest.width, y + dest.height};
+    } else {
+        const float radians = command.rotation * DEG2RAD;
+        const float sin_r = std::sin(radians);
+        const float cos_r = std::cos(radians);
+        const float dx = -command.origin.x;
+        const float dy = -command.origin.y;
+
+        top_left = Vector2{dest.x + dx * cos_r - dy * sin_r,
+                           dest.y + dx * sin_r + dy * cos_r};
+        top_right = Vector2{dest.x + (dx + dest.width) * cos_r - dy * sin_r,
+                            dest.y + (dx + dest.width) * sin_r + dy * cos_r};
+        bottom_left =
+            Vector2{dest.x + dx * cos_r - (dy + dest.height) * sin_r,
+                    dest.y + dx * sin_r + (dy + dest.height) * cos_r};
+        bottom_right = Vector2{
+            dest.x + (dx + dest.width) * cos_r - (dy + dest.height) * sin_r,
+            dest.y + (dx + dest.width) * sin_r + (dy + dest.height) * cos_r};
+    }
+
+    const float u0 = source.x / command.texture_width;
+    const float u1 = (source.x + source.width) / command.texture_width;
+    const float v0 = source.y / command.texture_height;
+    const float v1 = (source.y + source.height) / command.texture_height;
+    const float left_u = flip_x ? u1 : u0;
+    const float right_u = flip_x ? u0 : u1;
+
+    rlColor4ub(
+        command.tint.r, command.tint.g, command.tint.b, command.tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    rlTexCoord2f(left_u, v0);
+    rlVertex2f(top_left.x, top_left.y);
+    rlTexCoord2f(left_u, v1);
+    rlVertex2f(bottom_left.x, bottom_left.y);
+    rlTexCoord2f(right_u, v1);
+    rlVertex2f(bottom_right.x, bottom_right.y);
+    rlTexCoord2f(right_u, v0);
+    rlVertex2f(top_right.x, top_right.y);
+}
+
+}  // namespace udjourney
@@ -8,14 +8,19 @@
 #include "udjourney/Game.hpp"
 #include "udjourney/platform/Platform.hpp"
 #include "udjourney/platform/behavior_strategies/CameraFollowVerticalBehaviorStrategy.hpp"
+#include "udjourney/render/Draw.hpp"
 
 namespace udjourney {
 
-// Helper: draw widgets (actors with group_id == 4)
+// Helper: draw widgets (WIDGET_TYPE_ID actors)
 static void draw_widgets_(const Game& game) {
+    // One batch pass per widget, so its text lands on top of its own panel
+    SpriteBatch* batch = game.get_sprite_batch();
     for (const auto& actor : game.get_actors()) {
-        if (actor && actor->get_group_id() == 4) {
+        if (actor && actor->get_group_id() == WIDGET_TYPE_ID) {
+            batch->begin();
             actor->draw();
+            batch->flush();
         }
     }
 }
@@ -35,31 +40,46 @@ static void draw_finish_line_(const Game& game) {
         Rectangle finish_line = {
             0, line_y - line_thickness / 2, game_rect.width, line_thickness};
 
-        DrawRectangleRec(finish_line, MAGENTA);
-        DrawRectangleLinesEx(finish_line, 1.0f, PINK);
+        draw::rectangle_rec(finish_line, MAGENTA);
+        draw::rectangle_lines_ex(finish_line, 1.0f, PINK);
 
         if (line_y >= 50 && line_y <= game_rect.height - 50) {
             const char* finish_text = "FINISH LINE";
-            int text_width = MeasureText(finish_text, 16);
-            DrawText(finish_text,
-                     static_cast<int>(game_rect.width - text_width - 10),
-                     static_cast<int>(line_y - 25),
-                     16,
-                     MAGENTA);
+            int text_width = draw::measure_text(finish_text, 16);
+            draw::text(finish_text,
+                       static_cast<int>(game_rect.width - text_width - 10),
+                       static_cast<int>(line_y - 25),
+                       16,
+                       MAGENTA);
         }
     }
 }
 
 // UiScreenRenderer: for TITLE, WIN, GAMEOVER
 void UiScreenRenderer::render(const Game& game) const {
+    SpriteBatch* batch = game.get_sprite_batch();
+    batch->begin();
     game.draw_backgrounds();
+    batch->flush();
+
     game.draw_huds();
     draw_widgets_(game);
 }
 
 // PlayStateRenderer: for PLAY
 void PlayStateRenderer::render(const Game& game) const {
+    SpriteBatch* batch = game.get_sprite_batch();
+
+    batch->begin();
     game.draw_backgrounds();
+    batch->flush();
+
+    // Static platforms, baked at scene load
+    game.draw_static_chunks();
+
+    // Actor sprites are batched; platforms still draw immediately, so they
+    // land underneath everything flushed at the end of this pass.
+    batch->begin();
 
     // Draw all actors except camera-following platforms
     std::vector<const IActor*> camera_follow_platforms;
@@ -68,7 +88,7 @@ void PlayStateRenderer::render(const Game& game) const {
         // Check if this is a camera-following platform
         // TEMPORARILY DISABLED FOR DEBUGGING
         /*
-        if (actor->get_group_id() == 1) {  // Platform group
+        if (actor->get_group_id() == PLATFORM_TYPE_ID) {
             auto* platform = static_cast<const Platform*>(actor.get());
             if (platform && platform->get_behavior()) {
                 auto* behavior = platform->get_behavior();
@@ -87,12 +107,15 @@ void PlayStateRenderer::render(const Game& game) const {
     if (auto* player = game.get_player()) {
         player->draw();
     }
+    batch->flush();
 
     // Draw finish line
     draw_finish_line_(game);
 
     // Draw particles
+    batch->begin();
     game.draw_particles();
+    batch->flush();
 
     // Draw camera-following platforms last (on top of everything)
     for (const auto* platform : camera_follow_platforms) {
@@ -102,23 +125,46 @@ void PlayStateRenderer::render(const Game& game) const {
     // Draw dash HUD (TODO: move to HUDManager)
     const auto& dash_hud = game.get_dash_hud();
     Rectangle rect = game.get_rectangle();
-    DrawCircle(static_cast<int>(rect.width) - 50,
-               45,
-               17,
-               dash_hud.dashable == 1 ? GREEN : RED);
+    draw::circle(static_cast<int>(rect.width) - 50,
+                 45,
+                 17,
+                 dash_hud.dashable == 1 ? GREEN : RED);
 }
 
 // PauseStateRenderer: for PAUSE
 void PauseStateRenderer::render(const Game& game) const {
-    // Draw gameplay scene first
-    PlayStateRenderer play_renderer;
-    play_renderer.render(game);
-
-    // Overlay pause text
-    DrawText(" -- PAUSE -- \n", 10, 10, 20, RED);
-    DrawText("Press START to resume\n", 300, 40, 20, WHITE);
-    DrawText("Press L to load level\n", 300, 70, 20, WHITE);
-    DrawText("Press B button to quit\n", 300, 100, 20, RED);
+    // Draw the gameplay frame captured on pause, optionally dimmed
+    if (const RenderTexture2D* frozen = game.get_frozen_frame()) {
+        const Rectangle rect = game.get_rectangle();
+        const Texture2D& frame = frozen->texture;
+        // Render textures are stored bottom-up, hence the flipped source
+        draw::texture_pro(frame,
+                          Rectangle{0.0f,
+                                    0.0f,
+                                    static_cast<float>(frame.width),
+                                    -static_cast<float>(frame.height)},
+                          Rectangle{0.0f, 0.0f, rect.width, rect.height},
+                          Vector2{0.0f, 0.0f},
+                          0.0f,
+                          WHITE);
+        if (m_dim > 0.0f) {
+            draw::rectangle_rec(Rectangle{0.0f, 0.0f, rect.width, rect.height},
+                                Fade(BLACK, m_dim));
+        }
+    } else {
+        // No capture available: draw gameplay scene live
+        PlayStateRenderer play_renderer;
+        play_renderer.render(game);
+    }
+
+    // Overlay pause text, in one batch pass
+    SpriteBatch* batch = game.get_sprite_batch();
+    batch->begin();
+    draw::text(" -- PAUSE -- \n", 10, 10, 20, RED, batch);
+    draw::text("Press START to resume\n", 300, 40, 20, WHITE, batch);
+    draw::text("Press L to load level\n", 300, 70, 20, WHITE, batch);
+    draw::text("Press B button to quit\n", 300, 100, 20, RED, batch);
+    batch->flush();
 }
 
 }  // namespace udjourney
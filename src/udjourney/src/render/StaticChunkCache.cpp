@@ -0,0 +1,239 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/render/StaticChunkCache.hpp"
+
+#include <raylib/rlgl.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <udj-core/Logger.hpp>
+
+#include "udjourney/platform/Platform.hpp"
+#include "udjourney/render/Draw.hpp"
+
+namespace udjourney {
+
+namespace {
+// Decorations drawn outside the platform rect (spikes, checkpoint flag/text)
+constexpr float kDecorationMargin = 32.0f;
+
+Platform* as_platform(const std::unique_ptr<IActor>& actor) {
+    if (!actor || actor->get_group_id() != PLATFORM_TYPE_ID) {
+        return nullptr;
+    }
+    return static_cast<Platform*>(actor.get());
+}
+}  // namespace
+
+StaticChunkCache::~StaticChunkCache() { unload_targets_(); }
+
+int StaticChunkCache::chunk_index_(float world_y) {
+    return static_cast<int>(std::floor(world_y / kChunkHeight));
+}
+
+void StaticChunkCache::build(
+    const std::vector<std::unique_ptr<IActor>>& actors) {
+    clear();
+
+    for (const auto& actor : actors) {
+        Platform* platform = as_platform(actor);
+        if (!platform) {
+            continue;
+        }
+        const bool bake = !disabled_ && platform->is_bakeable();
+        platform->set_baked(bake);
+        if (bake) {
+            ++baked_platforms_;
+        }
+    }
+
+    if (baked_platforms_ > 0) {
+        udj::core::Logger::debug("Static chunks: % platforms baked",
+                                 baked_platforms_);
+    }
+}
+
+void StaticChunkCache::clear() {
+    for (auto& slot : slots_) {
+        slot.valid = false;
+    }
+    baked_platforms_ = 0;
+}
+
+void StaticChunkCache::mark_dirty(Rectangle world_rect) {
+    const int first = chunk_index_(world_rect.y - kDecorationMargin);
+    const int last = chunk_index_(world_rect.y + world_rect.height +
+                                  kDecorationMargin);
+    for (auto& slot : slots_) {
+        if (slot.chunk >= first && slot.chunk <= last) {
+            slot.valid = false;
+        }
+    }
+}
+
+void StaticChunkCache::mark_all_dirty() {
+    for (auto& slot : slots_) {
+        slot.valid = false;
+    }
+}
+
+const StaticChunkCache::Slot* StaticChunkCache::find_slot_(int chunk) const {
+    for (const auto& slot : slots_) {
+        if (slot.valid && slot.chunk == chunk) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+StaticChunkCache::Slot& StaticChunkCache::acquire_slot_(int chunk,
+                                                        int first_visible,
+                                                        int last_visible) {
+    // Reuse the slot that already holds this chunk (it is dirty), otherwise
+    // an invalid one, otherwise the least recently used off-screen chunk.
+    Slot* best = nullptr;
+    for (auto& slot : slots_) {
+        if (slot.chunk == chunk) {
+            return slot;
+        }
+        if (slot.valid && slot.chunk >= first_visible &&
+            slot.chunk <= last_visible) {
+            continue;
+        }
+        if (!best || (!slot.valid && best->valid) ||
+            (slot.valid == best->valid && slot.last_used < best->last_used)) {
+            best = &slot;
+        }
+    }
+    return best ? *best : slots_.front();
+}
+
+bool StaticChunkCache::ensure_targets_(Rectangle camera) {
+    if (targets_loaded_) {
+        return true;
+    }
+
+    const int width = static_cast<int>(camera.width);
+    const int height = static_cast<int>(kChunkHeight);
+    for (auto& slot : slots_) {
+        slot.target = LoadRenderTexture(width, height);
+        slot.valid = false;
+        if (slot.target.id == 0) {
+            udj::core::Logger::warning(
+                "Static chunks: render textures unavailable, drawing "
+                "platforms per actor");
+            unload_targets_();
+            disabled_ = true;
+            return false;
+        }
+    }
+    targets_loaded_ = true;
+    return true;
+}
+
+void StaticChunkCache::prepare(
+    const std::vector<std::unique_ptr<IActor>>& actors, Rectangle camera) {
+    DrawStats::Scope draw_scope(DrawSubsystem::Platforms);
+    if (baked_platforms_ == 0) {
+        return;
+    }
+    if (!ensure_targets_(camera)) {
+        // Hand the platforms back to per-actor rendering
+        for (const auto& actor : actors) {
+            if (Platform* platform = as_platform(actor)) {
+                platform->set_baked(false);
+            }
+        }
+        baked_platforms_ = 0;
+        return;
+    }
+
+    ++frame_;
+    const int first = chunk_index_(camera.y);
+    const int last = chunk_index_(camera.y + camera.height - 1.0f);
+    for (int chunk = first; chunk <= last; ++chunk) {
+        auto cached = std::find_if(
+            slots_.begin(), slots_.end(), [&](const Slot& slot) {
+                return slot.valid && slot.chunk == chunk &&
+                       slot.camera_x == camera.x;
+            });
+        if (cached != slots_.end()) {
+            cached->last_used = frame_;
+            continue;
+        }
+        Slot& slot = acquire_slot_(chunk, first, last);
+        bake_(slot, chunk, actors, camera);
+        slot.last_used = frame_;
+    }
+}
+
+void StaticChunkCache::bake_(
+    Slot& slot, int chunk, const std::vector<std::unique_ptr<IActor>>& actors,
+    Rectangle camera) {
+    const float chunk_top = static_cast<float>(chunk) * kChunkHeight;
+    const float chunk_bottom = chunk_top + kChunkHeight;
+
+    BeginTextureMode(slot.target);
+    ClearBackground(BLANK);
+
+    // Platforms draw at world - camera; shift so the chunk top lands at 0
+    rlPushMatrix();
+    rlTranslatef(0.0f, camera.y - chunk_top, 0.0f);
+    for (const auto& actor : actors) {
+        const Platform* platform = as_platform(actor);
+        if (!platform || !platform->is_baked()) {
+            continue;
+        }
+        const Rectangle rect = platform->get_rectangle();
+        if (rect.y + rect.height + kDecorationMargin < chunk_top ||
+            rect.y - kDecorationMargin > chunk_bottom) {
+            continue;
+        }
+        platform->draw_static();
+    }
+    rlPopMatrix();
+
+    EndTextureMode();
+
+    slot.chunk = chunk;
+    slot.camera_x = camera.x;
+    slot.valid = true;
+    ++bake_count_;
+}
+
+void StaticChunkCache::draw(Rectangle camera) const {
+    DrawStats::Scope draw_scope(DrawSubsystem::Platforms);
+    if (baked_platforms_ == 0 || !targets_loaded_) {
+        return;
+    }
+
+    const int first = chunk_index_(camera.y);
+    const int last = chunk_index_(camera.y + camera.height - 1.0f);
+    for (int chunk = first; chunk <= last; ++chunk) {
+        const Slot* slot = find_slot_(chunk);
+        if (!slot) {
+            continue;
+        }
+        const Texture2D& texture = slot->target.texture;
+        // Render textures are stored bottom-up: flip the source vertically
+        const Rectangle source{0.0f,
+                               0.0f,
+                               static_cast<float>(texture.width),
+                               -static_cast<float>(texture.height)};
+        const Vector2 position{
+            0.0f, static_cast<float>(chunk) * kChunkHeight - camera.y};
+        draw::texture_rec(texture, source, position, WHITE);
+    }
+}
+
+void StaticChunkCache::unload_targets_() {
+    for (auto& slot : slots_) {
+        if (slot.target.id != 0) {
+            UnloadRenderTexture(slot.target);
+        }
+        slot = Slot{};
+    }
+    targets_loaded_ = false;
+}
+
+}  // namespace udjourney
@@ -0,0 +1,171 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/render/TextRenderer.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace udjourney {
+
+namespace {
+// raylib's DrawText/MeasureText constants
+constexpr int kDefaultFontSize = 10;
+constexpr int kTextLineSpacing = 2;
+
+// Layouts for changing strings (scores, timers) pile up; start over rather
+// than tracking recency
+constexpr size_t kMaxCachedLayouts = 512;
+}  // namespace
+
+TextRenderer& TextRenderer::get_instance() {
+    static TextRenderer instance;
+    return instance;
+}
+
+TextLayout TextRenderer::build_layout(const Font& font, const char* text,
+                                      int font_size) {
+    TextLayout layout;
+    if (text == nullptr || text[0] == '\0' || font.glyphCount <= 0 ||
+        font.baseSize <= 0) {
+        return layout;
+    }
+
+    font_size = std::max(font_size, kDefaultFontSize);
+    const float spacing = static_cast<float>(font_size / kDefaultFontSize);
+    const float scale =
+        static_cast<float>(font_size) / static_cast<float>(font.baseSize);
+    const float padding = static_cast<float>(font.glyphPadding);
+
+    float offset_x = 0.0f;
+    float offset_y = 0.0f;
+    // MeasureText: widest line in unscaled units, plus spacing per codepoint
+    float line_width = 0.0f;
+    float max_line_width = 0.0f;
+    int line_codepoints = 0;
+    int max_line_codepoints = 0;
+
+    for (const char* c = text; *c != '\0';) {
+        int byte_count = 0;
+        const int codepoint = GetCodepointNext(c, &byte_count);
+        c += std::max(byte_count, 1);
+        const int index = GetGlyphIndex(font, codepoint);
+        const GlyphInfo& glyph = font.glyphs[index];
+        const Rectangle& rec = font.recs[index];
+
+        ++line_codepoints;
+        if (codepoint == '\n') {
+            offset_y += static_cast<float>(font_size + kTextLineSpacing);
+            offset_x = 0.0f;
+            max_line_width = std::max(max_line_width, line_width);
+            line_width = 0.0f;
+            line_codepoints = 0;
+            continue;
+        }
+        max_line_codepoints = std::max(max_line_codepoints, line_codepoints);
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            layout.glyphs.push_back(TextLayout::Glyph{
+                Rectangle{rec.x - padding,
+                          rec.y - padding,
+                          rec.width + 2.0f * padding,
+                          rec.height + 2.0f * padding},
+                Rectangle{offset_x + (glyph.offsetX - padding) * scale,
+                          offset_y + (glyph.offsetY - padding) * scale,
+                          (rec.width + 2.0f * padding) * scale,
+                          (rec.height + 2.0f * padding) * scale}});
+        }
+
+        const float advance = glyph.advanceX == 0
+                                  ? rec.width
+                                  : static_cast<float>(glyph.advanceX);
+        offset_x += advance * scale + spacing;
+        line_width += glyph.advanceX > 0
+                          ? static_cast<float>(glyph.advanceX)
+                          : rec.width + static_cast<float>(glyph.offsetX);
+    }
+    max_line_width = std::max(max_line_width, line_width);
+
+    layout.width = max_line_width * scale +
+                   static_cast<float>(max_line_codepoints - 1) * spacing;
+    return layout;
+}
+
+bool TextRenderer::ensure_font_() {
+    if (m_font.texture.id == 0 && !m_custom_font) {
+        // Only valid once the window (and GL context) exists
+        m_font = GetFontDefault();
+    }
+    return m_font.texture.id != 0;
+}
+
+void TextRenderer::set_font(const Font& font) {
+    m_font = font;
+    m_custom_font = true;
+    clear_layouts_();
+}
+
+void TextRenderer::clear_layouts_() {
+    m_layouts.clear();
+    m_layout_count = 0;
+}
+
+const TextLayout& TextRenderer::get_layout(const char* text, int font_size) {
+    static const TextLayout kEmpty;
+    if (text == nullptr || !ensure_font_()) {
+        return kEmpty;
+    }
+
+    LayoutMap& layouts = m_layouts[font_size];
+    const std::string_view key(text);
+    auto it = layouts.find(key);
+    if (it != layouts.end()) {
+        return it->second;
+    }
+
+    if (m_layout_count >= kMaxCachedLayouts) {
+        clear_layouts_();
+    }
+    ++m_layout_count;
+    return m_layouts[font_size]
+        .emplace(std::string(key), build_layout(m_font, text, font_size))
+        .first->second;
+}
+
+int TextRenderer::measure(const char* text, int font_size) {
+    return static_cast<int>(get_layout(text, font_size).width);
+}
+
+void TextRenderer::draw(const char* text, int pos_x, int pos_y, int font_size,
+                        Color color, SpriteBatch* batch, uint8_t layer_id) {
+    const TextLayout& layout = get_layout(text, font_size);
+    if (layout.glyphs.empty()) {
+        return;
+    }
+
+    SpriteBatch& target =
+        batch != nullptr && batch->is_recording() ? *batch : m_immediate;
+    if (&target == &m_immediate) {
+        m_immediate.begin();
+    }
+
+    const float x = static_cast<float>(pos_x);
+    const float y = static_cast<float>(pos_y);
+    for (const TextLayout::Glyph& glyph : layout.glyphs) {
+        target.draw_texture(layer_id,
+                            m_font.texture,
+                            glyph.source,
+                            Rectangle{x + glyph.dest.x,
+                                      y + glyph.dest.y,
+                                      glyph.dest.width,
+                                      glyph.dest.height},
+                            Vector2{0.0f, 0.0f},
+                            0.0f,
+                            color);
+    }
+
+    if (&target == &m_immediate) {
+        m_immediate.flush();
+        m_immediate.end_frame();
+    }
+}
+
+}  // namespace udjourney
@@ -0,0 +1,70 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/render/TriangleList.hpp"
+
+#include <raylib/rlgl.h>
+
+#include <cmath>
+
+#include "udjourney/render/DrawStats.hpp"
+
+namespace udjourney {
+
+void TriangleList::add_triangle(Vector2 a, Vector2 b, Vector2 c) {
+    // raylib expects counter-clockwise triangles as seen on screen (y down),
+    // which is a negative cross product here; flip the others so nothing is
+    // back-face culled.
+    const float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    vertices_.push_back(a);
+    if (cross > 0.0f) {
+        vertices_.push_back(c);
+        vertices_.push_back(b);
+    } else {
+        vertices_.push_back(b);
+        vertices_.push_back(c);
+    }
+}
+
+void TriangleList::add_line(Vector2 start, Vector2 end, float thickness) {
+    const float dx = end.x - start.x;
+    const float dy = end.y - start.y;
+    const float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f || thickness <= 0.0f) {
+        return;
+    }
+
+    const float scale = thickness / (2.0f * length);
+    const Vector2 normal{-dy * scale, dx * scale};
+
+    const Vector2 a{start.x + normal.x, start.y + normal.y};
+    const Vector2 b{start.x - normal.x, start.y - normal.y};
+    const Vector2 c{end.x + normal.x, end.y + normal.y};
+    const Vector2 d{end.x - normal.x, end.y - normal.y};
+    add_triangle(a, b, c);
+    add_triangle(b, d, c);
+}
+
+void TriangleList::add_rect(Rectangle rect) {
+    const Vector2 tl{rect.x, rect.y};
+    const Vector2 tr{rect.x + rect.width, rect.y};
+    const Vector2 bl{rect.x, rect.y + rect.height};
+    const Vector2 br{rect.x + rect.width, rect.y + rect.height};
+    add_triangle(tl, bl, tr);
+    add_triangle(tr, bl, br);
+}
+
+void TriangleList::draw(Vector2 offset, Color color) const {
+    if (vertices_.empty()) {
+        return;
+    }
+
+    rlCheckRenderBatchLimit(static_cast<int>(vertices_.size()));
+    rlBegin(RL_TRIANGLES);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    for (const Vector2& vertex : vertices_) {
+        rlVertex2f(vertex.x + offset.x, vertex.y + offset.y);
+    }
+    rlEnd();
+    DrawStats::record(vertices_.size(), DrawStats::kShapesTexture);
+}
+
+}  // namespace udjourney
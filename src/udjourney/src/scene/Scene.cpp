@@ -13,6 +13,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <udj-core/CoreUtils.hpp>
 #include <udj-core/Logger.hpp>
 
 using json = nlohmann::json;
@@ -71,13 +72,13 @@ void load_level_platforms_(const json& scene_data,
             }
 
             // Load features
-            Logger::info("Processing features for platform at tile (%, %)",
-                         platform.tile_x,
-                         platform.tile_y);
+            Logger::debug("Processing features for platform at tile (%, %)",
+                          platform.tile_x,
+                          platform.tile_y);
             if (platform_json.contains("features")) {
                 for (const auto& feature_str : platform_json["features"]) {
                     if (feature_str == "spikes") {
-                        Logger::info(
+                        Logger::debug(
                             "Loading spikes feature for platform at tile "
                             "(%, %)",
                             platform.tile_x,
@@ -85,7 +86,7 @@ void load_level_platforms_(const json& scene_data,
                         platform.features.push_back(
                             PlatformFeatureType::Spikes);
                     } else if (feature_str == "downward_spikes") {
-                        Logger::info(
+                        Logger::debug(
                             "Loading downward spikes feature for platform at "
                             "tile "
                             "(%, %)",
@@ -94,7 +95,7 @@ void load_level_platforms_(const json& scene_data,
                         platform.features.push_back(
                             PlatformFeatureType::DownwardSpikes);
                     } else if (feature_str == "checkpoint") {
-                        Logger::info(
+                        Logger::debug(
                             "Loading checkpoint feature for platform at "
                             "tile (%, %)",
                             platform.tile_x,
@@ -295,10 +296,23 @@ void load_fuds_(const json& scene_data, std::vector<scene::HUDData>& huds) {
     }
 }
 
+bool ends_with_(const std::string& value, const std::string& suffix) {
+    return value.size() >= suffix.size() &&
+           value.compare(
+               value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
 }  // namespace
 
 Scene::Scene(const std::string& filename) { load_from_file(filename); }
 
+std::string Scene::compiled_path_for(const std::string& scene_file) {
+    if (ends_with_(scene_file, ".json")) {
+        return scene_file.substr(0, scene_file.size() - 5) + ".udl";
+    }
+    return scene_file + ".udl";
+}
+
 Rectangle Scene::tile_to_world_rect(float tile_x, float tile_y,
                                     float width_tiles, float height_tiles) {
     // Platform is centered on the tile position
@@ -318,6 +332,21 @@ Vector2 Scene::tile_to_world_pos(float tile_x, float tile_y) {
 }
 
 bool Scene::load_from_file(const std::string& filename) {
+    if (ends_with_(filename, ".udl")) {
+        return load_from_binary(filename);
+    }
+
+    // Written by the level compiler and the editor export; a JSON edited
+    // since then wins
+    const std::string compiled = compiled_path_for(filename);
+    if (udj::core::filesystem::is_up_to_date(compiled, {filename}) &&
+        load_from_binary(compiled)) {
+        return true;
+    }
+    return load_from_json(filename);
+}
+
+bool Scene::load_from_json(const std::string& filename) {
     Logger::info("Loading scene from file: %", filename);
     try {
         std::ifstream file(filename);
@@ -0,0 +1,292 @@
+// Copyright 2025 Quentin Cartier
+
+#include "udjourney/scene/SceneAssetManifest.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Include Dreamcast compatibility functions before nlohmann/json
+#ifdef PLATFORM_DREAMCAST
+#include "udjourney/dreamcast_json_compat.h"
+#endif
+
+#include <nlohmann/json.hpp>
+
+#include <udj-core/CoreUtils.hpp>
+#include <udj-core/Logger.hpp>
+
+using json = nlohmann::json;
+
+namespace udjourney {
+namespace scene {
+
+namespace {
+
+// Files every gameplay level loads for the player (see Game::create_player)
+constexpr const char* kPlayerAnimations = "player_animations.json";
+constexpr const char* kProjectilePresets = "projectiles.json";
+// Loaded by Game::init for bursts and emitters
+constexpr const char* kParticlePresets = "particles.json";
+// MonsterFactory's fallback when a preset names no animation file
+constexpr const char* kDefaultMonsterAnimations = "monster_animations.json";
+
+// Parse an asset-relative JSON file; false (and a warning) if unusable
+bool read_asset_json(const std::string& relative_path, json& out) {
+    const std::string full_path =
+        udjourney::coreutils::get_assets_path(relative_path);
+    std::ifstream file(full_path);
+    if (!file.is_open()) {
+        udj::core::Logger::warning("SceneAssetManifest: cannot open %",
+                                   full_path);
+        return false;
+    }
+    try {
+        file >> out;
+    } catch (const json::parse_error& e) {
+        udj::core::Logger::warning(
+            "SceneAssetManifest: cannot parse %: %", full_path, e.what());
+        return false;
+    }
+    return true;
+}
+
+std::string string_or_empty(const json& object, const char* key) {
+    const auto it = object.find(key);
+    return (it != object.end() && it->is_string()) ? it->get<std::string>()
+                                                   : std::string{};
+}
+
+}  // namespace
+
+SceneAssetManifest SceneAssetManifest::collect(const Scene& scene) {
+    SceneAssetManifest manifest;
+
+    for (const auto& platform : scene.get_platforms()) {
+        manifest.add_texture(platform.texture_file);
+    }
+
+    for (const auto& layer : scene.get_background_layers()) {
+        for (const auto& object : layer.objects) {
+            manifest.add_texture(object.sprite_sheet);
+        }
+    }
+
+    for (const auto& hud : scene.get_huds()) {
+        manifest.add_hud_(hud);
+    }
+
+    if (scene.get_type() == SceneType::Level) {
+        for (const auto& spawn : scene.get_monster_spawns()) {
+            manifest.add_monster_preset_(spawn.preset_name);
+        }
+        manifest.add_animation_preset_(kPlayerAnimations);
+        manifest.add_projectile_presets_(kProjectilePresets);
+        manifest.add_particle_presets_(kParticlePresets);
+    }
+
+    return manifest;
+}
+
+std::string SceneAssetManifest::cache_path_for(const std::string& scene_file) {
+    const std::string kExtension = ".json";
+    if (scene_file.size() >= kExtension.size() &&
+        scene_file.compare(scene_file.size() - kExtension.size(),
+                           kExtension.size(),
+                           kExtension) == 0) {
+        return scene_file.substr(0, scene_file.size() - kExtension.size()) +
+               ".assets";
+    }
+    return scene_file + ".assets";
+}
+
+bool SceneAssetManifest::load_from_file(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    try {
+        json j;
+        file >> j;
+        const auto it = j.find("textures");
+        if (it == j.end() || !it->is_array()) {
+            udj::core::Logger::warning(
+                "SceneAssetManifest: no 'textures' array in %", filename);
+            return false;
+        }
+
+        m_textures.clear();
+        for (const auto& path : *it) {
+            if (path.is_string()) {
+                add_texture(path.get<std::string>());
+            }
+        }
+    } catch (const json::exception& e) {
+        udj::core::Logger::warning(
+            "SceneAssetManifest: cannot parse %: %", filename, e.what());
+        return false;
+    }
+    return true;
+}
+
+bool SceneAssetManifest::load_cache_for(const std::string& scene_file) {
+    const std::string cache_file = cache_path_for(scene_file);
+    // A level edited since the cache was written wins
+    return udjourney::coreutils::is_up_to_date(cache_file, {scene_file}) &&
+           load_from_file(cache_file);
+}
+
+bool SceneAssetManifest::save_to_file(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        udj::core::Logger::error("SceneAssetManifest: cannot write %",
+                                 filename);
+        return false;
+    }
+
+    json j;
+    j["textures"] = m_textures;
+    file << j.dump(2);
+    return true;
+}
+
+void SceneAssetManifest::add_texture(const std::string& path) {
+    if (path.empty()) {
+        return;
+    }
+    auto it = std::lower_bound(m_textures.begin(), m_textures.end(), path);
+    if (it == m_textures.end() || *it != path) {
+        m_textures.insert(it, path);
+    }
+}
+
+void SceneAssetManifest::add_animation_preset_(
+    const std::string& animation_file) {
+    json j;
+    if (!read_asset_json("animations/" + animation_file, j)) {
+        return;
+    }
+
+    const auto animations = j.find("animations");
+    if (animations == j.end() || !animations->is_array()) {
+        return;
+    }
+    for (const auto& animation : *animations) {
+        const auto sprite = animation.find("sprite_config");
+        if (sprite != animation.end() && sprite->is_object()) {
+            add_texture(string_or_empty(*sprite, "filename"));
+        }
+    }
+}
+
+void SceneAssetManifest::add_monster_preset_(const std::string& preset_name) {
+    if (preset_name.empty()) {
+        return;
+    }
+
+    json j;
+    if (!read_asset_json("monsters/" + preset_name + ".json", j)) {
+        return;
+    }
+
+    std::string animation_file = string_or_empty(j, "animation_preset");
+    if (animation_file.empty()) {
+        animation_file = kDefaultMonsterAnimations;
+    }
+    add_animation_preset_(animation_file);
+}
+
+void SceneAssetManifest::add_hud_(const HUDData& hud) {
+    add_texture(hud.background_sheet);
+    add_texture(hud.foreground_sheet);
+
+    // Sprite overrides are JSON objects stored as strings
+    for (const auto& [key, value] : hud.properties) {
+        if (value.empty() || value.front() != '{') {
+            continue;
+        }
+        const json sprite = json::parse(value, nullptr, false);
+        if (sprite.is_object()) {
+            add_texture(string_or_empty(sprite, "sheet"));
+        }
+    }
+
+    // WeaponHUD previews the projectile textures (see UiFactory)
+    if (hud.type_id == "weapon_display") {
+        add_projectile_presets_(kProjectilePresets);
+    }
+
+    // Defaults the HUD type falls back to (huds/<type_id>.json)
+    if (hud.type_id.empty()) {
+        return;
+    }
+    const std::string type_file = "huds/" + hud.type_id + ".json";
+    if (!udjourney::coreutils::file_exists(
+            udjourney::coreutils::get_assets_path(type_file))) {
+        return;
+    }
+    json type_json;
+    if (!read_asset_json(type_file, type_json)) {
+        return;
+    }
+    const auto schema = type_json.find("properties_schema");
+    if (schema == type_json.end() || !schema->is_object()) {
+        return;
+    }
+    for (const auto& item : schema->items()) {
+        const json& property = item.value();
+        const auto def = property.find("default");
+        if (def != property.end() && def->is_object()) {
+            add_texture(string_or_empty(*def, "sheet"));
+        }
+    }
+}
+
+void SceneAssetManifest::add_projectile_presets_(
+    const std::string& config_file) {
+    json j;
+    if (!read_asset_json(config_file, j)) {
+        return;
+    }
+
+    const auto projectiles = j.find("projectiles");
+    if (projectiles == j.end() || !projectiles->is_array()) {
+        return;
+    }
+    for (const auto& projectile : *projectiles) {
+        add_texture(string_or_empty(projectile, "texture_file"));
+    }
+}
+
+void SceneAssetManifest::add_particle_presets_(const std::string& config_file) {
+    json j;
+    if (!read_asset_json(config_file, j)) {
+        return;
+    }
+
+    const auto particles = j.find("particles");
+    if (particles == j.end() || !particles->is_array()) {
+        return;
+    }
+    for (const auto& particle : *particles) {
+        add_texture(string_or_empty(particle, "texture_file"));
+
+        // Baked presets draw a flipbook (see ParticlePresetLoader defaults)
+        const auto bake = particle.find("bake");
+        if (bake == particle.end() || !bake->is_boolean() ||
+            !bake->get<bool>()) {
+            continue;
+        }
+        std::string sheet = string_or_empty(particle, "bake_sheet");
+        if (sheet.empty()) {
+            sheet = "particles/baked/" + string_or_empty(particle, "name") +
+                    ".png";
+        }
+        add_texture(sheet);
+    }
+}
+
+}  // namespace scene
+}  // namespace udjourney
@@ -0,0 +1,562 @@
+// Copyright 2025 Quentin Cartier
+//
+// Compiled level format (.udl), written by udj-level-compiler and by the
+// editor's export.
+//
+// Layout: a fixed Header, then one array of fixed-size records per section
+// and a string table. Records refer to strings by (offset, length) and to
+// their children (platform params, layer objects, HUD properties, menu
+// params) by (first, count) ranges, so loading is a bounds check and a
+// straight copy per record. Records are stored in native layout; both
+// targets (x86-64 host, SH-4) are little-endian with the same alignment.
+//
+// Bump kVersion whenever a record changes. A stale file is rejected and
+// Scene::load_from_file falls back to the JSON.
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <udj-core/BinaryTable.hpp>
+#include <udj-core/Logger.hpp>
+#include <udj-core/MappedFile.hpp>
+
+#include "udjourney/scene/Scene.hpp"
+
+namespace udjourney {
+namespace scene {
+
+namespace {
+
+constexpr char kMagic[4] = {'U', 'D', 'L', '1'};
+constexpr uint32_t kVersion = 1;
+
+using udj::core::binary::Section;
+using udj::core::binary::StrRef;
+
+enum SectionId : uint32_t {
+    kPlatforms,
+    kParams,
+    kMonsters,
+    kLayers,
+    kObjects,
+    kHuds,
+    kProperties,
+    kMenuItems,
+    kMenuParams,
+    kStrings,
+    kSectionCount
+};
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t file_size;
+    uint32_t scene_type;
+    float scroll_speed;
+    float gravity;
+    float terminal_velocity;
+    int32_t spawn_x;
+    int32_t spawn_y;
+    StrRef name;
+    StrRef menu_title;
+    float menu_rect[4];
+    Section sections[kSectionCount];
+};
+
+struct PlatformRecord {
+    float tile_x;
+    float tile_y;
+    float width_tiles;
+    float height_tiles;
+    float source_rect[4];
+    StrRef texture_file;
+    uint32_t first_param;  // Behavior params, then feature params
+    uint16_t behavior_param_count;
+    uint16_t feature_param_count;
+    uint8_t color[4];
+    uint8_t behavior_type;
+    uint8_t feature_mask;  // Bit n set: PlatformFeatureType n present
+    uint8_t texture_tiled;
+    uint8_t use_atlas;
+};
+
+struct ParamRecord {
+    StrRef key;
+    float value;
+};
+
+struct MonsterRecord {
+    int32_t tile_x;
+    int32_t tile_y;
+    float patrol_range;
+    float chase_range;
+    float attack_range;
+    StrRef preset_name;
+    StrRef sprite_sheet;
+    StrRef animation_config;
+};
+
+struct LayerRecord {
+    StrRef name;
+    StrRef texture_file;
+    float parallax_factor;
+    int32_t depth;
+    float scroll_speed_x;
+    float scroll_speed_y;
+    uint32_t first_object;
+    uint32_t object_count;
+    uint8_t auto_scroll_enabled;
+    uint8_t repeat;
+    uint8_t reserved[2];
+};
+
+struct ObjectRecord {
+    StrRef sprite_name;
+    StrRef sprite_sheet;
+    float x;
+    float y;
+    float scale;
+    float rotation;
+    int32_t tile_size;
+    int32_t tile_row;
+    int32_t tile_col;
+};
+
+// size, row, col, width, height of a HUD sprite
+struct HudSpriteRecord {
+    StrRef sheet;
+    int32_t tile[5];
+};
+
+struct HudRecord {
+    StrRef name;
+    StrRef type_id;
+    uint32_t anchor;
+    float offset_x;
+    float offset_y;
+    float size_x;
+    float size_y;
+    float image_scale;
+    HudSpriteRecord background;
+    HudSpriteRecord foreground;
+    uint32_t first_property;
+    uint32_t property_count;
+    uint32_t visible;
+};
+
+struct PropertyRecord {
+    StrRef key;
+    StrRef value;
+};
+
+struct MenuItemRecord {
+    StrRef label;
+    StrRef action;
+    uint32_t first_param;
+    uint32_t param_count;
+};
+
+constexpr std::array<size_t, kSectionCount> kRecordSizes = {
+    sizeof(PlatformRecord),
+    sizeof(ParamRecord),
+    sizeof(MonsterRecord),
+    sizeof(LayerRecord),
+    sizeof(ObjectRecord),
+    sizeof(HudRecord),
+    sizeof(PropertyRecord),
+    sizeof(MenuItemRecord),
+    sizeof(StrRef),
+    1,
+};
+
+// Sections stay 4-byte aligned and records copy as plain bytes
+static_assert(sizeof(Header) % 4 == 0);
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(std::is_trivially_copyable_v<PlatformRecord> &&
+              std::is_trivially_copyable_v<HudRecord>);
+static_assert(sizeof(PlatformRecord) % 4 == 0 &&
+              sizeof(LayerRecord) % 4 == 0 && sizeof(HudRecord) % 4 == 0);
+
+using Writer = udj::core::binary::TableWriter<kSectionCount>;
+using Reader = udj::core::binary::TableReader<kSectionCount>;
+
+HudSpriteRecord make_sprite(Writer* writer, const std::string& sheet,
+                            int size, int row, int col, int width,
+                            int height) {
+    return HudSpriteRecord{writer->intern(sheet),
+                           {size, row, col, width, height}};
+}
+
+}  // namespace
+
+bool Scene::save_to_binary(const std::string& filename) const {
+    Writer writer;
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.scene_type = static_cast<uint32_t>(m_scene_type);
+    header.scroll_speed = m_scroll_speed;
+    header.gravity = m_physics_config.gravity;
+    header.terminal_velocity = m_physics_config.terminal_velocity;
+    header.spawn_x = m_player_spawn.tile_x;
+    header.spawn_y = m_player_spawn.tile_y;
+    header.name = writer.intern(m_name);
+    header.menu_title = writer.intern(m_game_menu.title);
+    header.menu_rect[0] = m_game_menu.rect.x;
+    header.menu_rect[1] = m_game_menu.rect.y;
+    header.menu_rect[2] = m_game_menu.rect.width;
+    header.menu_rect[3] = m_game_menu.rect.height;
+
+    for (const auto& platform : m_platforms) {
+        PlatformRecord record{};
+        record.tile_x = platform.tile_x;
+        record.tile_y = platform.tile_y;
+        record.width_tiles = platform.width_tiles;
+        record.height_tiles = platform.height_tiles;
+        record.source_rect[0] = platform.source_rect.x;
+        record.source_rect[1] = platform.source_rect.y;
+        record.source_rect[2] = platform.source_rect.width;
+        record.source_rect[3] = platform.source_rect.height;
+        record.texture_file = writer.intern(platform.texture_file);
+        record.first_param = writer.count(kParams);
+        record.behavior_param_count =
+            static_cast<uint16_t>(platform.behavior_params.size());
+        record.feature_param_count =
+            static_cast<uint16_t>(platform.feature_params.size());
+        record.color[0] = platform.color.r;
+        record.color[1] = platform.color.g;
+        record.color[2] = platform.color.b;
+        record.color[3] = platform.color.a;
+        record.behavior_type = static_cast<uint8_t>(platform.behavior_type);
+        for (auto feature : platform.features) {
+            record.feature_mask |=
+                static_cast<uint8_t>(1u << static_cast<unsigned>(feature));
+        }
+        record.texture_tiled = platform.texture_tiled ? 1 : 0;
+        record.use_atlas = platform.use_atlas ? 1 : 0;
+        writer.add(kPlatforms, record);
+
+        for (const auto& [key, value] : platform.behavior_params) {
+            writer.add(kParams, ParamRecord{writer.intern(key), value});
+        }
+        for (const auto& [key, value] : platform.feature_params) {
+            writer.add(kParams, ParamRecord{writer.intern(key), value});
+        }
+    }
+
+    for (const auto& monster : m_monster_spawns) {
+        writer.add(kMonsters,
+                   MonsterRecord{monster.tile_x,
+                                 monster.tile_y,
+                                 monster.patrol_range,
+                                 monster.chase_range,
+                                 monster.attack_range,
+                                 writer.intern(monster.preset_name),
+                                 writer.intern(monster.sprite_sheet),
+                                 writer.intern(monster.animation_config)});
+    }
+
+    for (const auto& layer : m_background_layers) {
+        LayerRecord record{};
+        record.name = writer.intern(layer.name);
+        record.texture_file = writer.intern(layer.texture_file);
+        record.parallax_factor = layer.parallax_factor;
+        record.depth = layer.depth;
+        record.scroll_speed_x = layer.scroll_speed_x;
+        record.scroll_speed_y = layer.scroll_speed_y;
+        record.first_object = writer.count(kObjects);
+        record.object_count = static_cast<uint32_t>(layer.objects.size());
+        record.auto_scroll_enabled = layer.auto_scroll_enabled ? 1 : 0;
+        record.repeat = layer.repeat ? 1 : 0;
+        writer.add(kLayers, record);
+
+        for (const auto& object : layer.objects) {
+            writer.add(kObjects,
+                       ObjectRecord{writer.intern(object.sprite_name),
+                                    writer.intern(object.sprite_sheet),
+                                    object.x,
+                                    object.y,
+                                    object.scale,
+                                    object.rotation,
+                                    object.tile_size,
+                                    object.tile_row,
+                                    object.tile_col});
+        }
+    }
+
+    for (const auto& hud : m_huds) {
+        HudRecord record{};
+        record.name = writer.intern(hud.name);
+        record.type_id = writer.intern(hud.type_id);
+        record.anchor = static_cast<uint32_t>(hud.anchor);
+        record.offset_x = hud.offset_x;
+        record.offset_y = hud.offset_y;
+        record.size_x = hud.size_x;
+        record.size_y = hud.size_y;
+        record.image_scale = hud.image_scale;
+        record.background = make_sprite(&writer,
+                                        hud.background_sheet,
+                                        hud.background_tile_size,
+                                        hud.background_tile_row,
+                                        hud.background_tile_col,
+                                        hud.background_tile_width,
+                                        hud.background_tile_height);
+        record.foreground = make_sprite(&writer,
+                                        hud.foreground_sheet,
+                                        hud.foreground_tile_size,
+                                        hud.foreground_tile_row,
+                                        hud.foreground_tile_col,
+                                        hud.foreground_tile_width,
+                                        hud.foreground_tile_height);
+        record.first_property = writer.count(kProperties);
+        record.property_count = static_cast<uint32_t>(hud.properties.size());
+        record.visible = hud.visible ? 1 : 0;
+        writer.add(kHuds, record);
+
+        for (const auto& [key, value] : hud.properties) {
+            writer.add(kProperties,
+                       PropertyRecord{writer.intern(key), writer.intern(value)});
+        }
+    }
+
+    for (const auto& item : m_game_menu.items) {
+        writer.add(kMenuItems,
+                   MenuItemRecord{writer.intern(item.label),
+                                  writer.intern(item.action),
+                                  writer.count(kMenuParams),
+                                  static_cast<uint32_t>(item.params.size())});
+        for (const auto& param : item.params) {
+            writer.add(kMenuParams, writer.intern(param));
+        }
+    }
+
+    std::vector<uint8_t> data = writer.finish(sizeof(Header), header.sections);
+    header.file_size = static_cast<uint32_t>(data.size());
+    std::memcpy(data.data(), &header, sizeof(header));
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open() ||
+        !file.write(reinterpret_cast<const char*>(data.data()),
+                    static_cast<std::streamsize>(data.size()))) {
+        Logger::error("Failed to write compiled scene: %", filename);
+        return false;
+    }
+    return true;
+}
+
+bool Scene::load_from_binary(const std::string& filename) {
+    udj::core::filesystem::MappedFile file(filename);
+    if (!file.is_open()) {
+        Logger::error("Failed to open compiled scene: %", filename);
+        return false;
+    }
+
+    Header header;
+    if (file.size() < sizeof(Header)) {
+        Logger::error("Compiled scene % is truncated", filename);
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion) {
+        Logger::warning("Compiled scene % has an unknown format or version",
+                        filename);
+        return false;
+    }
+    const Reader reader(
+        file.data(), file.size(), header.sections, kRecordSizes);
+    if (header.file_size != file.size() || !reader.fits(sizeof(Header))) {
+        Logger::error("Compiled scene % is corrupted", filename);
+        return false;
+    }
+
+    // Built aside, so a bad record leaves the scene untouched
+    std::vector<PlatformData> platforms;
+    platforms.reserve(reader.count(kPlatforms));
+    for (uint32_t i = 0; i < reader.count(kPlatforms); ++i) {
+        const auto record = reader.at<PlatformRecord>(kPlatforms, i);
+        const uint32_t param_count =
+            record.behavior_param_count + record.feature_param_count;
+        if (!reader.has_range(kParams, record.first_param, param_count)) {
+            Logger::error("Compiled scene % is corrupted", filename);
+            return false;
+        }
+
+        PlatformData& platform = platforms.emplace_back();
+        platform.tile_x = record.tile_x;
+        platform.tile_y = record.tile_y;
+        platform.width_tiles = record.width_tiles;
+        platform.height_tiles = record.height_tiles;
+        platform.behavior_type =
+            static_cast<PlatformBehaviorType>(record.behavior_type);
+        for (uint32_t p = 0; p < param_count; ++p) {
+            const auto param =
+                reader.at<ParamRecord>(kParams, record.first_param + p);
+            auto& params = p < record.behavior_param_count
+                               ? platform.behavior_params
+                               : platform.feature_params;
+            params.emplace(reader.str(param.key), param.value);
+        }
+        for (auto feature : {PlatformFeatureType::Spikes,
+                             PlatformFeatureType::DownwardSpikes,
+                             PlatformFeatureType::Checkpoint}) {
+            if (record.feature_mask & (1u << static_cast<unsigned>(feature))) {
+                platform.features.push_back(feature);
+            }
+        }
+        platform.color = Color{
+            record.color[0], record.color[1], record.color[2], record.color[3]};
+        platform.texture_file = reader.str(record.texture_file);
+        platform.texture_tiled = record.texture_tiled != 0;
+        platform.use_atlas = record.use_atlas != 0;
+        platform.source_rect = Rectangle{record.source_rect[0],
+                                         record.source_rect[1],
+                                         record.source_rect[2],
+                                         record.source_rect[3]};
+    }
+
+    std::vector<MonsterSpawnData> monsters;
+    monsters.reserve(reader.count(kMonsters));
+    for (uint32_t i = 0; i < reader.count(kMonsters); ++i) {
+        const auto record = reader.at<MonsterRecord>(kMonsters, i);
+        MonsterSpawnData& monster = monsters.emplace_back();
+        monster.tile_x = record.tile_x;
+        monster.tile_y = record.tile_y;
+        monster.preset_name = reader.str(record.preset_name);
+        monster.patrol_range = record.patrol_range;
+        monster.chase_range = record.chase_range;
+        monster.attack_range = record.attack_range;
+        monster.sprite_sheet = reader.str(record.sprite_sheet);
+        monster.animation_config = reader.str(record.animation_config);
+    }
+
+    std::vector<BackgroundLayerData> layers;
+    layers.reserve(reader.count(kLayers));
+    for (uint32_t i = 0; i < reader.count(kLayers); ++i) {
+        const auto record = reader.at<LayerRecord>(kLayers, i);
+        if (!reader.has_range(
+                kObjects, record.first_object, record.object_count)) {
+            Logger::error("Compiled scene % is corrupted", filename);
+            return false;
+        }
+
+        BackgroundLayerData& layer = layers.emplace_back();
+        layer.name = reader.str(record.name);
+        layer.texture_file = reader.str(record.texture_file);
+        layer.parallax_factor = record.parallax_factor;
+        layer.depth = record.depth;
+        layer.auto_scroll_enabled = record.auto_scroll_enabled != 0;
+        layer.scroll_speed_x = record.scroll_speed_x;
+        layer.scroll_speed_y = record.scroll_speed_y;
+        layer.repeat = record.repeat != 0;
+        layer.objects.reserve(record.object_count);
+        for (uint32_t o = 0; o < record.object_count; ++o) {
+            const auto object =
+                reader.at<ObjectRecord>(kObjects, record.first_object + o);
+            layer.objects.push_back(
+                BackgroundObjectData{reader.str(object.sprite_name),
+                                     object.x,
+                                     object.y,
+                                     object.scale,
+                                     object.rotation,
+                                     reader.str(object.sprite_sheet),
+                                     object.tile_size,
+                                     object.tile_row,
+                                     object.tile_col});
+        }
+    }
+
+    std::vector<HUDData> huds;
+    huds.reserve(reader.count(kHuds));
+    for (uint32_t i = 0; i < reader.count(kHuds); ++i) {
+        const auto record = reader.at<HudRecord>(kHuds, i);
+        if (!reader.has_range(
+                kProperties, record.first_property, record.property_count)) {
+            Logger::error("Compiled scene % is corrupted", filename);
+            return false;
+        }
+
+        HUDData& hud = huds.emplace_back();
+        hud.name = reader.str(record.name);
+        hud.type_id = reader.str(record.type_id);
+        hud.anchor = static_cast<HUDAnchor>(record.anchor);
+        hud.offset_x = record.offset_x;
+        hud.offset_y = record.offset_y;
+        hud.size_x = record.size_x;
+        hud.size_y = record.size_y;
+        hud.visible = record.visible != 0;
+        hud.image_scale = record.image_scale;
+
+        hud.background_sheet = reader.str(record.background.sheet);
+        hud.background_tile_size = record.background.tile[0];
+        hud.background_tile_row = record.background.tile[1];
+        hud.background_tile_col = record.background.tile[2];
+        hud.background_tile_width = record.background.tile[3];
+        hud.background_tile_height = record.background.tile[4];
+
+        hud.foreground_sheet = reader.str(record.foreground.sheet);
+        hud.foreground_tile_size = record.foreground.tile[0];
+        hud.foreground_tile_row = record.foreground.tile[1];
+        hud.foreground_tile_col = record.foreground.tile[2];
+        hud.foreground_tile_width = record.foreground.tile[3];
+        hud.foreground_tile_height = record.foreground.tile[4];
+
+        for (uint32_t p = 0; p < record.property_count; ++p) {
+            const auto property = reader.at<PropertyRecord>(
+                kProperties, record.first_property + p);
+            hud.properties.emplace(reader.str(property.key),
+                                   reader.str(property.value));
+        }
+    }
+
+    GameMenuData menu;
+    menu.title = reader.str(header.menu_title);
+    menu.rect = Rectangle{header.menu_rect[0],
+                          header.menu_rect[1],
+                          header.menu_rect[2],
+                          header.menu_rect[3]};
+    menu.items.reserve(reader.count(kMenuItems));
+    for (uint32_t i = 0; i < reader.count(kMenuItems); ++i) {
+        const auto record = reader.at<MenuItemRecord>(kMenuItems, i);
+        if (!reader.has_range(
+                kMenuParams, record.first_param, record.param_count)) {
+            Logger::error("Compiled scene % is corrupted", filename);
+            return false;
+        }
+
+        MenuItemData& item = menu.items.emplace_back();
+        item.label = reader.str(record.label);
+        item.action = reader.str(record.action);
+        item.params.reserve(record.param_count);
+        for (uint32_t p = 0; p < record.param_count; ++p) {
+            item.params.push_back(reader.str(
+                reader.at<StrRef>(kMenuParams, record.first_param + p)));
+        }
+    }
+
+    m_name = reader.str(header.name);
+    m_scene_type = static_cast<SceneType>(header.scene_type);
+    m_scroll_speed = header.scroll_speed;
+    m_physics_config.gravity = header.gravity;
+    m_physics_config.terminal_velocity = header.terminal_velocity;
+    m_player_spawn = PlayerSpawnData{header.spawn_x, header.spawn_y};
+    m_platforms = std::move(platforms);
+    m_monster_spawns = std::move(monsters);
+    m_background_layers = std::move(layers);
+    m_huds = std::move(huds);
+    m_game_menu = std::move(menu);
+
+    Logger::info("Loaded compiled scene % (% platforms, % monsters)",
+                 filename,
+                 m_platforms.size(),
+                 m_monster_spawns.size());
+    return true;
+}
+
+}  // namespace scene
+}  // namespace udjourney
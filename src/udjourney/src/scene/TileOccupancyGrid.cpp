@@ -0,0 +1,120 @@
+// Copyright 2025 Quentin Cartier
+#include "udjourney/scene/TileOccupancyGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "udjourney/scene/Scene.hpp"
+
+namespace udjourney::scene {
+
+void TileOccupancyGrid::build(const Scene& scene) {
+    clear();
+
+    std::vector<Rectangle> solids;
+    for (const auto& platform : scene.get_platforms()) {
+        // Moving platforms are resolved by their actors, not by the grid
+        if (platform.behavior_type != PlatformBehaviorType::Static) continue;
+        solids.push_back(Scene::tile_to_world_rect(platform.tile_x,
+                                                   platform.tile_y,
+                                                   platform.width_tiles,
+                                                   platform.height_tiles));
+    }
+    if (solids.empty()) {
+        return;
+    }
+
+    float min_x = solids.front().x;
+    float min_y = solids.front().y;
+    float max_x = min_x;
+    float max_y = min_y;
+    for (const auto& rect : solids) {
+        min_x = std::min(min_x, rect.x);
+        min_y = std::min(min_y, rect.y);
+        max_x = std::max(max_x, rect.x + rect.width);
+        max_y = std::max(max_y, rect.y + rect.height);
+    }
+
+    reset(Rectangle{min_x, min_y, max_x - min_x, max_y - min_y});
+    for (const auto& rect : solids) {
+        fill_rect(rect);
+    }
+}
+
+void TileOccupancyGrid::reset(const Rectangle& world_area) {
+    origin_x_ = std::floor(world_area.x / kCellSize) * kCellSize;
+    origin_y_ = std::floor(world_area.y / kCellSize) * kCellSize;
+    cols_ = std::max(
+        1,
+        static_cast<int>(std::ceil(
+            (world_area.x + world_area.width - origin_x_) / kCellSize)));
+    rows_ = std::max(
+        1,
+        static_cast<int>(std::ceil(
+            (world_area.y + world_area.height - origin_y_) / kCellSize)));
+    bits_.assign((static_cast<size_t>(cols_) * rows_ + 31) / 32, 0u);
+}
+
+bool TileOccupancyGrid::cell_range_(const Rectangle& world_rect, int& x0,
+                                     int& y0, int& x1, int& y1) const {
+    if (bits_.empty() || world_rect.width <= 0.0f ||
+        world_rect.height <= 0.0f) {
+        return false;
+    }
+
+    x0 = std::clamp(
+        static_cast<int>(std::floor((world_rect.x - origin_x_) / kCellSize)),
+        0,
+        cols_ - 1);
+    y0 = std::clamp(
+        static_cast<int>(std::floor((world_rect.y - origin_y_) / kCellSize)),
+        0,
+        rows_ - 1);
+    x1 = std::clamp(
+        static_cast<int>(std::ceil(
+            (world_rect.x + world_rect.width - origin_x_) / kCellSize)),
+        x0 + 1,
+        cols_);
+    y1 = std::clamp(
+        static_cast<int>(std::ceil(
+            (world_rect.y + world_rect.height - origin_y_) / kCellSize)),
+        y0 + 1,
+        rows_);
+    return true;
+}
+
+void TileOccupancyGrid::fill_rect(const Rectangle& world_rect) {
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    if (!cell_range_(world_rect, x0, y0, x1, y1)) {
+        return;
+    }
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            const int index = y * cols_ + x;
+            bits_[index >> 5] |= 1u << (index & 31);
+        }
+    }
+}
+
+void TileOccupancyGrid::clear_rect(const Rectangle& world_rect) {
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    if (!cell_range_(world_rect, x0, y0, x1, y1)) {
+        return;
+    }
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            const int index = y * cols_ + x;
+            bits_[index >> 5] &= ~(1u << (index & 31));
+        }
+    }
+}
+
+void TileOccupancyGrid::clear() {
+    origin_x_ = 0.0f;
+    origin_y_ = 0.0f;
+    cols_ = 0;
+    rows_ = 0;
+    bits_.clear();
+}
+
+}  // namespace udjourney::scene
@@ -9,6 +9,7 @@
 #include "udjourney/ActionDispatcher.hpp"
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/managers/TextureManager.hpp"
+#include "udjourney/render/Draw.hpp"
 namespace udjourney {
 
 // Helper function to parse color from JSON array string
@@ -165,18 +166,18 @@ void ButtonWidget::draw() const {
             }
 
             // Draw stretched texture to fill button rect
-            DrawTexturePro(current_texture,
-                           source_rect,
-                           screen_rect,
-                           Vector2{0, 0},
-                           0.0f,
-                           WHITE);
+            draw::texture_pro(current_texture,
+                              source_rect,
+                              screen_rect,
+                              Vector2{0, 0},
+                              0.0f,
+                              WHITE);
         } else {
             // Fallback: draw colored rectangle if texture not loaded
-            DrawRectangleRec(screen_rect, bg_color_);
-            DrawRectangleLinesEx(screen_rect,
-                                 static_cast<float>(border_thickness_),
-                                 normal_color_);
+            draw::rectangle_rec(screen_rect, bg_color_);
+            draw::rectangle_lines_ex(screen_rect,
+                                     static_cast<float>(border_thickness_),
+                                     normal_color_);
         }
     } else {
         // Draw classic colored button
@@ -191,12 +192,12 @@ void ButtonWidget::draw() const {
         }
 
         // Draw background
-        DrawRectangleRec(screen_rect, bg_color_);
+        draw::rectangle_rec(screen_rect, bg_color_);
 
         // Draw border (thicker if focused)
         int border_width =
             is_focused_ ? border_thickness_ * 2 : border_thickness_;
-        DrawRectangleLinesEx(
+        draw::rectangle_lines_ex(
             screen_rect, static_cast<float>(border_width), border_color);
     }
 
@@ -210,13 +211,18 @@ void ButtonWidget::draw() const {
         text_color = hover_color_;
     }
 
-    int text_width = MeasureText(text_.c_str(), font_size_);
+    int text_width = draw::measure_text(text_.c_str(), font_size_);
     int text_x =
         static_cast<int>(screen_rect.x + (screen_rect.width - text_width) / 2);
     int text_y =
         static_cast<int>(screen_rect.y + (screen_rect.height - font_size_) / 2);
 
-    DrawText(text_.c_str(), text_x, text_y, font_size_, text_color);
+    draw::text(text_.c_str(),
+               text_x,
+               text_y,
+               font_size_,
+               text_color,
+               get_game().get_sprite_batch());
 }
 
 void ButtonWidget::update(float delta) {
@@ -249,6 +255,10 @@ bool ButtonWidget::contains_point(Vector2 point) const {
     return CheckCollisionPointRec(point, rect_);
 }
 
+ButtonWidget::~ButtonWidget() {
+    TextureManager::get_instance().release(sheet_handle_);
+}
+
 void ButtonWidget::load_button_textures(const udjourney::scene::HUDData& hud) {
     auto& texture_manager = TextureManager::get_instance();
 
@@ -268,8 +278,11 @@ void ButtonWidget::load_button_textures(const udjourney::scene::HUDData& hud) {
     if (!hud.background_sheet.empty()) {
         sprite_sheet_path_ = hud.background_sheet;
 
-        // Load the sheet texture
-        idle_texture_ = texture_manager.get_texture(hud.background_sheet);
+        // Load the sheet texture (its atlas page if the sheet is packed)
+        const TextureRegion region =
+            texture_manager.get_region(hud.background_sheet);
+        sheet_handle_ = region.handle;
+        idle_texture_ = texture_manager.acquire(sheet_handle_);
         hover_texture_ =
             idle_texture_;  // Share texture, different source rects
         focused_texture_ = idle_texture_;
@@ -333,6 +346,13 @@ void ButtonWidget::load_button_textures(const udjourney::scene::HUDData& hud) {
                 pressed_source_rect_ = hover_source_rect_;  // Fallback to hover
             }
 
+            for (Rectangle* rect : {&idle_source_rect_,
+                                    &hover_source_rect_,
+                                    &focused_source_rect_,
+                                    &pressed_source_rect_}) {
+                *rect = region.map_or_sheet(*rect);
+            }
+
             udj::core::Logger::debug("Button '%' loaded texture from sheet: %",
                                      text_,
                                      hud.background_sheet);
@@ -8,6 +8,7 @@
 #include "udjourney/ActionDispatcher.hpp"
 #include "udjourney/interfaces/IGame.hpp"
 #include "udjourney/LevelMetadata.hpp"
+#include "udjourney/render/Draw.hpp"
 #include <udj-core/Logger.hpp>
 namespace udjourney {
 ScrollableListWidget::ScrollableListWidget(
@@ -243,16 +244,17 @@ void ScrollableListWidget::draw() const {
         Rectangle screen_rect = rect_;
 
         // Draw background
-        DrawRectangleRec(screen_rect, bg_color_);
-        DrawRectangleLinesEx(
+        draw::rectangle_rec(screen_rect, bg_color_);
+        draw::rectangle_lines_ex(
             screen_rect, static_cast<float>(border_thickness_), border_color_);
 
         if (items_.empty()) {
-            DrawText("No levels available",
-                     static_cast<int>(screen_rect.x + padding_),
-                     static_cast<int>(screen_rect.y + padding_ + 20),
-                     font_size_,
-                     WHITE);
+            draw::text("No levels available",
+                       static_cast<int>(screen_rect.x + padding_),
+                       static_cast<int>(screen_rect.y + padding_ + 20),
+                       font_size_,
+                       WHITE,
+                       get_game().get_sprite_batch());
             return;
         }
 
@@ -318,7 +320,7 @@ void ScrollableListWidget::draw() const {
                                    8,
                                    scrollbar_height};
 
-            DrawRectangleRec(scrollbar, ColorAlpha(WHITE, 0.5f));
+            draw::rectangle_rec(scrollbar, ColorAlpha(WHITE, 0.5f));
         }
     } catch (const std::exception& e) {
         udjourney::Logger::error("Exception in ScrollableListWidget::draw(): %",
@@ -329,6 +331,7 @@ void ScrollableListWidget::draw() const {
 void ScrollableListWidget::draw_list_item(const ListItem& item,
                                           Rectangle item_rect, bool is_selected,
                                           bool is_hovered) const {
+    SpriteBatch* batch = get_game().get_sprite_batch();
     Color bg = ColorAlpha(BLACK, 0.0f);
     Color text_color = item.text_color;
 
@@ -342,35 +345,38 @@ void ScrollableListWidget::draw_list_item(const ListItem& item,
     }
 
     // Draw item background
-    DrawRectangleRec(item_rect, bg);
+    draw::rectangle_rec(item_rect, bg);
 
     if (is_selected) {
-        DrawRectangleLinesEx(item_rect, 2.0f, selected_color_);
+        draw::rectangle_lines_ex(item_rect, 2.0f, selected_color_);
     }
 
     // Draw main text
-    DrawText(item.display_text.c_str(),
-             static_cast<int>(item_rect.x + padding_),
-             static_cast<int>(item_rect.y + padding_),
-             font_size_,
-             text_color);
+    draw::text(item.display_text.c_str(),
+               static_cast<int>(item_rect.x + padding_),
+               static_cast<int>(item_rect.y + padding_),
+               font_size_,
+               text_color,
+               batch);
 
     // Draw subtitle if present
     if (!item.subtitle.empty()) {
-        DrawText(item.subtitle.c_str(),
-                 static_cast<int>(item_rect.x + padding_),
-                 static_cast<int>(item_rect.y + padding_ + font_size_ + 5),
-                 subtitle_font_size_,
-                 ColorAlpha(text_color, 0.7f));
+        draw::text(item.subtitle.c_str(),
+                   static_cast<int>(item_rect.x + padding_),
+                   static_cast<int>(item_rect.y + padding_ + font_size_ + 5),
+                   subtitle_font_size_,
+                   ColorAlpha(text_color, 0.7f),
+                   batch);
     }
 
     // Draw lock icon if locked
     if (item.locked) {
-        DrawText("[LOCKED]",
-                 static_cast<int>(item_rect.x + item_rect.width - 100),
-                 static_cast<int>(item_rect.y + padding_),
-                 16,
-                 locked_color_);
+        draw::text("[LOCKED]",
+                   static_cast<int>(item_rect.x + item_rect.width - 100),
+                   static_cast<int>(item_rect.y + padding_),
+                   16,
+                   locked_color_,
+                   batch);
     }
 }
 
@@ -378,8 +384,12 @@ void ScrollableListWidget::update(float delta) {
     // Smooth scroll animation
     if (std::abs(scroll_offset_ - scroll_animation_target_) > 1.0f) {
         float diff = scroll_animation_target_ - scroll_offset_;
-        scroll_offset_ +=
-            static_cast<int>(diff * scroll_animation_speed_ * delta);
+        int step = static_cast<int>(diff * scroll_animation_speed_ * delta);
+        // Always move at least a pixel so the animation settles on target
+        if (step == 0) {
+            step = diff > 0.0f ? 1 : -1;
+        }
+        scroll_offset_ += step;
     } else {
         scroll_offset_ = static_cast<int>(scroll_animation_target_);
     }
@@ -472,6 +482,7 @@ void ScrollableListWidget::on_focus() { is_focused_ = true; }
 void ScrollableListWidget::scroll_up() {
     if (selected_index_ > 0) {
         selected_index_--;
+        request_redraw();
 
         // Adjust scroll if selection goes above visible area
         int selected_y = selected_index_ * item_height_;
@@ -484,6 +495,7 @@ void ScrollableListWidget::scroll_up() {
 void ScrollableListWidget::scroll_down() {
     if (selected_index_ < static_cast<int>(items_.size()) - 1) {
         selected_index_++;
+        request_redraw();
 
         // Adjust scroll if selection goes below visible area
         int selected_y = (selected_index_ + 1) * item_height_;
@@ -499,6 +511,7 @@ void ScrollableListWidget::scroll_down() {
 void ScrollableListWidget::scroll_to(int index) {
     if (index >= 0 && index < static_cast<int>(items_.size())) {
         selected_index_ = index;
+        request_redraw();
 
         // Center the selected item
         int center_y = (index * item_height_) -
@@ -510,6 +523,7 @@ void ScrollableListWidget::scroll_to(int index) {
 
 void ScrollableListWidget::page_up() {
     selected_index_ = std::max(0, selected_index_ - visible_items_);
+    request_redraw();
     scroll_animation_target_ =
         static_cast<float>(selected_index_ * item_height_);
 }
@@ -517,6 +531,7 @@ void ScrollableListWidget::page_up() {
 void ScrollableListWidget::page_down() {
     selected_index_ = std::min(static_cast<int>(items_.size()) - 1,
                                selected_index_ + visible_items_);
+    request_redraw();
     int selected_y = (selected_index_ + 1) * item_height_;
     scroll_animation_target_ =
         static_cast<float>(selected_y - static_cast<int>(rect_.height));
@@ -534,6 +549,7 @@ void ScrollableListWidget::set_item_selected_callback(
 
 void ScrollableListWidget::refresh_data() {
     load_data_from_source(data_source_);
+    request_redraw();
 }
 
 const ScrollableListWidget::ListItem* ScrollableListWidget::get_selected_item()
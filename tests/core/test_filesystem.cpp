@@ -0,0 +1,38 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <udj-core/CoreUtils.hpp>
+
+using udj::core::filesystem::is_up_to_date;
+
+TEST(FileSystemTest, DerivedFileIsStaleOnceAnySourceIsNewer) {
+    const auto dir = std::filesystem::temp_directory_path();
+    const std::string derived = (dir / "udj_up_to_date.bin").string();
+    const std::string first = (dir / "udj_up_to_date_a.json").string();
+    const std::string second = (dir / "udj_up_to_date_b.json").string();
+    std::ofstream(derived) << "bin";
+    std::ofstream(first) << "{}";
+    std::ofstream(second) << "{}";
+
+    const auto now = std::filesystem::last_write_time(derived);
+    std::filesystem::last_write_time(first, now - std::chrono::hours(1));
+    std::filesystem::last_write_time(second, now);
+    // Same timestamp counts as up to date
+    EXPECT_TRUE(is_up_to_date(derived, {first, second}));
+
+    std::filesystem::last_write_time(second, now + std::chrono::hours(1));
+    EXPECT_FALSE(is_up_to_date(derived, {first, second}));
+
+    // Missing sources are ignored, a missing derived file is not
+    std::filesystem::remove(second);
+    EXPECT_TRUE(is_up_to_date(derived, {first, second}));
+    std::filesystem::remove(derived);
+    EXPECT_FALSE(is_up_to_date(derived, {first}));
+    std::filesystem::remove(first);
+}
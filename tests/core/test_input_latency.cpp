@@ -0,0 +1,64 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include "udjourney/InputLatency.hpp"
+
+using udjourney::InputLatency;
+
+TEST(InputLatencyTest, PresentClosesPendingInput) {
+    InputLatency latency;
+    latency.mark_present(1.0);
+    EXPECT_EQ(latency.get_sample_count(), 0u);
+
+    latency.mark_input(2.0);
+    EXPECT_TRUE(latency.has_pending());
+    latency.mark_present(2.016);
+
+    EXPECT_FALSE(latency.has_pending());
+    EXPECT_EQ(latency.get_sample_count(), 1u);
+    EXPECT_NEAR(latency.get_last_ms(), 16.0f, 0.01f);
+}
+
+TEST(InputLatencyTest, PressesInOneFrameKeepTheOldest) {
+    InputLatency latency;
+    latency.mark_input(1.000);
+    latency.mark_input(1.010);
+    latency.mark_present(1.030);
+
+    EXPECT_EQ(latency.get_sample_count(), 1u);
+    EXPECT_NEAR(latency.get_last_ms(), 30.0f, 0.01f);
+}
+
+TEST(InputLatencyTest, PercentilesUseNearestRank) {
+    InputLatency latency;
+    for (int i = 1; i <= 10; ++i) {
+        const double t = static_cast<double>(i);
+        latency.mark_input(t);
+        latency.mark_present(t + i * 0.001);  // i ms
+    }
+
+    EXPECT_NEAR(latency.get_percentile_ms(50.0f), 5.0f, 0.01f);
+    EXPECT_NEAR(latency.get_percentile_ms(95.0f), 10.0f, 0.01f);
+    EXPECT_NEAR(latency.get_percentile_ms(0.0f), 1.0f, 0.01f);
+}
+
+TEST(InputLatencyTest, KeepsOnlyTheLatestSamples) {
+    InputLatency latency;
+    // Old slow samples, then a full window of fast ones
+    for (size_t i = 0; i < 10; ++i) {
+        latency.mark_input(0.0);
+        latency.mark_present(0.1);
+    }
+    for (size_t i = 0; i < InputLatency::kSampleCount; ++i) {
+        latency.mark_input(1.0);
+        latency.mark_present(1.002);
+    }
+
+    EXPECT_EQ(latency.get_sample_count(), InputLatency::kSampleCount);
+    EXPECT_NEAR(latency.get_percentile_ms(100.0f), 2.0f, 0.01f);
+
+    latency.reset();
+    EXPECT_EQ(latency.get_sample_count(), 0u);
+    EXPECT_FLOAT_EQ(latency.get_percentile_ms(50.0f), 0.0f);
+}
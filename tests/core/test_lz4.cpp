@@ -0,0 +1,48 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <udj-core/Lz4.hpp>
+
+namespace lz4 = udj::core::lz4;
+
+TEST(Lz4Test, RoundTripsRepetitiveAndShortInputs) {
+    std::vector<uint8_t> input;
+    for (int i = 0; i < 4000; ++i) {
+        input.push_back(static_cast<uint8_t>((i / 7) % 5));
+    }
+
+    const std::vector<uint8_t> packed =
+        lz4::compress(input.data(), input.size());
+    EXPECT_LT(packed.size(), input.size() / 4);
+
+    std::vector<uint8_t> output(input.size());
+    ASSERT_TRUE(lz4::decompress(
+        packed.data(), packed.size(), output.data(), output.size()));
+    EXPECT_EQ(output, input);
+
+    const std::vector<uint8_t> tiny{1, 2, 3};
+    const std::vector<uint8_t> tiny_packed =
+        lz4::compress(tiny.data(), tiny.size());
+    std::vector<uint8_t> tiny_out(tiny.size());
+    ASSERT_TRUE(lz4::decompress(tiny_packed.data(),
+                                tiny_packed.size(),
+                                tiny_out.data(),
+                                tiny_out.size()));
+    EXPECT_EQ(tiny_out, tiny);
+}
+
+TEST(Lz4Test, RejectsTruncatedOrMissizedBlocks) {
+    std::vector<uint8_t> input(1000, 42);
+    const std::vector<uint8_t> packed =
+        lz4::compress(input.data(), input.size());
+
+    std::vector<uint8_t> output(input.size());
+    EXPECT_FALSE(lz4::decompress(
+        packed.data(), packed.size() - 1, output.data(), output.size()));
+    EXPECT_FALSE(lz4::decompress(
+        packed.data(), packed.size(), output.data(), output.size() - 1));
+}
@@ -0,0 +1,91 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include <udj-core/Random.hpp>
+
+using udj::core::Rng;
+using udj::core::RngService;
+using udj::core::RngStream;
+
+TEST(RngTest, SameSeedSameSequence) {
+    Rng a(42);
+    Rng b(42);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(a.next_u32(), b.next_u32());
+    }
+}
+
+TEST(RngTest, StreamsDiffer) {
+    Rng a(42, 0);
+    Rng b(42, 1);
+    int equal = 0;
+    for (int i = 0; i < 100; ++i) {
+        equal += a.next_u32() == b.next_u32() ? 1 : 0;
+    }
+    EXPECT_LT(equal, 5);
+}
+
+TEST(RngTest, RangesStayInBounds) {
+    Rng rng(7);
+    for (int i = 0; i < 1000; ++i) {
+        float f = rng.range(-2.0f, 3.0f);
+        EXPECT_GE(f, -2.0f);
+        EXPECT_LT(f, 3.0f);
+
+        int n = rng.range_int(-5, 5);
+        EXPECT_GE(n, -5);
+        EXPECT_LE(n, 5);
+    }
+    EXPECT_EQ(rng.range_int(10, 3), 10);
+}
+
+TEST(RngTest, FillRangeMatchesSingleDraws) {
+    Rng batch(123);
+    Rng single(123);
+
+    std::array<float, 16> values{};
+    batch.fill_range(values.data(), values.size(), 1.0f, 5.0f);
+    for (float value : values) {
+        EXPECT_FLOAT_EQ(value, single.range(1.0f, 5.0f));
+    }
+}
+
+TEST(RngTest, StateRestoreReplaysSequence) {
+    Rng rng(99);
+    rng.next_u32();
+    const auto state = rng.get_state();
+    const auto first = rng.next_u32();
+    const auto second = rng.next_u32();
+
+    rng.set_state(state);
+    EXPECT_EQ(rng.next_u32(), first);
+    EXPECT_EQ(rng.next_u32(), second);
+}
+
+TEST(RngServiceTest, SnapshotRestoresAllStreams) {
+    auto& service = RngService::get_instance();
+    service.seed(2025);
+    const auto snapshot = service.save();
+
+    const auto platforms = service.stream(RngStream::Platforms).next_u32();
+    const auto particles = service.stream(RngStream::Particles).next_u32();
+
+    service.restore(snapshot);
+    EXPECT_EQ(service.get_seed(), 2025u);
+    EXPECT_EQ(service.stream(RngStream::Platforms).next_u32(), platforms);
+    EXPECT_EQ(service.stream(RngStream::Particles).next_u32(), particles);
+}
+
+TEST(RngServiceTest, StreamsAreIndependent) {
+    auto& service = RngService::get_instance();
+    service.seed(1);
+    service.stream(RngStream::Particles).next_u32();
+    const auto bonus = service.stream(RngStream::Bonus).next_u32();
+
+    // Drawing particles first must not shift the bonus stream
+    service.seed(1);
+    EXPECT_EQ(service.stream(RngStream::Bonus).next_u32(), bonus);
+}
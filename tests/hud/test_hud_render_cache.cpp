@@ -0,0 +1,114 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+#include <raylib/raylib.h>
+
+#include <functional>
+#include <vector>
+
+#include "udjourney/hud/scene/HUDRenderCache.hpp"
+
+using udjourney::hud::scene::HUDRenderCache;
+
+namespace {
+
+// Records renders and blits instead of touching render textures
+class FakeRenderCache : public HUDRenderCache {
+ public:
+    bool available = true;
+    int renders = 0;
+    mutable std::vector<Rectangle> blits;
+
+ protected:
+    bool render_(Vector2 size, Rectangle bounds, float scale,
+                 const std::function<void()>& draw_contents) override {
+        if (!available) {
+            return false;
+        }
+        ++renders;
+        draw_contents();
+        return true;
+    }
+    void blit_(Rectangle dest) const override { blits.push_back(dest); }
+};
+
+const Rectangle kBounds{20.0f, 10.0f, 100.0f, 30.0f};
+
+}  // namespace
+
+TEST(HUDRenderCacheTest, EmptyCacheFallsBackToDirectDrawing) {
+    FakeRenderCache cache;
+    EXPECT_FALSE(cache.is_current(kBounds, 1.0f, 0));
+    EXPECT_FALSE(cache.draw(0));
+    EXPECT_TRUE(cache.blits.empty());
+}
+
+TEST(HUDRenderCacheTest, StaleContentsFallBackUntilUpdated) {
+    FakeRenderCache cache;
+    int drawn = 0;
+    ASSERT_TRUE(cache.update(kBounds, 1.0f, 5, [&] { ++drawn; }));
+    EXPECT_EQ(drawn, 1);
+    EXPECT_TRUE(cache.is_current(kBounds, 1.0f, 5));
+
+    // The value changed between prepare and draw: the HUD draws directly
+    EXPECT_FALSE(cache.is_current(kBounds, 1.0f, 6));
+    EXPECT_FALSE(cache.draw(6));
+    EXPECT_TRUE(cache.blits.empty());
+
+    EXPECT_TRUE(cache.draw(5));
+    EXPECT_EQ(cache.blits.size(), 1u);
+
+    cache.invalidate();
+    EXPECT_FALSE(cache.draw(5));
+}
+
+TEST(HUDRenderCacheTest, BoundsOrScaleChangeNeedsRerender) {
+    FakeRenderCache cache;
+    ASSERT_TRUE(cache.update(kBounds, 1.0f, 1, [] {}));
+
+    Rectangle moved = kBounds;
+    moved.x += 1.0f;
+    EXPECT_FALSE(cache.is_current(moved, 1.0f, 1));
+    EXPECT_FALSE(cache.is_current(kBounds, 2.0f, 1));
+    EXPECT_TRUE(cache.is_current(kBounds, 1.0f, 1));
+}
+
+TEST(HUDRenderCacheTest, TextureCoversBoundsInWindowPixels) {
+    const Vector2 size = HUDRenderCache::texture_size(
+        Rectangle{0.0f, 0.0f, 100.5f, 30.0f}, 1.5f);
+    EXPECT_FLOAT_EQ(size.x, 151.0f);
+    EXPECT_FLOAT_EQ(size.y, 45.0f);
+
+    // Drawn back at the logical bounds, covering them
+    FakeRenderCache cache;
+    ASSERT_TRUE(cache.update(kBounds, 1.5f, 1, [] {}));
+    ASSERT_TRUE(cache.draw(1));
+    const Rectangle dest = cache.blits.front();
+    EXPECT_FLOAT_EQ(dest.x, kBounds.x);
+    EXPECT_FLOAT_EQ(dest.y, kBounds.y);
+    EXPECT_GE(dest.width, kBounds.width);
+    EXPECT_GE(dest.height, kBounds.height);
+    EXPECT_LT(dest.width, kBounds.width + 1.0f);
+}
+
+TEST(HUDRenderCacheTest, EmptyBoundsOrMissingTargetLeaveCacheEmpty) {
+    FakeRenderCache cache;
+    int drawn = 0;
+    EXPECT_FALSE(cache.update(
+        Rectangle{0.0f, 0.0f, 0.0f, 10.0f}, 1.0f, 1, [&] { ++drawn; }));
+    EXPECT_FALSE(cache.update(kBounds, 0.0f, 1, [&] { ++drawn; }));
+    EXPECT_EQ(cache.renders, 0);
+    EXPECT_EQ(drawn, 0);
+
+    // No render texture (Dreamcast, or creation failed)
+    cache.available = false;
+    EXPECT_FALSE(cache.update(kBounds, 1.0f, 1, [&] { ++drawn; }));
+    EXPECT_FALSE(cache.draw(1));
+
+    // A failed update drops what was cached before
+    cache.available = true;
+    ASSERT_TRUE(cache.update(kBounds, 1.0f, 1, [] {}));
+    cache.available = false;
+    EXPECT_FALSE(cache.update(kBounds, 1.0f, 2, [] {}));
+    EXPECT_FALSE(cache.draw(1));
+}
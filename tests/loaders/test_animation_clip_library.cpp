@@ -0,0 +1,144 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+#include "udjourney/AnimationClipLibrary.hpp"
+#include "udjourney/loaders/AnimationConfigLoader.hpp"
+#include "udjourney/loaders/PresetBundle.hpp"
+#include "managers/fake_texture_backend.hpp"
+#include "udjourney/managers/TextureManager.hpp"
+
+using udjourney::animation::AnimationClip;
+using udjourney::animation::AnimationClipLibrary;
+using udjourney::animation::PlaybackCursor;
+
+namespace {
+
+udjourney::animation::AnimationPresetConfig one_clip_config(
+    const std::string& sheet) {
+    udjourney::animation::AnimationPresetConfig config;
+    auto& idle = config.animations.emplace_back();
+    idle.name = "idle";
+    idle.state_id = 0;
+    idle.sprite_config.filename = sheet;
+    idle.sprite_config.frames = {{0, 0}};
+    return config;
+}
+
+}  // namespace
+
+TEST(AnimationClipTest, CursorStepsLoopsAndStops) {
+    AnimationClip clip;
+    clip.first_frame = Rectangle{64, 32, 32, 32};
+    clip.frame_count = 3;
+    clip.frame_time = 0.1f;
+
+    PlaybackCursor cursor{0};
+    udjourney::animation::advance(clip, &cursor, 0.05f);
+    EXPECT_EQ(cursor.frame, 0);
+    udjourney::animation::advance(clip, &cursor, 0.06f);
+    EXPECT_EQ(cursor.frame, 1);
+    EXPECT_FLOAT_EQ(clip.frame_rect(cursor.frame).x, 96.0f);
+    EXPECT_FLOAT_EQ(clip.frame_rect(cursor.frame).y, 32.0f);
+
+    udjourney::animation::advance(clip, &cursor, 0.1f);
+    udjourney::animation::advance(clip, &cursor, 0.1f);
+    EXPECT_EQ(cursor.frame, 0);
+    EXPECT_FALSE(cursor.finished);
+
+    clip.loop = false;
+    for (int i = 0; i < 5; ++i) {
+        udjourney::animation::advance(clip, &cursor, 0.1f);
+    }
+    EXPECT_EQ(cursor.frame, 2);
+    EXPECT_TRUE(cursor.finished);
+}
+
+TEST(AnimationClipTest, ActorsOfOnePresetShareItsClips) {
+    // Served by the bundle so no JSON has to exist; the sheet is missing,
+    // which loads as an empty texture without touching the GPU
+    udjourney::animation::AnimationPresetConfig config;
+    auto& attack = config.animations.emplace_back();
+    attack.name = "attack";
+    attack.state_id = 13;
+    attack.collision_bounds = {2.0f, 4.0f, 20.0f, 30.0f};
+    attack.sprite_config.filename = "test/missing_sheet.png";
+    attack.sprite_config.frames = {{1, 0}, {1, 1}};
+    attack.sprite_config.frame_duration = 0.1f;
+    attack.sprite_config.loop = false;
+
+    const std::string path = "animations/clip_library_test.json";
+    auto& bundle = udjourney::loaders::PresetBundle::get_instance();
+    bundle.add_animation(path, config);
+
+    using udjourney::loaders::AnimationConfigLoader;
+    auto first = AnimationConfigLoader::load_and_create(path);
+    const auto clips = AnimationClipLibrary::get_instance().find(path);
+    ASSERT_NE(clips, nullptr);
+    EXPECT_FALSE(clips->player_states);
+    EXPECT_EQ(clips->find(13), 0);
+    EXPECT_EQ(clips->find(10), -1);
+
+    // A second actor reuses the set, with its own playback position
+    auto second = AnimationConfigLoader::load_and_create(path);
+    EXPECT_EQ(AnimationClipLibrary::get_instance().find(path), clips);
+
+    first.set_current_state(13);
+    second.set_current_state(13);
+    EXPECT_TRUE(first.has_collision_bounds());
+    EXPECT_FLOAT_EQ(first.get_collision_bounds().height, 30.0f);
+
+    first.update(0.1f);
+    first.update(0.1f);
+    EXPECT_TRUE(first.is_animation_finished());
+    EXPECT_FALSE(second.is_animation_finished());
+
+    // No clip for this state: nothing plays, no bounds
+    second.set_current_state(10);
+    EXPECT_FALSE(second.has_collision_bounds());
+    EXPECT_FALSE(second.is_animation_finished());
+
+    bundle.clear();
+    AnimationClipLibrary::get_instance().clear();
+}
+
+class AnimationClipResidencyTest : public FakeTextureBackendTest {
+ protected:
+    void TearDown() override {
+        AnimationClipLibrary::get_instance().clear();
+        FakeTextureBackendTest::TearDown();
+    }
+};
+
+TEST_F(AnimationClipResidencyTest, DroppedSetsReleaseTheirSheets) {
+    textures.set_budget_bytes(0);
+
+    const std::string sheet = "test/clip_refcount.png";
+    const TextureHandle handle = textures.get_handle(sheet);
+    const auto settle = [this] {
+        textures.end_frame();
+        textures.end_frame();
+    };
+
+    // Rebuilding a registered preset must not stack references
+    auto& library = AnimationClipLibrary::get_instance();
+    library.add("animations/refcount_a.json", one_clip_config(sheet));
+    library.add("animations/refcount_a.json", one_clip_config(sheet));
+    std::optional<udjourney::AnimSpriteController> controller(
+        udjourney::loaders::AnimationConfigLoader::create_controller(
+            one_clip_config(sheet)));
+    settle();
+    EXPECT_TRUE(textures.is_ready(handle));
+
+    // The controller's own set still holds the sheet after clear()
+    library.clear();
+    settle();
+    EXPECT_TRUE(textures.is_ready(handle));
+
+    controller.reset();
+    settle();
+    EXPECT_FALSE(textures.is_ready(handle));
+}
@@ -0,0 +1,67 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include "udjourney/loaders/MonsterPresetRegistry.hpp"
+#include "udjourney/loaders/PresetBundle.hpp"
+
+using udjourney::MonsterPresetRegistry;
+using udjourney::loaders::PresetBundle;
+
+namespace {
+
+// Serves presets from the bundle so no JSON has to exist on disk
+class MonsterPresetRegistryTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        udjourney::MonsterPreset goblin;
+        goblin.name = "goblin";
+        goblin.stats.max_health = 40.0f;
+        PresetBundle::get_instance().add_monster("monsters/goblin.json",
+                                                 goblin);
+        MonsterPresetRegistry::get_instance().clear();
+    }
+
+    void TearDown() override {
+        PresetBundle::get_instance().clear();
+        MonsterPresetRegistry::get_instance().clear();
+    }
+};
+
+}  // namespace
+
+TEST_F(MonsterPresetRegistryTest, SharesOnePresetAcrossLookups) {
+    auto& registry = MonsterPresetRegistry::get_instance();
+    const auto first = registry.get("goblin");
+    const auto second = registry.get("goblin");
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_FLOAT_EQ(first->stats.max_health, 40.0f);
+    EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST_F(MonsterPresetRegistryTest, ReloadsOnlyAfterInvalidation) {
+    auto& registry = MonsterPresetRegistry::get_instance();
+    const auto before = registry.get("goblin");
+
+    udjourney::MonsterPreset edited;
+    edited.name = "goblin";
+    edited.stats.max_health = 90.0f;
+    PresetBundle::get_instance().add_monster("monsters/goblin.json", edited);
+    EXPECT_EQ(registry.get("goblin").get(), before.get());
+
+    registry.invalidate("goblin");
+    const auto after = registry.get("goblin");
+    ASSERT_NE(after, nullptr);
+    EXPECT_FLOAT_EQ(after->stats.max_health, 90.0f);
+    // Holders of the old preset keep it alive and unchanged
+    EXPECT_FLOAT_EQ(before->stats.max_health, 40.0f);
+}
+
+TEST_F(MonsterPresetRegistryTest, RemembersMissingPresets) {
+    auto& registry = MonsterPresetRegistry::get_instance();
+    EXPECT_EQ(registry.get("no_such_monster"), nullptr);
+    EXPECT_EQ(registry.get("no_such_monster"), nullptr);
+    EXPECT_EQ(registry.size(), 1u);
+}
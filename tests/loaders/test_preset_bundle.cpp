@@ -0,0 +1,153 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "udjourney/loaders/PresetBundle.hpp"
+
+using udjourney::loaders::PresetBundle;
+
+namespace {
+
+PresetBundle make_bundle() {
+    udjourney::animation::AnimationPresetConfig anim;
+    anim.preset_name = "goblin";
+    auto& idle = anim.animations.emplace_back();
+    idle.name = "idle";
+    idle.state_id = 2;
+    idle.collision_bounds = {4.0f, 8.0f, 24.0f, 40.0f};
+    idle.sprite_config.filename = "goblin-Sheet.png";
+    idle.sprite_config.frames = {{0, 0}, {0, 1}, {0, 2}};
+    idle.sprite_config.loop = false;
+
+    udjourney::MonsterPreset goblin;
+    goblin.name = "goblin";
+    goblin.animation_preset_file = "goblin_animations.json";
+    goblin.stats.max_health = 40.0f;
+    goblin.behavior.can_jump = true;
+    goblin.state_config.available_states = {"idle", "chase"};
+    goblin.state_config.transitions.push_back(
+        {"idle", "chase", "player_in_range", 120.0f});
+    goblin.state_config.state_durations["idle"] = 1.5f;
+
+    udjourney::MonsterPreset orphan;
+    orphan.name = "orphan";
+    orphan.animation_preset_file = "missing.json";
+
+    udjourney::ParticlePreset spark;
+    spark.name = "spark";
+    spark.end_color = Color{1, 2, 3, 4};
+    spark.bake = true;
+
+    udjourney::ProjectilePreset arrow;
+    arrow.name = "arrow";
+    arrow.trajectory = udjourney::TrajectoryType::ARC;
+    arrow.source_rect = Rectangle{16, 0, 16, 8};
+
+    PresetBundle bundle;
+    bundle.add_animation("animations/goblin_animations.json", anim);
+    bundle.add_monster("monsters/goblin.json", goblin);
+    bundle.add_monster("monsters/orphan.json", orphan);
+    bundle.set_particles("particles.json", {spark});
+    bundle.set_projectiles("projectiles.json", {arrow});
+    return bundle;
+}
+
+}  // namespace
+
+TEST(PresetBundleTest, RoundTripsEveryPresetKind) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "preset_bundle_test.udp";
+    ASSERT_TRUE(make_bundle().save_to_path(path.string()));
+
+    PresetBundle bundle;
+    ASSERT_TRUE(bundle.load_from_path(path.string()));
+    EXPECT_EQ(bundle.monster_count(), 2u);
+    EXPECT_EQ(bundle.animation_count(), 1u);
+
+    const auto* goblin = bundle.find_monster("monsters/goblin.json");
+    ASSERT_NE(goblin, nullptr);
+    EXPECT_FLOAT_EQ(goblin->stats.max_health, 40.0f);
+    EXPECT_TRUE(goblin->behavior.can_jump);
+    EXPECT_EQ(goblin->state_config.available_states.size(), 2u);
+    ASSERT_EQ(goblin->state_config.transitions.size(), 1u);
+    EXPECT_EQ(goblin->state_config.transitions[0].condition,
+              "player_in_range");
+    EXPECT_FLOAT_EQ(goblin->state_config.state_durations.at("idle"), 1.5f);
+
+    const auto* anim =
+        bundle.find_animation("animations/goblin_animations.json");
+    ASSERT_NE(anim, nullptr);
+    ASSERT_EQ(anim->animations.size(), 1u);
+    EXPECT_EQ(anim->animations[0].sprite_config.frames.size(), 3u);
+    EXPECT_EQ(anim->animations[0].sprite_config.frames[2].col, 2);
+    EXPECT_FALSE(anim->animations[0].sprite_config.loop);
+    EXPECT_FLOAT_EQ(anim->animations[0].collision_bounds.height, 40.0f);
+
+    const auto* particles = bundle.find_particles("particles.json");
+    ASSERT_NE(particles, nullptr);
+    ASSERT_EQ(particles->size(), 1u);
+    EXPECT_EQ((*particles)[0].end_color.a, 4);
+    EXPECT_TRUE((*particles)[0].bake);
+
+    const auto* projectiles = bundle.find_projectiles("projectiles.json");
+    ASSERT_NE(projectiles, nullptr);
+    ASSERT_EQ(projectiles->size(), 1u);
+    EXPECT_EQ((*projectiles)[0].trajectory, udjourney::TrajectoryType::ARC);
+    EXPECT_FLOAT_EQ((*projectiles)[0].source_rect.x, 16.0f);
+
+    EXPECT_EQ(bundle.find_monster("monsters/troll.json"), nullptr);
+    EXPECT_EQ(bundle.find_projectiles("other.json"), nullptr);
+
+    std::filesystem::remove(path);
+}
+
+TEST(PresetBundleTest, ResolvesMonsterAnimationsAtCookTime) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "preset_bundle_refs.udp";
+    ASSERT_TRUE(make_bundle().save_to_path(path.string()));
+
+    PresetBundle bundle;
+    ASSERT_TRUE(bundle.load_from_path(path.string()));
+    EXPECT_EQ(bundle.find_monster_animation("monsters/goblin.json"),
+              bundle.find_animation("animations/goblin_animations.json"));
+    EXPECT_EQ(bundle.find_monster_animation("monsters/orphan.json"), nullptr);
+
+    std::filesystem::remove(path);
+}
+
+TEST(PresetBundleTest, RejectsCorruptedOrTruncatedBundles) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "preset_bundle_bad.udp";
+    ASSERT_TRUE(make_bundle().save_to_path(path.string()));
+
+    std::vector<char> bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    ASSERT_GT(bytes.size(), 64u);
+
+    // One flipped bit in the string table fails the checksum
+    bytes[bytes.size() - 5] ^= 0x10;
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    PresetBundle bundle;
+    EXPECT_FALSE(bundle.load_from_path(path.string()));
+    EXPECT_TRUE(bundle.empty());
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), 16);
+    }
+    EXPECT_FALSE(bundle.load_from_path(path.string()));
+    EXPECT_FALSE(bundle.load_from_path(path.string() + ".missing"));
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,65 @@
+// Copyright 2025 Quentin Cartier
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+#include "udjourney/managers/TextureManager.hpp"
+
+/**
+ * @brief Runs TextureManager residency without a GL context
+ *
+ * Every file decodes to a 1x1 RGBA image (4 bytes) and uploads to a fresh
+ * id. SetUp installs the fake backend and TearDown restores the real one
+ * and the budget, even when an assertion ends the test early.
+ */
+class FakeTextureBackendTest : public ::testing::Test {
+ protected:
+    static constexpr size_t kTextureBytes = 4;
+
+    void SetUp() override {
+        textures.unload_all();
+        saved_budget = textures.get_budget_bytes();
+        textures.set_backend(
+            TextureManager::Backend{fake_decode, fake_upload, fake_unload});
+        unloads = 0;
+    }
+
+    void TearDown() override {
+        textures.unpin_all();
+        textures.unload_all();
+        textures.set_backend(TextureManager::default_backend());
+        textures.set_budget_bytes(saved_budget);
+    }
+
+    static Image fake_decode(const std::string&) {
+        Image image{};
+        image.data = std::malloc(kTextureBytes);
+        image.width = 1;
+        image.height = 1;
+        image.mipmaps = 1;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        return image;
+    }
+
+    static Texture2D fake_upload(const Image& image) {
+        Texture2D texture{};
+        texture.id = next_id++;
+        texture.width = image.width;
+        texture.height = image.height;
+        texture.mipmaps = 1;
+        texture.format = image.format;
+        return texture;
+    }
+
+    static void fake_unload(Texture2D) { ++unloads; }
+
+    static inline unsigned int next_id = 1000;
+    static inline int unloads = 0;  // Textures freed since SetUp
+
+    TextureManager& textures = TextureManager::get_instance();
+    size_t saved_budget = 0;
+};
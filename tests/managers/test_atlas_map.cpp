@@ -0,0 +1,79 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "udjourney/managers/AtlasMap.hpp"
+#include "udjourney/managers/TextureHandle.hpp"
+
+TEST(AtlasMapTest, RoundTripsThroughTheRemapTable) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "atlas_map_test.json";
+
+    AtlasMap written;
+    written.add("char1-Sheet.png",
+                AtlasEntry{"atlases/atlas_0.png", Rectangle{2, 70, 512, 64}});
+    written.add("ui/ui_elements.png",
+                AtlasEntry{"atlases/atlas_0.png", Rectangle{2, 2, 256, 256}});
+    ASSERT_TRUE(written.save_to_file(path.string()));
+
+    AtlasMap read;
+    ASSERT_TRUE(read.load_from_file(path.string()));
+    EXPECT_EQ(read.size(), 2u);
+
+    const AtlasEntry* entry = read.find("char1-Sheet.png");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->atlas, "atlases/atlas_0.png");
+    EXPECT_FLOAT_EQ(entry->rect.y, 70.0f);
+    EXPECT_FLOAT_EQ(entry->rect.width, 512.0f);
+    EXPECT_EQ(read.find("spiderplant-Sheet.png"), nullptr);
+
+    std::filesystem::remove(path);
+}
+
+TEST(AtlasMapTest, MissingOrMalformedTableLeavesItEmpty) {
+    const auto path =
+        std::filesystem::temp_directory_path() / "atlas_map_bad.json";
+    {
+        std::ofstream out(path);
+        out << R"({"sheets": {"a.png": {"atlas": "p.png", "x": 1}}})";
+    }
+
+    AtlasMap map;
+    EXPECT_FALSE(map.load_from_file(path.string()));
+    EXPECT_EQ(map.size(), 0u);
+    EXPECT_FALSE(map.load_from_file(path.string() + ".missing"));
+
+    std::filesystem::remove(path);
+}
+
+TEST(TextureRegionTest, MapsSheetRectsIntoThePage) {
+    const TextureRegion packed{TextureHandle{3}, Rectangle{2, 70, 512, 64}};
+    const Rectangle frame = packed.map(Rectangle{64, 0, 64, 64});
+
+    EXPECT_TRUE(packed.is_packed());
+    EXPECT_FLOAT_EQ(frame.x, 66.0f);
+    EXPECT_FLOAT_EQ(frame.y, 70.0f);
+    EXPECT_FLOAT_EQ(frame.width, 64.0f);
+
+    const TextureRegion standalone{TextureHandle{4}};
+    EXPECT_FALSE(standalone.is_packed());
+    EXPECT_FLOAT_EQ(standalone.map(Rectangle{64, 0, 64, 64}).x, 64.0f);
+}
+
+TEST(TextureRegionTest, EmptyRectStandsForTheWholeSheet) {
+    // Whole-sheet button backgrounds have no source rect
+    const TextureRegion packed{TextureHandle{3}, Rectangle{2, 70, 512, 64}};
+    const Rectangle whole = packed.map_or_sheet(Rectangle{});
+    EXPECT_FLOAT_EQ(whole.x, 2.0f);
+    EXPECT_FLOAT_EQ(whole.y, 70.0f);
+    EXPECT_FLOAT_EQ(whole.width, 512.0f);
+    EXPECT_FLOAT_EQ(whole.height, 64.0f);
+    EXPECT_FLOAT_EQ(packed.map_or_sheet(Rectangle{64, 0, 64, 64}).x, 66.0f);
+
+    // Standalone textures keep drawing the full texture
+    const TextureRegion standalone{TextureHandle{4}};
+    EXPECT_FLOAT_EQ(standalone.map_or_sheet(Rectangle{}).width, 0.0f);
+}
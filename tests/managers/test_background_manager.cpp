@@ -0,0 +1,44 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "udjourney/managers/BackgroundManager.hpp"
+
+using YIndex = udjourney::BackgroundManager::YIndex;
+
+TEST(BackgroundYIndexTest, QueryReturnsObjectsInRangeByY) {
+    YIndex index;
+    // Scene order, not sorted by y
+    index.build({300.0f, -50.0f, 120.0f, 900.0f, 120.0f});
+
+    std::vector<uint32_t> out;
+    index.query(100.0f, 300.0f, out);
+    // Both ends are inclusive; equal y keeps scene order
+    EXPECT_EQ(out, (std::vector<uint32_t>{2, 4, 0}));
+
+    // Results are appended, so wrapped copies can share one list
+    index.query(-100.0f, 0.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{2, 4, 0, 1}));
+}
+
+TEST(BackgroundYIndexTest, EmptyRangesAndLayers) {
+    YIndex index;
+    index.build({10.0f, 20.0f});
+
+    std::vector<uint32_t> out;
+    index.query(21.0f, 500.0f, out);
+    index.query(-500.0f, 9.0f, out);
+    EXPECT_TRUE(out.empty());
+
+    YIndex empty;
+    empty.build({});
+    empty.query(-1000.0f, 1000.0f, out);
+    EXPECT_TRUE(out.empty());
+
+    // Rebuilding replaces the previous contents
+    index.build({5.0f});
+    index.query(0.0f, 100.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{0}));
+}
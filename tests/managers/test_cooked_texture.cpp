@@ -0,0 +1,137 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "udjourney/managers/CookedTexture.hpp"
+
+namespace {
+
+// 4x2 RGBA8 image with three colors
+std::vector<Color> sample_pixels() {
+    return {RED, RED, GREEN, BLANK, BLUE, RED, GREEN, BLANK};
+}
+
+Image as_image(std::vector<Color>* pixels) {
+    return Image{
+        pixels->data(), 4, 2, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+}
+
+uint16_t pixel16(const Image& image, int index) {
+    return static_cast<const uint16_t*>(image.data)[index];
+}
+
+}  // namespace
+
+TEST(CookedTextureTest, CookedPathReplacesTheExtension) {
+    EXPECT_EQ(CookedTexture::cooked_path_for("assets/char1-Sheet.png"),
+              "assets/char1-Sheet.udt");
+    EXPECT_EQ(CookedTexture::cooked_path_for("v1.2/sheet"), "v1.2/sheet.udt");
+}
+
+TEST(CookedTextureTest, DirectFormatsMatchRaylibLayouts) {
+    std::vector<Color> pixels = sample_pixels();
+    const auto data = CookedTexture::encode(as_image(&pixels),
+                                            CookedFormat::Rgba5551,
+                                            CookedFormat::Rgba8888,
+                                            false);
+    ASSERT_FALSE(data.empty());
+
+    Image image{};
+    ASSERT_TRUE(CookedTexture::decode(data.data(), data.size(), &image));
+    EXPECT_EQ(image.width, 4);
+    EXPECT_EQ(image.height, 2);
+    EXPECT_EQ(image.format, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1);
+    // RED {230, 41, 55, 255}
+    EXPECT_EQ(pixel16(image, 0), (28 << 11) | (5 << 6) | (6 << 1) | 1);
+    EXPECT_EQ(pixel16(image, 3), 0);
+    UnloadImage(image);
+}
+
+TEST(CookedTextureTest, IndexedDataExpandsToItsPaletteFormat) {
+    std::vector<Color> pixels = sample_pixels();
+    const auto data = CookedTexture::encode(as_image(&pixels),
+                                            CookedFormat::Indexed4,
+                                            CookedFormat::Rgba4444,
+                                            true);
+    ASSERT_FALSE(data.empty());
+
+    Image image{};
+    ASSERT_TRUE(CookedTexture::decode(data.data(), data.size(), &image));
+    EXPECT_EQ(image.format, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4);
+    EXPECT_EQ(pixel16(image, 0), pixel16(image, 5));
+    EXPECT_EQ(pixel16(image, 2), pixel16(image, 6));
+    EXPECT_EQ(pixel16(image, 4), 0x07FF);  // BLUE {0, 121, 241, 255}
+    EXPECT_EQ(pixel16(image, 7), 0);
+    UnloadImage(image);
+}
+
+TEST(CookedTextureTest, CompressedRoundTripIsLossless) {
+    std::vector<Color> pixels(64 * 64, DARKGRAY);
+    for (size_t i = 0; i < pixels.size(); i += 9) {
+        pixels[i] = ORANGE;
+    }
+    const Image source{
+        pixels.data(), 64, 64, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    const auto data = CookedTexture::encode(
+        source, CookedFormat::Rgba8888, CookedFormat::Rgba8888, true);
+    ASSERT_FALSE(data.empty());
+    EXPECT_LT(data.size(), pixels.size() * sizeof(Color) / 4);
+
+    Image image{};
+    ASSERT_TRUE(CookedTexture::decode(data.data(), data.size(), &image));
+    const auto* decoded = static_cast<const Color*>(image.data);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        ASSERT_EQ(decoded[i].r, pixels[i].r);
+        ASSERT_EQ(decoded[i].a, pixels[i].a);
+    }
+    UnloadImage(image);
+}
+
+TEST(CookedTextureTest, RejectsTooManyColorsAndMalformedData) {
+    std::vector<Color> pixels(20);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = Color{static_cast<unsigned char>(i * 10), 0, 0, 255};
+    }
+    const Image many{pixels.data(), 5, 4, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    EXPECT_TRUE(CookedTexture::encode(
+                    many, CookedFormat::Indexed4, CookedFormat::Rgb565, false)
+                    .empty());
+
+    auto data = CookedTexture::encode(
+        many, CookedFormat::Indexed8, CookedFormat::Rgb565, false);
+    ASSERT_FALSE(data.empty());
+    Image image{};
+    data.pop_back();
+    EXPECT_FALSE(CookedTexture::decode(data.data(), data.size(), &image));
+    data[0] = 'X';
+    EXPECT_FALSE(CookedTexture::decode(data.data(), data.size(), &image));
+    EXPECT_EQ(image.data, nullptr);
+}
+
+TEST(CookedTextureTest, EditedSourceWinsOverAnOlderCook) {
+    const auto dir = std::filesystem::temp_directory_path();
+    const std::string source = (dir / "cooked_texture_test.png").string();
+    const std::string cooked = CookedTexture::cooked_path_for(source);
+    std::ofstream(source) << "png";
+    std::ofstream(cooked) << "udt";
+
+    const auto now = std::filesystem::last_write_time(source);
+    std::filesystem::last_write_time(cooked, now + std::chrono::hours(1));
+    EXPECT_TRUE(CookedTexture::is_current(cooked, source));
+
+    std::filesystem::last_write_time(cooked, now - std::chrono::hours(1));
+    EXPECT_FALSE(CookedTexture::is_current(cooked, source));
+
+    // Shipping only the cooked file is fine; a missing cook is not
+    std::filesystem::remove(source);
+    EXPECT_TRUE(CookedTexture::is_current(cooked, source));
+    std::filesystem::remove(cooked);
+    EXPECT_FALSE(CookedTexture::is_current(cooked, source));
+}
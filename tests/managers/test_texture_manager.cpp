@@ -0,0 +1,167 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "managers/fake_texture_backend.hpp"
+#include "udjourney/managers/TextureManager.hpp"
+
+TEST(TextureManagerTest, HandlesAreStablePerPath) {
+    auto& textures = TextureManager::get_instance();
+    const TextureHandle a = textures.get_handle("test/handle_a.png");
+    const TextureHandle b = textures.get_handle("test/handle_b.png");
+
+    EXPECT_TRUE(a.is_valid());
+    EXPECT_TRUE(b.is_valid());
+    EXPECT_NE(a, b);
+    EXPECT_EQ(textures.get_handle("test/handle_a.png"), a);
+    EXPECT_EQ(textures.get_path(b), "test/handle_b.png");
+}
+
+TEST(TextureManagerTest, EmptyPathIsTheNullHandle) {
+    auto& textures = TextureManager::get_instance();
+    const TextureHandle none = textures.get_handle("");
+
+    EXPECT_FALSE(none.is_valid());
+    EXPECT_EQ(textures.get(none).id, 0u);
+    EXPECT_TRUE(textures.get_path(none).empty());
+}
+
+TEST(TextureManagerTest, RequestedTexturesLandThroughPumpUploads) {
+    auto& textures = TextureManager::get_instance();
+    // Missing file: decodes to an empty image, so no GL upload happens
+    const TextureHandle missing = textures.get_handle("test/missing.png");
+
+    textures.request(missing);
+    EXPECT_FALSE(textures.is_ready(missing));
+
+    size_t uploaded = 0;
+    for (int i = 0; i < 500 && !textures.is_ready(missing); ++i) {
+        uploaded += textures.pump_uploads(1.0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_TRUE(textures.is_ready(missing));
+    EXPECT_EQ(uploaded, 1u);
+    EXPECT_EQ(textures.get(missing).id, 0u);
+
+    // Already resolved: a second request is a no-op
+    textures.request(missing);
+    EXPECT_TRUE(textures.is_ready(missing));
+}
+
+class TextureResidencyTest : public FakeTextureBackendTest {
+ protected:
+    // Load path this frame and end the frame
+    TextureHandle load_frame(const std::string& path) {
+        const TextureHandle handle = textures.get_handle(path);
+        textures.get(handle);
+        textures.end_frame();
+        return handle;
+    }
+};
+
+TEST_F(TextureResidencyTest, EvictsLeastRecentlyUsedOverBudget) {
+    textures.set_budget_bytes(2 * kTextureBytes);
+
+    const TextureHandle a = load_frame("test/lru_a.png");
+    const TextureHandle b = load_frame("test/lru_b.png");
+    EXPECT_EQ(textures.get_resident_count(), 2u);
+
+    const TextureHandle c = load_frame("test/lru_c.png");
+    EXPECT_EQ(textures.get_resident_count(), 2u);
+    EXPECT_EQ(textures.get_resident_bytes(), 2 * kTextureBytes);
+    EXPECT_EQ(unloads, 1);
+    EXPECT_FALSE(textures.is_ready(a));
+    EXPECT_TRUE(textures.is_ready(b));
+    EXPECT_TRUE(textures.is_ready(c));
+
+    // Touching b makes it newer than c: c goes next
+    textures.get(b);
+    textures.end_frame();
+    load_frame("test/lru_a.png");
+    EXPECT_TRUE(textures.is_ready(a));
+    EXPECT_TRUE(textures.is_ready(b));
+    EXPECT_FALSE(textures.is_ready(c));
+}
+
+TEST_F(TextureResidencyTest, TexturesDrawnThisFrameAreKept) {
+    textures.set_budget_bytes(kTextureBytes);
+
+    const TextureHandle a = textures.get_handle("test/frame_a.png");
+    const TextureHandle b = textures.get_handle("test/frame_b.png");
+    textures.get(a);
+    textures.get(b);
+    textures.end_frame();
+    EXPECT_EQ(textures.get_resident_count(), 2u);
+
+    // Unused for a frame: evicted down to the budget, no further
+    textures.end_frame();
+    EXPECT_EQ(textures.get_resident_count(), 1u);
+    EXPECT_EQ(unloads, 1);
+
+    // An evicted handle stays valid and reloads on the next get
+    const TextureHandle evicted = textures.is_ready(a) ? b : a;
+    EXPECT_NE(textures.get(evicted).id, 0u);
+    EXPECT_TRUE(textures.is_ready(evicted));
+}
+
+TEST_F(TextureResidencyTest, AcquiredAndPinnedTexturesSurviveEviction) {
+    textures.set_budget_bytes(0);
+
+    const TextureHandle held = textures.get_handle("test/held.png");
+    const TextureHandle pinned = textures.get_handle("test/pinned.png");
+    const TextureHandle loose = textures.get_handle("test/loose.png");
+    const unsigned int held_id = textures.acquire(held).id;
+    textures.get(pinned);
+    textures.pin(pinned);
+    textures.get(loose);
+    textures.end_frame();
+    textures.end_frame();
+
+    EXPECT_TRUE(textures.is_ready(held));
+    EXPECT_TRUE(textures.is_ready(pinned));
+    EXPECT_FALSE(textures.is_ready(loose));
+    // The holder's copy is still the live texture
+    EXPECT_EQ(textures.get(held).id, held_id);
+
+    textures.release(held);
+    textures.end_frame();
+    textures.end_frame();
+    EXPECT_FALSE(textures.is_ready(held));
+    EXPECT_TRUE(textures.is_ready(pinned));
+
+    textures.unpin_all();
+    textures.end_frame();
+    textures.end_frame();
+    EXPECT_FALSE(textures.is_ready(pinned));
+    EXPECT_EQ(textures.get_resident_count(), 0u);
+}
+
+TEST_F(TextureResidencyTest, ReleasesBalanceAcquires) {
+    textures.set_budget_bytes(0);
+    const TextureHandle handle = textures.get_handle("test/refcount.png");
+
+    textures.acquire(handle);
+    textures.acquire(handle);
+    textures.release(handle);
+    textures.end_frame();
+    textures.end_frame();
+    EXPECT_TRUE(textures.is_ready(handle));
+
+    textures.release(handle);
+    // Extra releases do not wrap the count around
+    textures.release(handle);
+    textures.end_frame();
+    textures.end_frame();
+    EXPECT_FALSE(textures.is_ready(handle));
+
+    textures.acquire(handle);
+    textures.end_frame();
+    textures.end_frame();
+    EXPECT_TRUE(textures.is_ready(handle));
+    textures.release(handle);
+}
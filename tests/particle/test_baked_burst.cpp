@@ -0,0 +1,74 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+#include <raylib/raylib.h>
+
+#include "udjourney/particle/BakedBurst.hpp"
+
+using udjourney::BakedBurst;
+using udjourney::ParticlePreset;
+
+namespace {
+
+ParticlePreset make_preset() {
+    ParticlePreset preset;
+    preset.bake = true;
+    preset.bake_frame_count = 6;
+    preset.bake_columns = 4;
+    preset.bake_frame_size = 32;
+    preset.bake_fps = 10.0f;
+    return preset;
+}
+
+}  // namespace
+
+TEST(BakedBurstTest, FrameFollowsAgeAcrossSheetRows) {
+    BakedBurst burst(make_preset(), TextureHandle{}, Vector2{0.0f, 0.0f});
+    EXPECT_EQ(burst.get_frame(), 0);
+
+    burst.update(0.05f);
+    EXPECT_EQ(burst.get_frame(), 0);
+    burst.update(0.1f);
+    EXPECT_EQ(burst.get_frame(), 1);
+    EXPECT_FLOAT_EQ(burst.get_source_rect().x, 32.0f);
+    EXPECT_FLOAT_EQ(burst.get_source_rect().y, 0.0f);
+
+    // Frame 4 wraps to the second row of a 4-column sheet
+    burst.update(0.3f);
+    EXPECT_EQ(burst.get_frame(), 4);
+    const Rectangle source = burst.get_source_rect();
+    EXPECT_FLOAT_EQ(source.x, 0.0f);
+    EXPECT_FLOAT_EQ(source.y, 32.0f);
+    EXPECT_FLOAT_EQ(source.width, 32.0f);
+    EXPECT_FLOAT_EQ(source.height, 32.0f);
+}
+
+TEST(BakedBurstTest, DiesAfterLastFrameAndHoldsIt) {
+    BakedBurst burst(make_preset(), TextureHandle{}, Vector2{0.0f, 0.0f});
+
+    // 6 frames at 10 fps
+    burst.update(0.59f);
+    EXPECT_FALSE(burst.is_dead());
+    EXPECT_EQ(burst.get_frame(), 5);
+
+    burst.update(0.02f);
+    EXPECT_TRUE(burst.is_dead());
+    burst.update(1.0f);
+    EXPECT_EQ(burst.get_frame(), 5);
+}
+
+TEST(BakedBurstTest, InvalidBakeSettingsAreClamped) {
+    ParticlePreset preset = make_preset();
+    preset.bake_frame_count = 0;
+    preset.bake_columns = 0;
+    preset.bake_fps = 0.0f;
+    BakedBurst burst(preset, TextureHandle{}, Vector2{0.0f, 0.0f});
+
+    // One frame at the default 20 fps
+    EXPECT_EQ(burst.get_frame(), 0);
+    burst.update(0.04f);
+    EXPECT_FALSE(burst.is_dead());
+    burst.update(0.02f);
+    EXPECT_TRUE(burst.is_dead());
+    EXPECT_EQ(burst.get_frame(), 0);
+}
@@ -0,0 +1,60 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include "udjourney/render/DrawStats.hpp"
+
+using udjourney::DrawStats;
+using udjourney::DrawSubsystem;
+
+class DrawStatsTest : public ::testing::Test {
+ protected:
+    void SetUp() override { DrawStats::reset(); }
+    void TearDown() override { DrawStats::reset(); }
+};
+
+TEST_F(DrawStatsTest, ScopesAttributeCallsToSubsystems) {
+    {
+        DrawStats::Scope platforms(DrawSubsystem::Platforms);
+        DrawStats::record(4, 7);
+        DrawStats::record(4, 7);
+        {
+            DrawStats::Scope hud(DrawSubsystem::Hud);
+            DrawStats::record(12, 9);
+        }
+        EXPECT_EQ(DrawStats::get_current(), DrawSubsystem::Platforms);
+    }
+    EXPECT_EQ(DrawStats::get_current(), DrawSubsystem::Other);
+    DrawStats::record(3, DrawStats::kShapesTexture);
+
+    // Nothing is visible until the frame is published
+    EXPECT_EQ(DrawStats::get_frame_total().calls, 0u);
+    DrawStats::end_frame();
+
+    const auto& platforms = DrawStats::get_frame(DrawSubsystem::Platforms);
+    EXPECT_EQ(platforms.calls, 2u);
+    EXPECT_EQ(platforms.vertices, 8u);
+    EXPECT_EQ(platforms.texture_changes, 1u);
+    EXPECT_EQ(DrawStats::get_frame(DrawSubsystem::Hud).calls, 1u);
+    EXPECT_EQ(DrawStats::get_frame(DrawSubsystem::Other).calls, 1u);
+
+    const auto total = DrawStats::get_frame_total();
+    EXPECT_EQ(total.calls, 4u);
+    EXPECT_EQ(total.vertices, 23u);
+    EXPECT_EQ(total.texture_changes, 3u);
+}
+
+TEST_F(DrawStatsTest, TextureChangesCountSwitchesOnly) {
+    DrawStats::record(4, 1);
+    DrawStats::record(4, 1);
+    DrawStats::record(4, 2);
+    DrawStats::record(4, 1);
+    DrawStats::end_frame();
+    EXPECT_EQ(DrawStats::get_frame_total().texture_changes, 3u);
+
+    // The first draw of each frame counts as a change
+    DrawStats::record(4, 1);
+    DrawStats::end_frame();
+    EXPECT_EQ(DrawStats::get_frame_total().calls, 1u);
+    EXPECT_EQ(DrawStats::get_frame_total().texture_changes, 1u);
+}
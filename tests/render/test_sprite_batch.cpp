@@ -0,0 +1,63 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+#include <raylib/raylib.h>
+
+#include "udjourney/render/SpriteBatch.hpp"
+
+using udjourney::RenderLayer;
+using udjourney::SpriteBatch;
+
+namespace {
+
+Texture2D make_texture(unsigned int id) {
+    Texture2D texture{};
+    texture.id = id;
+    texture.width = 32;
+    texture.height = 32;
+    return texture;
+}
+
+}  // namespace
+
+TEST(SpriteBatchTest, SortKeyOrdersByLayerThenTextureThenDepth) {
+    const uint8_t actors = SpriteBatch::layer(RenderLayer::Actors);
+    const uint8_t player = SpriteBatch::layer(RenderLayer::Player);
+
+    // A higher layer wins regardless of texture or depth
+    EXPECT_LT(SpriteBatch::make_sort_key(actors, 999, 65535),
+              SpriteBatch::make_sort_key(player, 1, 0));
+    // Within a layer, sprites group by texture before depth
+    EXPECT_LT(SpriteBatch::make_sort_key(actors, 1, 65535),
+              SpriteBatch::make_sort_key(actors, 2, 0));
+    EXPECT_LT(SpriteBatch::make_sort_key(actors, 1, 0),
+              SpriteBatch::make_sort_key(actors, 1, 1));
+}
+
+TEST(SpriteBatchTest, SublayersStayBelowNextLayer) {
+    EXPECT_EQ(SpriteBatch::layer(RenderLayer::Background, 3), 3);
+    EXPECT_LT(SpriteBatch::layer(RenderLayer::Background, 63),
+              SpriteBatch::layer(RenderLayer::Platforms));
+}
+
+TEST(SpriteBatchTest, RecordsOnlyBetweenBeginAndFlush) {
+    SpriteBatch batch;
+    EXPECT_FALSE(batch.is_recording());
+
+    batch.begin();
+    EXPECT_TRUE(batch.is_recording());
+
+    const Rectangle rect{0.0f, 0.0f, 32.0f, 32.0f};
+    const uint8_t actors = SpriteBatch::layer(RenderLayer::Actors);
+    batch.draw_texture(actors, make_texture(7), rect, rect);
+    batch.draw_texture(actors, make_texture(3), rect, rect);
+    EXPECT_EQ(batch.get_pending_count(), 2u);
+
+    // Unloaded textures are dropped, not recorded
+    batch.draw_texture(actors, make_texture(0), rect, rect);
+    EXPECT_EQ(batch.get_pending_count(), 2u);
+
+    // begin() discards anything left over from an unflushed pass
+    batch.begin();
+    EXPECT_EQ(batch.get_pending_count(), 0u);
+}
@@ -0,0 +1,108 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "udjourney/WorldBounds.hpp"
+#include "udjourney/interfaces/IGame.hpp"
+#include "udjourney/platform/Platform.hpp"
+#include "udjourney/platform/reuse_strategies/NoReuseStrategy.hpp"
+#include "udjourney/render/StaticChunkCache.hpp"
+
+using udjourney::IActor;
+using udjourney::Platform;
+using udjourney::StaticChunkCache;
+
+namespace {
+
+// Records the areas platforms report as needing a rebake
+class DirtyRecordingGame : public udjourney::IGame {
+ public:
+    void run() override {}
+    void update() override {}
+    void process_input() override {}
+    void add_actor(std::unique_ptr<IActor> actor) override {}
+    void remove_actor(IActor* actor) override {}
+    Rectangle get_rectangle() const override { return {0, 0, 640, 480}; }
+    void on_checkpoint_reached(float x, float y) const override {}
+    udjourney::Player* get_player() const override { return nullptr; }
+    udjourney::ParticleManager& get_particle_manager() override {
+        return *reinterpret_cast<udjourney::ParticleManager*>(this);
+    }
+    const udjourney::WorldBounds& get_world_bounds() const override {
+        static udjourney::WorldBounds bounds;
+        return bounds;
+    }
+
+    void mark_static_geometry_dirty(Rectangle world_rect) const override {
+        dirty.push_back(world_rect);
+    }
+
+    mutable std::vector<Rectangle> dirty;
+};
+
+}  // namespace
+
+class StaticChunkCacheTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        actors.push_back(std::make_unique<Platform>(
+            game, Rectangle{100, 200, 64, 16}));
+        // Reused platforms move, so they are never baked
+        actors.push_back(std::make_unique<Platform>(
+            game,
+            Rectangle{100, 600, 64, 16},
+            BLUE,
+            false,
+            std::make_unique<udjourney::NoReuseStrategy>()));
+        cache.build(actors);
+        game.dirty.clear();
+    }
+
+    Platform& platform(size_t index) {
+        return static_cast<Platform&>(*actors[index]);
+    }
+
+    DirtyRecordingGame game;
+    std::vector<std::unique_ptr<IActor>> actors;
+    StaticChunkCache cache;
+};
+
+TEST_F(StaticChunkCacheTest, BuildBakesOnlyStaticPlatforms) {
+    EXPECT_EQ(cache.get_baked_platform_count(), 1u);
+    EXPECT_TRUE(platform(0).is_baked());
+    EXPECT_FALSE(platform(1).is_baked());
+}
+
+TEST_F(StaticChunkCacheTest, MovingBakedPlatformDirtiesOldAndNewArea) {
+    platform(0).move(0.0f, 500.0f);
+
+    ASSERT_EQ(game.dirty.size(), 2u);
+    EXPECT_FLOAT_EQ(game.dirty[0].y, 200.0f);
+    EXPECT_FLOAT_EQ(game.dirty[1].y, 700.0f);
+
+    // Platforms drawn per actor never touch the chunks
+    platform(1).move(0.0f, 500.0f);
+    EXPECT_EQ(game.dirty.size(), 2u);
+}
+
+TEST_F(StaticChunkCacheTest, ResizeAndRetextureDirtyBakedPlatform) {
+    platform(0).resize(128.0f, 16.0f);
+    ASSERT_EQ(game.dirty.size(), 2u);
+    EXPECT_FLOAT_EQ(game.dirty[0].width, 64.0f);
+    EXPECT_FLOAT_EQ(game.dirty[1].width, 128.0f);
+
+    platform(0).set_texture_file("test/missing_platform.png");
+    EXPECT_EQ(game.dirty.size(), 3u);
+}
+
+TEST_F(StaticChunkCacheTest, UnbakingDirtiesTheChunk) {
+    platform(0).set_baked(false);
+    ASSERT_EQ(game.dirty.size(), 1u);
+    EXPECT_FLOAT_EQ(game.dirty[0].y, 200.0f);
+
+    platform(0).move(0.0f, 10.0f);
+    EXPECT_EQ(game.dirty.size(), 1u);
+}
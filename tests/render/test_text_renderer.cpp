@@ -0,0 +1,98 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "udjourney/render/TextRenderer.hpp"
+
+using udjourney::TextLayout;
+using udjourney::TextRenderer;
+
+namespace {
+
+constexpr int kFirstGlyph = 32;
+constexpr int kGlyphCount = 95;  // Printable ASCII
+constexpr float kGlyphWidth = 6.0f;
+constexpr int kBaseSize = 10;
+
+// Monospaced fake atlas: one 6x10 cell per printable ASCII character
+class FakeFont {
+ public:
+    FakeFont() {
+        for (int i = 0; i < kGlyphCount; ++i) {
+            glyphs_[i] = GlyphInfo{};
+            glyphs_[i].value = kFirstGlyph + i;
+            recs_[i] = Rectangle{static_cast<float>(i) * kGlyphWidth,
+                                 0.0f,
+                                 kGlyphWidth,
+                                 static_cast<float>(kBaseSize)};
+        }
+        font_.baseSize = kBaseSize;
+        font_.glyphCount = kGlyphCount;
+        font_.glyphPadding = 0;
+        font_.recs = recs_.data();
+        font_.glyphs = glyphs_.data();
+    }
+
+    const Font& get() const { return font_; }
+
+ private:
+    std::array<GlyphInfo, kGlyphCount> glyphs_{};
+    std::array<Rectangle, kGlyphCount> recs_{};
+    Font font_{};
+};
+
+}  // namespace
+
+TEST(TextRendererTest, LaysOutOneQuadPerGlyphWithSpacing) {
+    FakeFont font;
+    TextLayout layout = TextRenderer::build_layout(font.get(), "hello", 10);
+
+    ASSERT_EQ(layout.glyphs.size(), 5u);
+    // 5 glyphs of 6 px plus 1 px spacing between them
+    EXPECT_FLOAT_EQ(layout.width, 34.0f);
+    EXPECT_FLOAT_EQ(layout.glyphs[1].dest.x, 7.0f);
+    // 'e' cell in the atlas
+    EXPECT_FLOAT_EQ(layout.glyphs[1].source.x, ('e' - kFirstGlyph) * 6.0f);
+}
+
+TEST(TextRendererTest, SpacesAdvanceWithoutQuads) {
+    FakeFont font;
+    TextLayout layout = TextRenderer::build_layout(font.get(), "a b", 10);
+
+    ASSERT_EQ(layout.glyphs.size(), 2u);
+    EXPECT_FLOAT_EQ(layout.glyphs[1].dest.x, 14.0f);
+    EXPECT_FLOAT_EQ(layout.width, 20.0f);
+}
+
+TEST(TextRendererTest, NewlinesStartALineBelow) {
+    FakeFont font;
+    TextLayout layout = TextRenderer::build_layout(font.get(), "abc\nd", 10);
+
+    ASSERT_EQ(layout.glyphs.size(), 4u);
+    EXPECT_FLOAT_EQ(layout.glyphs[3].dest.x, 0.0f);
+    // Font size plus raylib's 2 px line spacing
+    EXPECT_FLOAT_EQ(layout.glyphs[3].dest.y, 12.0f);
+    // Widest line wins
+    EXPECT_FLOAT_EQ(layout.width, 20.0f);
+}
+
+TEST(TextRendererTest, ScalesGlyphsAndSpacingWithFontSize) {
+    FakeFont font;
+    TextLayout layout = TextRenderer::build_layout(font.get(), "ab", 20);
+
+    ASSERT_EQ(layout.glyphs.size(), 2u);
+    EXPECT_FLOAT_EQ(layout.glyphs[0].dest.width, 12.0f);
+    EXPECT_FLOAT_EQ(layout.glyphs[0].dest.height, 20.0f);
+    EXPECT_FLOAT_EQ(layout.glyphs[1].dest.x, 14.0f);
+    EXPECT_FLOAT_EQ(layout.width, 26.0f);
+}
+
+TEST(TextRendererTest, EmptyTextHasNoGlyphs) {
+    FakeFont font;
+    TextLayout layout = TextRenderer::build_layout(font.get(), "", 10);
+
+    EXPECT_TRUE(layout.glyphs.empty());
+    EXPECT_FLOAT_EQ(layout.width, 0.0f);
+}
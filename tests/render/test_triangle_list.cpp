@@ -0,0 +1,38 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+#include <raylib/raylib.h>
+
+#include "udjourney/render/TriangleList.hpp"
+
+using udjourney::TriangleList;
+
+TEST(TriangleListTest, LinesAndRectsAreTwoTriangles) {
+    TriangleList list;
+    EXPECT_TRUE(list.empty());
+
+    list.add_line(Vector2{0.0f, 0.0f}, Vector2{10.0f, 0.0f}, 4.0f);
+    EXPECT_EQ(list.get_triangle_count(), 2u);
+
+    list.add_rect(Rectangle{0.0f, 0.0f, 8.0f, 8.0f});
+    EXPECT_EQ(list.get_triangle_count(), 4u);
+
+    list.add_triangle(
+        Vector2{0.0f, 0.0f}, Vector2{4.0f, 0.0f}, Vector2{2.0f, -4.0f});
+    EXPECT_EQ(list.get_triangle_count(), 5u);
+}
+
+TEST(TriangleListTest, DegenerateLinesAreSkipped) {
+    TriangleList list;
+    list.add_line(Vector2{5.0f, 5.0f}, Vector2{5.0f, 5.0f}, 4.0f);
+    list.add_line(Vector2{0.0f, 0.0f}, Vector2{10.0f, 0.0f}, 0.0f);
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(TriangleListTest, ClearDropsGeometry) {
+    TriangleList list;
+    list.add_rect(Rectangle{0.0f, 0.0f, 8.0f, 8.0f});
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.get_triangle_count(), 0u);
+}
@@ -138,3 +138,30 @@ TEST_F(PlatformReuseTest, SetReuseStrategy) {
 
     EXPECT_TRUE(platform->has_reuse_strategy());
 }
+
+// Only static level platforms can be baked into static chunks
+TEST_F(PlatformReuseTest, OnlyStaticLevelPlatformsAreBakeable) {
+    struct MovingBehavior : PlatformBehaviorStrategy {
+        void update(Platform&, float) override {}
+        PlatformBehaviorType get_type() const override {
+            return PlatformBehaviorType::Horizontal;
+        }
+    };
+
+    Rectangle test_rect = {100, 100, 50, 20};
+
+    auto level_platform = std::make_unique<Platform>(*game, test_rect);
+    EXPECT_TRUE(level_platform->is_bakeable());
+
+    auto random_platform = std::make_unique<Platform>(
+        *game,
+        test_rect,
+        BLUE,
+        false,
+        std::make_unique<RandomizePositionStrategy>());
+    EXPECT_FALSE(random_platform->is_bakeable());
+
+    auto moving_platform = std::make_unique<Platform>(*game, test_rect);
+    moving_platform->set_behavior(std::make_unique<MovingBehavior>());
+    EXPECT_FALSE(moving_platform->is_bakeable());
+}
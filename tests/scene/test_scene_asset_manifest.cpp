@@ -0,0 +1,113 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "udjourney/scene/Scene.hpp"
+#include "udjourney/scene/SceneAssetManifest.hpp"
+
+using udjourney::scene::PlatformData;
+using udjourney::scene::Scene;
+using udjourney::scene::SceneAssetManifest;
+
+namespace {
+
+PlatformData textured_platform(const std::string& texture_file) {
+    PlatformData platform;
+    platform.width_tiles = 2;
+    platform.height_tiles = 1;
+    platform.texture_file = texture_file;
+    return platform;
+}
+
+}  // namespace
+
+TEST(SceneAssetManifestTest, CollectsPlatformTexturesOnceAndSorted) {
+    Scene scene;
+    scene.add_platform(textured_platform("platforms/stone.png"));
+    scene.add_platform(textured_platform("platforms/grass.png"));
+    scene.add_platform(textured_platform("platforms/stone.png"));
+    scene.add_platform(textured_platform(""));
+
+    const SceneAssetManifest manifest = SceneAssetManifest::collect(scene);
+    const auto& textures = manifest.get_textures();
+
+    // Player/projectile files are not found from the test directory, so
+    // only the scene's own references remain
+    ASSERT_EQ(textures.size(), 2u);
+    EXPECT_EQ(textures[0], "platforms/grass.png");
+    EXPECT_EQ(textures[1], "platforms/stone.png");
+}
+
+TEST(SceneAssetManifestTest, CachePathSitsNextToTheLevel) {
+    EXPECT_EQ(SceneAssetManifest::cache_path_for("assets/levels/level1.json"),
+              "assets/levels/level1.assets");
+    EXPECT_EQ(SceneAssetManifest::cache_path_for("levels/custom"),
+              "levels/custom.assets");
+}
+
+TEST(SceneAssetManifestTest, RoundTripsThroughTheCacheFile) {
+    const auto path = std::filesystem::temp_directory_path() /
+                      "scene_asset_manifest_test.assets";
+
+    SceneAssetManifest written;
+    written.add_texture("ui/ui_elements.png");
+    written.add_texture("char1-Sheet.png");
+    ASSERT_TRUE(written.save_to_file(path.string()));
+
+    SceneAssetManifest read;
+    ASSERT_TRUE(read.load_from_file(path.string()));
+    EXPECT_EQ(read.get_textures(), written.get_textures());
+
+    std::filesystem::remove(path);
+}
+
+TEST(SceneAssetManifestTest, RejectsCacheWithoutTextureList) {
+    const auto path = std::filesystem::temp_directory_path() /
+                      "scene_asset_manifest_bad.assets";
+    {
+        std::ofstream out(path);
+        out << R"({"sounds": []})";
+    }
+
+    SceneAssetManifest manifest;
+    EXPECT_FALSE(manifest.load_from_file(path.string()));
+    EXPECT_FALSE(manifest.load_from_file(path.string() + ".missing"));
+
+    std::filesystem::remove(path);
+}
+
+TEST(SceneAssetManifestTest, IgnoresCacheOlderThanTheLevel) {
+    const auto dir = std::filesystem::temp_directory_path();
+    const std::string level =
+        (dir / "scene_asset_manifest_level.json").string();
+    const std::string cache = SceneAssetManifest::cache_path_for(level);
+    {
+        std::ofstream out(level);
+        out << "{}";
+    }
+
+    SceneAssetManifest written;
+    written.add_texture("platforms/stone.png");
+    ASSERT_TRUE(written.save_to_file(cache));
+
+    const auto now = std::filesystem::last_write_time(level);
+    std::filesystem::last_write_time(level, now - std::chrono::hours(1));
+    SceneAssetManifest read;
+    EXPECT_TRUE(read.load_cache_for(level));
+    EXPECT_EQ(read.get_textures(), written.get_textures());
+
+    // Level edited after the cache was written
+    std::filesystem::last_write_time(cache, now - std::chrono::hours(2));
+    SceneAssetManifest stale;
+    EXPECT_FALSE(stale.load_cache_for(level));
+
+    std::filesystem::remove(cache);
+    EXPECT_FALSE(stale.load_cache_for(level));
+    std::filesystem::remove(level);
+}
@@ -0,0 +1,170 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "udjourney/scene/Scene.hpp"
+
+using namespace udjourney::scene;
+
+namespace {
+
+constexpr const char* kLevelJson = R"({
+  "name": "Compiled Level",
+  "scene_type": "level",
+  "scroll_speed": 2.5,
+  "gravity": 0.7,
+  "player_spawn": {"x": 3, "y": 9},
+  "platforms": [
+    {"x": 1.5, "y": 10, "width": 4, "height": 0.5},
+    {"x": 8, "y": 12, "behavior": "horizontal",
+     "behavior_params": {"speed": 1.5, "range": 4},
+     "features": ["checkpoint", "spikes"],
+     "feature_params": {"spike_height": 0.25},
+     "texture": "platforms/platforms_64_atlas-Sheet.png",
+     "use_atlas": true,
+     "source_rect": {"x": 64, "y": 0, "width": 64, "height": 32}}
+  ],
+  "monsters": [{"x": 5, "y": 8, "preset_name": "spiderplant"}],
+  "backgrounds": {"layers": [
+    {"name": "Far", "texture_file": "background/hill_1.png",
+     "parallax_factor": 0.25, "depth": 2, "repeat": true,
+     "objects": [{"sprite_name": "tree", "x": 10, "y": 20,
+                  "sprite_sheet": "background/trees.png", "tile_col": 2}]}
+  ]},
+  "huds": [{"name": "Score", "type_id": "score_display",
+            "anchor": "TopRight", "offset": {"x": -10, "y": 5},
+            "background_sheet": "ui/ui_elements.png",
+            "background_tile_row": 3,
+            "properties": {"font_size": 20, "label": "Score"}}],
+  "game_menu": {"title": "Paused", "items": [
+    {"label": "Resume", "action": "resume"},
+    {"label": "Quit", "action": "goto", "params": ["title_screen"]}]}
+})";
+
+}  // namespace
+
+class SceneBinaryTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        test_dir =
+            std::filesystem::temp_directory_path() / "scene_binary_tests";
+        std::filesystem::create_directories(test_dir);
+        json_path = (test_dir / "level.json").string();
+        std::ofstream(json_path) << kLevelJson;
+    }
+
+    void TearDown() override { std::filesystem::remove_all(test_dir); }
+
+    std::filesystem::path test_dir;
+    std::string json_path;
+};
+
+TEST_F(SceneBinaryTest, CompiledPathReplacesTheExtension) {
+    EXPECT_EQ(Scene::compiled_path_for("assets/levels/level1.json"),
+              "assets/levels/level1.udl");
+    EXPECT_EQ(Scene::compiled_path_for("levels/custom"), "levels/custom.udl");
+}
+
+TEST_F(SceneBinaryTest, RoundTripKeepsEverythingTheJsonHolds) {
+    Scene source;
+    ASSERT_TRUE(source.load_from_json(json_path));
+    const std::string udl_path = Scene::compiled_path_for(json_path);
+    ASSERT_TRUE(source.save_to_binary(udl_path));
+
+    Scene scene;
+    ASSERT_TRUE(scene.load_from_binary(udl_path));
+    EXPECT_EQ(scene.get_name(), "Compiled Level");
+    EXPECT_EQ(scene.get_type(), SceneType::Level);
+    EXPECT_FLOAT_EQ(scene.get_scroll_speed(), 2.5f);
+    EXPECT_FLOAT_EQ(scene.get_physics_config().gravity, 0.7f);
+    EXPECT_EQ(scene.get_player_spawn().tile_x, 3);
+    EXPECT_EQ(scene.get_player_spawn().tile_y, 9);
+
+    const auto& platforms = scene.get_platforms();
+    ASSERT_EQ(platforms.size(), 2u);
+    EXPECT_FLOAT_EQ(platforms[0].tile_x, 1.5f);
+    EXPECT_FLOAT_EQ(platforms[0].height_tiles, 0.5f);
+    EXPECT_TRUE(platforms[0].behavior_params.empty());
+    const PlatformData& moving = platforms[1];
+    EXPECT_EQ(moving.behavior_type, PlatformBehaviorType::Horizontal);
+    EXPECT_FLOAT_EQ(moving.behavior_params.at("speed"), 1.5f);
+    EXPECT_FLOAT_EQ(moving.behavior_params.at("range"), 4.0f);
+    EXPECT_FLOAT_EQ(moving.feature_params.at("spike_height"), 0.25f);
+    ASSERT_EQ(moving.features.size(), 2u);
+    EXPECT_EQ(moving.texture_file, "platforms/platforms_64_atlas-Sheet.png");
+    EXPECT_TRUE(moving.use_atlas);
+    EXPECT_FLOAT_EQ(moving.source_rect.x, 64.0f);
+    EXPECT_FLOAT_EQ(moving.source_rect.height, 32.0f);
+
+    ASSERT_EQ(scene.get_monster_spawns().size(), 1u);
+    EXPECT_EQ(scene.get_monster_spawns()[0].preset_name, "spiderplant");
+    EXPECT_EQ(scene.get_monster_spawns()[0].tile_x, 5);
+
+    ASSERT_EQ(scene.get_background_layers().size(), 1u);
+    const BackgroundLayerData& layer = scene.get_background_layers()[0];
+    EXPECT_EQ(layer.texture_file, "background/hill_1.png");
+    EXPECT_FLOAT_EQ(layer.parallax_factor, 0.25f);
+    EXPECT_TRUE(layer.repeat);
+    ASSERT_EQ(layer.objects.size(), 1u);
+    EXPECT_EQ(layer.objects[0].sprite_sheet, "background/trees.png");
+    EXPECT_EQ(layer.objects[0].tile_col, 2);
+
+    ASSERT_EQ(scene.get_huds().size(), 1u);
+    const HUDData& hud = scene.get_huds()[0];
+    EXPECT_EQ(hud.type_id, "score_display");
+    EXPECT_EQ(hud.anchor, HUDAnchor::TopRight);
+    EXPECT_FLOAT_EQ(hud.offset_x, -10.0f);
+    EXPECT_EQ(hud.background_sheet, "ui/ui_elements.png");
+    EXPECT_EQ(hud.background_tile_row, 3);
+    EXPECT_EQ(hud.properties.at("font_size"), "20");
+    EXPECT_EQ(hud.properties.at("label"), "Score");
+
+    const GameMenuData& menu = scene.get_game_menu();
+    EXPECT_EQ(menu.title, "Paused");
+    ASSERT_EQ(menu.items.size(), 2u);
+    EXPECT_EQ(menu.items[1].action, "goto");
+    ASSERT_EQ(menu.items[1].params.size(), 1u);
+    EXPECT_EQ(menu.items[1].params[0], "title_screen");
+}
+
+TEST_F(SceneBinaryTest, LoadFromFilePrefersACurrentCompiledLevel) {
+    Scene source;
+    ASSERT_TRUE(source.load_from_json(json_path));
+    source.set_name("From UDL");
+    const std::string udl_path = Scene::compiled_path_for(json_path);
+    ASSERT_TRUE(source.save_to_binary(udl_path));
+
+    Scene scene;
+    ASSERT_TRUE(scene.load_from_file(json_path));
+    EXPECT_EQ(scene.get_name(), "From UDL");
+
+    // A JSON edited after compiling wins over the stale .udl
+    std::filesystem::last_write_time(
+        udl_path,
+        std::filesystem::last_write_time(json_path) - std::chrono::hours(1));
+    ASSERT_TRUE(scene.load_from_file(json_path));
+    EXPECT_EQ(scene.get_name(), "Compiled Level");
+}
+
+TEST_F(SceneBinaryTest, RejectsTruncatedOrForeignFilesWithoutChanges) {
+    Scene source;
+    ASSERT_TRUE(source.load_from_json(json_path));
+    const std::string udl_path = Scene::compiled_path_for(json_path);
+    ASSERT_TRUE(source.save_to_binary(udl_path));
+
+    const auto size = std::filesystem::file_size(udl_path);
+    std::filesystem::resize_file(udl_path, size - 8);
+
+    Scene scene;
+    scene.set_name("Untouched");
+    EXPECT_FALSE(scene.load_from_binary(udl_path));
+    EXPECT_FALSE(scene.load_from_binary(json_path));
+    EXPECT_FALSE(scene.load_from_binary(udl_path + ".missing"));
+    EXPECT_EQ(scene.get_name(), "Untouched");
+    EXPECT_TRUE(scene.get_platforms().empty());
+}
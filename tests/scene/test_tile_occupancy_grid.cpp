@@ -0,0 +1,101 @@
+// Copyright 2025 Quentin Cartier
+
+#include <gtest/gtest.h>
+#include <raylib/raylib.h>
+
+#include "udjourney/scene/Scene.hpp"
+#include "udjourney/scene/TileOccupancyGrid.hpp"
+
+using namespace udjourney::scene;
+
+class TileOccupancyGridTest : public ::testing::Test {
+ protected:
+    static PlatformData make_platform(float tile_x, float tile_y,
+                                      float width_tiles, float height_tiles,
+                                      PlatformBehaviorType behavior =
+                                          PlatformBehaviorType::Static) {
+        PlatformData platform;
+        platform.tile_x = tile_x;
+        platform.tile_y = tile_y;
+        platform.width_tiles = width_tiles;
+        platform.height_tiles = height_tiles;
+        platform.behavior_type = behavior;
+        return platform;
+    }
+};
+
+TEST_F(TileOccupancyGridTest, EmptySceneHasNoSolidCells) {
+    Scene scene;
+    TileOccupancyGrid grid;
+    grid.build(scene);
+
+    EXPECT_TRUE(grid.empty());
+    EXPECT_FALSE(grid.is_solid(0.0f, 0.0f));
+}
+
+TEST_F(TileOccupancyGridTest, StaticPlatformIsSolid) {
+    Scene scene;
+    // Centered at (5, 10) tiles, 4x1 tiles -> x [96, 224], y [304, 336]
+    scene.add_platform(make_platform(5, 10, 4, 1));
+
+    TileOccupancyGrid grid;
+    grid.build(scene);
+
+    EXPECT_FALSE(grid.empty());
+    EXPECT_TRUE(grid.is_solid(100.0f, 310.0f));
+    EXPECT_TRUE(grid.is_solid(220.0f, 330.0f));
+    EXPECT_FALSE(grid.is_solid(100.0f, 290.0f));
+    EXPECT_FALSE(grid.is_solid(230.0f, 310.0f));
+    EXPECT_FALSE(grid.is_solid(-1000.0f, 310.0f));
+}
+
+TEST_F(TileOccupancyGridTest, MovingPlatformsAreIgnored) {
+    Scene scene;
+    scene.add_platform(
+        make_platform(5, 10, 4, 1, PlatformBehaviorType::Horizontal));
+
+    TileOccupancyGrid grid;
+    grid.build(scene);
+
+    EXPECT_TRUE(grid.empty());
+    EXPECT_FALSE(grid.is_solid(160.0f, 320.0f));
+}
+
+TEST_F(TileOccupancyGridTest, ThinPlatformCoversAtLeastOneCell) {
+    Scene scene;
+    // 0.1 tile high platform (3.2 px) still blocks particles
+    scene.add_platform(make_platform(2, 2, 2, 0.1f));
+
+    TileOccupancyGrid grid;
+    grid.build(scene);
+
+    EXPECT_TRUE(grid.is_solid(64.0f, 64.0f));
+}
+
+TEST_F(TileOccupancyGridTest, ClearRemovesAllCells) {
+    Scene scene;
+    scene.add_platform(make_platform(5, 10, 4, 1));
+
+    TileOccupancyGrid grid;
+    grid.build(scene);
+    grid.clear();
+
+    EXPECT_TRUE(grid.empty());
+    EXPECT_FALSE(grid.is_solid(160.0f, 320.0f));
+}
+
+TEST_F(TileOccupancyGridTest, ClearRectEmptiesOnlyItsCells) {
+    Scene scene;
+    // x [96, 224] and x [224, 352], both y [304, 336]
+    scene.add_platform(make_platform(5, 10, 4, 1));
+    scene.add_platform(make_platform(9, 10, 4, 1));
+
+    TileOccupancyGrid grid;
+    grid.build(scene);
+    grid.clear_rect(Rectangle{96.0f, 304.0f, 128.0f, 32.0f});
+
+    EXPECT_FALSE(grid.is_solid(100.0f, 310.0f));
+    EXPECT_FALSE(grid.is_solid(220.0f, 330.0f));
+    EXPECT_TRUE(grid.is_solid(230.0f, 310.0f));
+    EXPECT_TRUE(grid.is_solid(348.0f, 330.0f));
+}